@@ -0,0 +1,868 @@
+/**
+ * @file
+ * Micro benchmarks for the codec, serialization and bit serializer implementations.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ddl.h>
+#include "legacy_error_macros.h"
+
+using namespace ddl;
+
+namespace
+{
+
+/// Flat struct with mixed primitive types, big endian elements and bitfields.
+const char* strFlatDesc =
+    "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+    "<structs>"
+    "<struct alignment=\"8\" name=\"flat\" version=\"2\">"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"u8\" type=\"tUInt8\"/>"
+    "<element alignment=\"2\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"1\" name=\"i16\" type=\"tInt16\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"3\" name=\"u32\" type=\"tUInt32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"7\" name=\"f32\" type=\"tFloat32\"/>"
+    "<element alignment=\"8\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"11\" name=\"f64\" type=\"tFloat64\"/>"
+    "<element alignment=\"8\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"19\" name=\"i64\" type=\"tInt64\"/>"
+    "<element alignment=\"2\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"27\" name=\"be_u16\" type=\"tUInt16\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"29\" name=\"be_i32\" type=\"tInt32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"33\" name=\"be_f32\" type=\"tFloat32\"/>"
+    "<element alignment=\"8\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"37\" name=\"be_f64\" type=\"tFloat64\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"45\" bitpos=\"0\" numbits=\"3\" name=\"bits_a\" type=\"tUInt8\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"45\" bitpos=\"3\" numbits=\"5\" name=\"bits_b\" type=\"tUInt8\"/>"
+    "<element alignment=\"2\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"46\" bitpos=\"0\" numbits=\"12\" name=\"bits_c\" type=\"tUInt16\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"48\" name=\"flag\" type=\"tBool\"/>"
+    "<element alignment=\"4\" arraysize=\"8\" byteorder=\"LE\" bytepos=\"49\" name=\"samples\" type=\"tInt32\"/>"
+    "<element alignment=\"4\" arraysize=\"8\" byteorder=\"BE\" bytepos=\"81\" name=\"be_samples\" type=\"tFloat32\"/>"
+    "</struct>"
+    "</structs>";
+
+/// Nested struct with a header and an array of object structs.
+const char* strNestedDesc =
+    "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+    "<structs>"
+    "<struct alignment=\"8\" name=\"header\" version=\"2\">"
+    "<element alignment=\"8\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"timestamp\" type=\"tUInt64\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"8\" name=\"sequence\" type=\"tUInt32\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"12\" name=\"source\" type=\"tUInt8\"/>"
+    "</struct>"
+    "<struct alignment=\"4\" name=\"object\" version=\"2\">"
+    "<element alignment=\"2\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"0\" name=\"id\" type=\"tUInt16\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"2\" name=\"x\" type=\"tFloat32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"6\" name=\"y\" type=\"tFloat32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"10\" name=\"vx\" type=\"tFloat32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"BE\" bytepos=\"14\" name=\"vy\" type=\"tFloat32\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"18\" name=\"classification\" type=\"tUInt8\"/>"
+    "</struct>"
+    "<struct alignment=\"8\" name=\"nested\" version=\"2\">"
+    "<element alignment=\"8\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"header\" type=\"header\"/>"
+    "<element alignment=\"4\" arraysize=\"32\" byteorder=\"LE\" bytepos=\"13\" name=\"objects\" type=\"object\"/>"
+    "</struct>"
+    "</structs>";
+
+/// Struct with a dynamic array of point structs.
+const char* strDynamicDesc =
+    "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+    "<structs>"
+    "<struct alignment=\"4\" name=\"point\" version=\"2\">"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"x\" type=\"tFloat32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"4\" name=\"y\" type=\"tFloat32\"/>"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"8\" name=\"z\" type=\"tFloat32\"/>"
+    "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"12\" name=\"intensity\" type=\"tUInt8\"/>"
+    "</struct>"
+    "<struct alignment=\"4\" name=\"dynamic\" version=\"2\">"
+    "<element alignment=\"4\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"count\" type=\"tUInt32\"/>"
+    "<element alignment=\"4\" arraysize=\"count\" byteorder=\"LE\" bytepos=\"4\" name=\"points\" type=\"point\"/>"
+    "</struct>"
+    "</structs>";
+
+/// Struct with a large big endian array like the ones derived from CAN and FlexRay.
+const char* strArrayDesc =
+    "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+    "<structs>"
+    "<struct alignment=\"4\" name=\"array\" version=\"2\">"
+    "<element alignment=\"4\" arraysize=\"1024\" byteorder=\"BE\" bytepos=\"0\" name=\"values\" type=\"tUInt32\"/>"
+    "</struct>"
+    "</structs>";
+
+/// Maps the flat struct onto itself, triggered by every received sample.
+const char* strFlatMapping =
+    "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+    "<mapping>"
+    "<header>"
+    "<language_version>1.00</language_version>"
+    "<author>ddl_benchmarks</author>"
+    "<date_creation>2026-Oct-17</date_creation>"
+    "<date_change>2026-Oct-17</date_change>"
+    "<description>Mapping of the flat struct</description>"
+    "</header>"
+    "<sources>"
+    "<source name=\"in\" type=\"flat\"/>"
+    "</sources>"
+    "<targets>"
+    "<target name=\"out\" type=\"flat\">"
+    "<assignment to=\"u8\" from=\"in.u8\"/>"
+    "<assignment to=\"i16\" from=\"in.i16\"/>"
+    "<assignment to=\"u32\" from=\"in.u32\"/>"
+    "<assignment to=\"f32\" from=\"in.f32\"/>"
+    "<assignment to=\"f64\" from=\"in.f64\"/>"
+    "<assignment to=\"i64\" from=\"in.i64\"/>"
+    "<assignment to=\"flag\" from=\"in.flag\"/>"
+    "<trigger type=\"signal\" variable=\"in\"/>"
+    "</target>"
+    "</targets>"
+    "</mapping>";
+
+/// The amount of points in the dynamic struct.
+const uint32_t nDynamicPointCount = 64;
+
+/// Keeps the compiler from optimizing away the benchmarked code.
+volatile uint64_t nSink = 0;
+
+inline void consume(uint64_t nValue)
+{
+    nSink = nSink ^ nValue;
+}
+
+/**
+ * The measurement of a single benchmark case.
+ */
+struct BenchmarkResult
+{
+    std::string strName;
+    size_t nElements;
+    size_t nBytes;
+    uint64_t nIterations;
+    double fNanoseconds;
+};
+
+/**
+ * Runs benchmark cases until a minimum amount of time has elapsed and collects the results.
+ */
+class BenchmarkRunner
+{
+    public:
+        BenchmarkRunner(const std::string& strFilter, double fMinSeconds):
+            _filter(strFilter),
+            _min_seconds(fMinSeconds)
+        {
+        }
+
+        /**
+         * Measures a benchmark case.
+         * @param[in] strName The name of the case.
+         * @param[in] nElements The amount of elements that a single iteration processes.
+         * @param[in] nBytes The amount of bytes that a single iteration processes.
+         * @param[in] fnIteration The function that runs a single iteration.
+         */
+        template <typename FUNCTION>
+        void run(const std::string& strName, size_t nElements, size_t nBytes, FUNCTION fnIteration)
+        {
+            if (!_filter.empty() && strName.find(_filter) == std::string::npos)
+            {
+                return;
+            }
+
+            // warm up caches and lazily initialized data
+            fnIteration();
+
+            typedef std::chrono::high_resolution_clock Clock;
+            uint64_t nIterations = 1;
+            double fNanoseconds = 0.0;
+            for (;;)
+            {
+                Clock::time_point tStart = Clock::now();
+                for (uint64_t nIteration = 0; nIteration < nIterations; ++nIteration)
+                {
+                    fnIteration();
+                }
+                fNanoseconds = static_cast<double>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - tStart).count());
+
+                if (fNanoseconds >= _min_seconds * 1e9 || nIterations >= (static_cast<uint64_t>(1) << 40))
+                {
+                    break;
+                }
+                nIterations *= fNanoseconds < _min_seconds * 1e8 ? 10 : 2;
+            }
+
+            BenchmarkResult sResult;
+            sResult.strName = strName;
+            sResult.nElements = nElements;
+            sResult.nBytes = nBytes;
+            sResult.nIterations = nIterations;
+            sResult.fNanoseconds = fNanoseconds;
+            _results.push_back(sResult);
+
+            std::cerr << std::left << std::setw(56) << strName << std::right << std::fixed
+                      << std::setprecision(2) << std::setw(12) << getNsPerElement(sResult) << " ns/element"
+                      << std::setw(10) << getGbPerSecond(sResult) << " GB/s\n";
+        }
+
+        /**
+         * Writes the results as JSON.
+         * @param[in] oStream The stream to write to.
+         */
+        void writeJson(std::ostream& oStream) const
+        {
+            oStream << "{\n  \"context\": {\"min_time_s\": " << _min_seconds << "},\n  \"benchmarks\": [";
+            for (std::vector<BenchmarkResult>::const_iterator itResult = _results.begin();
+                 itResult != _results.end(); ++itResult)
+            {
+                oStream << (itResult == _results.begin() ? "\n" : ",\n")
+                        << "    {\"name\": \"" << escape(itResult->strName) << "\""
+                        << ", \"elements\": " << itResult->nElements
+                        << ", \"bytes\": " << itResult->nBytes
+                        << ", \"iterations\": " << itResult->nIterations
+                        << ", \"total_ns\": " << std::fixed << std::setprecision(0) << itResult->fNanoseconds
+                        << ", \"ns_per_iteration\": " << std::setprecision(3)
+                        << itResult->fNanoseconds / static_cast<double>(itResult->nIterations)
+                        << ", \"ns_per_element\": " << getNsPerElement(*itResult)
+                        << ", \"gb_per_s\": " << std::setprecision(4) << getGbPerSecond(*itResult) << "}";
+            }
+            oStream << "\n  ]\n}\n";
+        }
+
+    private:
+        static double getNsPerElement(const BenchmarkResult& sResult)
+        {
+            return sResult.fNanoseconds /
+                   (static_cast<double>(sResult.nIterations) * static_cast<double>(std::max<size_t>(sResult.nElements, 1)));
+        }
+
+        static double getGbPerSecond(const BenchmarkResult& sResult)
+        {
+            // bytes per nanosecond equals gigabytes per second
+            return sResult.fNanoseconds > 0.0 ?
+                   static_cast<double>(sResult.nBytes) * static_cast<double>(sResult.nIterations) / sResult.fNanoseconds :
+                   0.0;
+        }
+
+        static std::string escape(const std::string& strValue)
+        {
+            std::string strEscaped;
+            for (std::string::const_iterator itChar = strValue.begin(); itChar != strValue.end(); ++itChar)
+            {
+                if (*itChar == '"' || *itChar == '\\')
+                {
+                    strEscaped += '\\';
+                }
+                strEscaped += *itChar;
+            }
+            return strEscaped;
+        }
+
+    private:
+        std::string _filter;
+        double _min_seconds;
+        std::vector<BenchmarkResult> _results;
+};
+
+/**
+ * A struct description together with sample data in both representations.
+ */
+struct BenchmarkStruct
+{
+    std::string strLabel;
+    std::string strStructName;
+    const char* strDescription;
+    std::vector<uint8_t> vecDeserialized;
+    std::vector<uint8_t> vecSerialized;
+};
+
+a_util::result::Result createSampleData(BenchmarkStruct& sStruct)
+{
+    CodecFactory oFactory(sStruct.strStructName.c_str(), sStruct.strDescription);
+    RETURN_IF_FAILED(oFactory.isValid());
+
+    if (oFactory.hasDynamicElements())
+    {
+        // set the array size on a large enough buffer and recalculate the layout afterwards
+        std::vector<uint8_t> vecData(nDynamicPointCount * 64, 0);
+        {
+            Codec oCodec = oFactory.makeCodecFor(&vecData[0], vecData.size());
+            RETURN_IF_FAILED(access_element::set_value(oCodec, "count", &nDynamicPointCount));
+        }
+        Decoder oDecoder = oFactory.makeDecoderFor(&vecData[0], vecData.size());
+        RETURN_IF_FAILED(oDecoder.isValid());
+        vecData.resize(oDecoder.getBufferSize(deserialized));
+        sStruct.vecDeserialized.swap(vecData);
+    }
+    else
+    {
+        sStruct.vecDeserialized.resize(oFactory.getStaticBufferSize(deserialized));
+    }
+
+    // fill all elements with deterministic values
+    Codec oCodec = oFactory.makeCodecFor(&sStruct.vecDeserialized[0], sStruct.vecDeserialized.size());
+    RETURN_IF_FAILED(oCodec.isValid());
+    for (size_t nElement = 0; nElement < oCodec.getElementCount(); ++nElement)
+    {
+        const StructElement* pElement = NULL;
+        RETURN_IF_FAILED(oCodec.getElement(nElement, pElement));
+        if (pElement->name == "count")
+        {
+            continue;
+        }
+        RETURN_IF_FAILED(oCodec.setElementValue(nElement,
+                                                a_util::variant::Variant(static_cast<int32_t>(nElement % 7))));
+    }
+
+    a_util::memory::MemoryBuffer oSerialized;
+    RETURN_IF_FAILED(serialization::transform_to_buffer(oCodec, oSerialized, true));
+    const uint8_t* pSerialized = static_cast<const uint8_t*>(oSerialized.getPtr());
+    sStruct.vecSerialized.assign(pSerialized, pSerialized + oSerialized.getSize());
+
+    return a_util::result::SUCCESS;
+}
+
+std::vector<std::string> getElementNames(const StaticDecoder& oDecoder)
+{
+    std::vector<std::string> vecNames;
+    for (size_t nElement = 0; nElement < oDecoder.getElementCount(); ++nElement)
+    {
+        const StructElement* pElement = NULL;
+        if (isOk(oDecoder.getElement(nElement, pElement)))
+        {
+            vecNames.push_back(pElement->name);
+        }
+    }
+    return vecNames;
+}
+
+void benchmarkFactory(BenchmarkRunner& oRunner, const BenchmarkStruct& sStruct)
+{
+    const std::string strPrefix = "factory/create/" + sStruct.strLabel;
+    const char* strStructName = sStruct.strStructName.c_str();
+    const char* strDescription = sStruct.strDescription;
+    size_t nElements = CodecFactory(strStructName, strDescription).getStaticElementCount();
+    size_t nBytes = std::strlen(strDescription);
+
+    oRunner.run(strPrefix + "/cached", nElements, nBytes, [&]()
+    {
+        CodecFactory oFactory(strStructName, strDescription);
+        consume(oFactory.getStaticElementCount());
+    });
+
+    oRunner.run(strPrefix + "/uncached", nElements, nBytes, [&]()
+    {
+        CodecFactory::clearLayoutCache();
+        CodecFactory oFactory(strStructName, strDescription);
+        consume(oFactory.getStaticElementCount());
+    });
+}
+
+/**
+ * Measures reading all elements by index and by name.
+ */
+template <typename DECODER>
+void benchmarkGet(BenchmarkRunner& oRunner, const std::string& strPrefix, const DECODER& oDecoder, size_t nBytes)
+{
+    const size_t nElements = oDecoder.getElementCount();
+    const std::vector<std::string> vecNames = getElementNames(oDecoder);
+
+    oRunner.run(strPrefix + "/get_by_index", nElements, nBytes, [&]()
+    {
+        for (size_t nElement = 0; nElement < nElements; ++nElement)
+        {
+            uint64_t nValue = 0;
+            oDecoder.getElementValue(nElement, &nValue);
+            consume(nValue);
+        }
+    });
+
+    oRunner.run(strPrefix + "/get_by_name", nElements, nBytes, [&]()
+    {
+        for (std::vector<std::string>::const_iterator itName = vecNames.begin();
+             itName != vecNames.end(); ++itName)
+        {
+            uint64_t nValue = 0;
+            access_element::get_value(oDecoder, *itName, &nValue);
+            consume(nValue);
+        }
+    });
+}
+
+/**
+ * Measures writing all elements by index and by name.
+ * The current values are written back, so that dynamic layouts stay unchanged.
+ */
+template <typename CODEC>
+void benchmarkSet(BenchmarkRunner& oRunner, const std::string& strPrefix, CODEC& oCodec, size_t nBytes)
+{
+    const size_t nElements = oCodec.getElementCount();
+    const std::vector<std::string> vecNames = getElementNames(oCodec);
+    std::vector<uint64_t> vecValues(nElements, 0);
+    for (size_t nElement = 0; nElement < nElements; ++nElement)
+    {
+        oCodec.getElementValue(nElement, &vecValues[nElement]);
+    }
+
+    oRunner.run(strPrefix + "/set_by_index", nElements, nBytes, [&]()
+    {
+        for (size_t nElement = 0; nElement < nElements; ++nElement)
+        {
+            oCodec.setElementValue(nElement, &vecValues[nElement]);
+        }
+        consume(vecValues.size());
+    });
+
+    oRunner.run(strPrefix + "/set_by_name", nElements, nBytes, [&]()
+    {
+        for (size_t nElement = 0; nElement < vecNames.size(); ++nElement)
+        {
+            access_element::set_value(oCodec, vecNames[nElement], &vecValues[nElement]);
+        }
+        consume(vecValues.size());
+    });
+}
+
+a_util::result::Result benchmarkCodecs(BenchmarkRunner& oRunner, BenchmarkStruct& sStruct)
+{
+    CodecFactory oFactory(sStruct.strStructName.c_str(), sStruct.strDescription);
+    RETURN_IF_FAILED(oFactory.isValid());
+
+    DataRepresentation aReps[] = {deserialized, serialized};
+    for (size_t nRep = 0; nRep < 2; ++nRep)
+    {
+        DataRepresentation eRep = aReps[nRep];
+        std::vector<uint8_t>& vecData = eRep == deserialized ? sStruct.vecDeserialized : sStruct.vecSerialized;
+        const std::string strRep = eRep == deserialized ? "deserialized" : "serialized";
+        const std::string strSuffix = "/" + sStruct.strLabel + "/" + strRep;
+
+        Decoder oDecoder = oFactory.makeDecoderFor(&vecData[0], vecData.size(), eRep);
+        RETURN_IF_FAILED(oDecoder.isValid());
+        Codec oCodec = oFactory.makeCodecFor(&vecData[0], vecData.size(), eRep);
+        RETURN_IF_FAILED(oCodec.isValid());
+
+        if (!oFactory.hasDynamicElements())
+        {
+            StaticDecoder oStaticDecoder = oFactory.makeStaticDecoderFor(&vecData[0], vecData.size(), eRep);
+            RETURN_IF_FAILED(oStaticDecoder.isValid());
+            StaticCodec oStaticCodec = oFactory.makeStaticCodecFor(&vecData[0], vecData.size(), eRep);
+            RETURN_IF_FAILED(oStaticCodec.isValid());
+            benchmarkGet(oRunner, "static_decoder" + strSuffix, oStaticDecoder, vecData.size());
+            benchmarkSet(oRunner, "static_codec" + strSuffix, oStaticCodec, vecData.size());
+        }
+
+        benchmarkGet(oRunner, "decoder" + strSuffix, oDecoder, vecData.size());
+        benchmarkGet(oRunner, "codec" + strSuffix, oCodec, vecData.size());
+        benchmarkSet(oRunner, "codec" + strSuffix, oCodec, vecData.size());
+
+        oRunner.run("decoder" + strSuffix + "/make", oDecoder.getElementCount(), vecData.size(), [&]()
+        {
+            Decoder oNewDecoder = oFactory.makeDecoderFor(&vecData[0], vecData.size(), eRep);
+            consume(oNewDecoder.getElementCount());
+        });
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result benchmarkTransform(BenchmarkRunner& oRunner, BenchmarkStruct& sStruct)
+{
+    CodecFactory oFactory(sStruct.strStructName.c_str(), sStruct.strDescription);
+    RETURN_IF_FAILED(oFactory.isValid());
+
+    DataRepresentation aReps[] = {deserialized, serialized};
+    for (size_t nRep = 0; nRep < 2; ++nRep)
+    {
+        DataRepresentation eSourceRep = aReps[nRep];
+        DataRepresentation eTargetRep = eSourceRep == deserialized ? serialized : deserialized;
+        std::vector<uint8_t>& vecSource = eSourceRep == deserialized ? sStruct.vecDeserialized : sStruct.vecSerialized;
+        std::vector<uint8_t> vecTarget = eSourceRep == deserialized ? sStruct.vecSerialized : sStruct.vecDeserialized;
+        const std::string strPrefix = std::string("transform/") + sStruct.strLabel + "/" +
+                                      (eSourceRep == deserialized ? "to_serialized" : "to_deserialized");
+
+        Decoder oDecoder = oFactory.makeDecoderFor(&vecSource[0], vecSource.size(), eSourceRep);
+        RETURN_IF_FAILED(oDecoder.isValid());
+        Codec oCodec = oFactory.makeCodecFor(&vecTarget[0], vecTarget.size(), eTargetRep);
+        RETURN_IF_FAILED(oCodec.isValid());
+        serialization::TransformPlan oPlan;
+        RETURN_IF_FAILED(oPlan.create(oDecoder, eTargetRep));
+        a_util::memory::MemoryBuffer oBuffer;
+
+        const size_t nElements = oDecoder.getElementCount();
+        const size_t nBytes = vecSource.size() + vecTarget.size();
+
+        oRunner.run(strPrefix + "/element_wise", nElements, nBytes, [&]()
+        {
+            consume(isOk(serialization::transform(oDecoder, oCodec)) ? 1 : 0);
+        });
+
+        oRunner.run(strPrefix + "/to_buffer", nElements, nBytes, [&]()
+        {
+            consume(isOk(serialization::transform_to_buffer(oDecoder, oBuffer)) ? 1 : 0);
+        });
+
+        oRunner.run(strPrefix + "/plan", nElements, nBytes, [&]()
+        {
+            consume(isOk(oPlan.execute(&vecSource[0], vecSource.size(), &vecTarget[0], vecTarget.size())) ? 1 : 0);
+        });
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+/**
+ * Compares element-wise and array access to a big endian array through the codecs.
+ */
+a_util::result::Result benchmarkArrays(BenchmarkRunner& oRunner)
+{
+    CodecFactory oFactory("array", strArrayDesc);
+    RETURN_IF_FAILED(oFactory.isValid());
+
+    std::vector<uint8_t> vecData(oFactory.getStaticBufferSize(serialized), 0x5A);
+    StaticCodec oCodec = oFactory.makeStaticCodecFor(&vecData[0], vecData.size(), serialized);
+    RETURN_IF_FAILED(oCodec.isValid());
+    const size_t nCount = oCodec.getElementCount();
+    std::vector<uint32_t> vecValues(nCount, 0);
+
+    oRunner.run("codec/array/serialized/get_element_wise", nCount, vecData.size(), [&]()
+    {
+        for (size_t nElement = 0; nElement < nCount; ++nElement)
+        {
+            oCodec.getElementValue(nElement, &vecValues[nElement]);
+        }
+        consume(vecValues[0]);
+    });
+
+    oRunner.run("codec/array/serialized/get_array", nCount, vecData.size(), [&]()
+    {
+        oCodec.getArrayValues(0, nCount, &vecValues[0]);
+        consume(vecValues[0]);
+    });
+
+    oRunner.run("codec/array/serialized/set_element_wise", nCount, vecData.size(), [&]()
+    {
+        for (size_t nElement = 0; nElement < nCount; ++nElement)
+        {
+            oCodec.setElementValue(nElement, &vecValues[nElement]);
+        }
+        consume(vecData[0]);
+    });
+
+    oRunner.run("codec/array/serialized/set_array", nCount, vecData.size(), [&]()
+    {
+        oCodec.setArrayValues(0, nCount, &vecValues[0]);
+        consume(vecData[0]);
+    });
+
+    return a_util::result::SUCCESS;
+}
+
+/**
+ * Mapping environment that resolves all types from a single description and
+ * discards the targets.
+ */
+class BenchmarkEnvironment: public mapping::rt::IMappingEnvironment
+{
+    public:
+        BenchmarkEnvironment(const char* strDescription):
+            _description(strDescription),
+            _listener(NULL)
+        {
+        }
+
+        mapping::rt::ISignalListener* getListener() const
+        {
+            return _listener;
+        }
+
+        a_util::result::Result registerSource(const char*, const char*,
+                                              mapping::rt::ISignalListener* pListener,
+                                              handle_t& hHandle)
+        {
+            _listener = pListener;
+            hHandle = pListener;
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result unregisterSource(handle_t)
+        {
+            _listener = NULL;
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result sendTarget(handle_t, const void* pData, size_t, timestamp_t)
+        {
+            consume(static_cast<const uint8_t*>(pData)[0]);
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result targetMapped(const char*, const char*, handle_t, size_t)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result targetUnmapped(const char*, handle_t)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result resolveType(const char*, const char*& strTypeDescription)
+        {
+            strTypeDescription = _description;
+            return a_util::result::SUCCESS;
+        }
+
+        timestamp_t getTime() const
+        {
+            return 0;
+        }
+
+        a_util::result::Result registerPeriodicTimer(timestamp_t, mapping::rt::IPeriodicListener*)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result unregisterPeriodicTimer(timestamp_t, mapping::rt::IPeriodicListener*)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+    private:
+        const char* _description;
+        mapping::rt::ISignalListener* _listener;
+};
+
+/**
+ * Measures the mapping of a sample with the instrumentation of the engine switched off and on.
+ */
+a_util::result::Result benchmarkMapping(BenchmarkRunner& oRunner, const BenchmarkStruct& sStruct)
+{
+    DDLImporter oImporter;
+    a_util::memory::unique_ptr<DDLDescription> pDefault(
+        DDLDescription::createDefault(DDLVersion::ddl_version_current, 4));
+    RETURN_IF_FAILED(oImporter.setXML(sStruct.strDescription));
+    RETURN_IF_FAILED(oImporter.createPartial(pDefault.get(), DDLVersion::ddl_version_current));
+    a_util::memory::unique_ptr<DDLDescription> pDescription(oImporter.getDDL());
+
+    mapping::oo::MapConfiguration oConfig;
+    RETURN_IF_FAILED(oConfig.setDescription(pDescription.get()));
+    a_util::xml::DOM oDom;
+    if (!oDom.fromString(strFlatMapping))
+    {
+        return a_util::result::Result(-36);
+    }
+    RETURN_IF_FAILED(oConfig.loadFromDOM(oDom));
+
+    BenchmarkEnvironment oEnv(sStruct.strDescription);
+    mapping::rt::MappingEngine oEngine(oEnv);
+    handle_t hTarget = NULL;
+    RETURN_IF_FAILED(oEngine.setConfiguration(oConfig));
+    RETURN_IF_FAILED(oEngine.Map("out", hTarget));
+    RETURN_IF_FAILED(oEngine.start());
+
+    mapping::rt::ISignalListener* pListener = oEnv.getListener();
+    const std::vector<uint8_t>& vecSample = sStruct.vecDeserialized;
+    oEngine.enableInstrumentation(false);
+    oRunner.run("mapping/" + sStruct.strLabel + "/sample/instrumentation_off", 1, vecSample.size(), [&]()
+    {
+        pListener->onSampleReceived(&vecSample[0], vecSample.size());
+    });
+
+    oEngine.enableInstrumentation(true);
+    oRunner.run("mapping/" + sStruct.strLabel + "/sample/instrumentation_on", 1, vecSample.size(), [&]()
+    {
+        pListener->onSampleReceived(&vecSample[0], vecSample.size());
+    });
+    oEngine.enableInstrumentation(false);
+
+    RETURN_IF_FAILED(oEngine.stop());
+    return oEngine.unmapAll();
+}
+
+const char* getEndianessName(a_util::memory::Endianess eEndianess)
+{
+    return eEndianess == a_util::memory::bit_big_endian ? "be" : "le";
+}
+
+/**
+ * Measures single value and array access of the bit serializer.
+ */
+template <typename T>
+void benchmarkBitSerializer(BenchmarkRunner& oRunner, const std::string& strType, std::vector<uint8_t>& vecBuffer,
+                            size_t nCount)
+{
+    const size_t nBitSize = sizeof(T) * 8;
+    a_util::memory::Endianess aEndianess[] = {a_util::memory::bit_little_endian, a_util::memory::bit_big_endian};
+    size_t aBitOffsets[] = {0, 3};
+    std::vector<T> vecValues(nCount, static_cast<T>(0x5A));
+
+    for (size_t nEndianess = 0; nEndianess < 2; ++nEndianess)
+    {
+        a_util::memory::Endianess eEndianess = aEndianess[nEndianess];
+        for (size_t nOffset = 0; nOffset < 2; ++nOffset)
+        {
+            size_t nBitOffset = aBitOffsets[nOffset];
+            std::ostringstream oSuffix;
+            oSuffix << "/" << strType << "/bit_offset_" << nBitOffset << "/" << getEndianessName(eEndianess);
+
+            oRunner.run("bitserializer/read" + oSuffix.str(), nCount, nCount * sizeof(T), [&]()
+            {
+                a_util::memory::BitSerializer oSerializer(&vecBuffer[0], vecBuffer.size());
+                for (size_t nValue = 0; nValue < nCount; ++nValue)
+                {
+                    T xValue = 0;
+                    oSerializer.read<T>(nBitOffset + nValue * nBitSize, nBitSize, &xValue, eEndianess);
+                    consume(static_cast<uint64_t>(xValue));
+                }
+            });
+
+            oRunner.run("bitserializer/write" + oSuffix.str(), nCount, nCount * sizeof(T), [&]()
+            {
+                a_util::memory::BitSerializer oSerializer(&vecBuffer[0], vecBuffer.size());
+                for (size_t nValue = 0; nValue < nCount; ++nValue)
+                {
+                    oSerializer.write<T>(nBitOffset + nValue * nBitSize, nBitSize, vecValues[nValue], eEndianess);
+                }
+                consume(vecBuffer[0]);
+            });
+
+            oRunner.run("bitserializer/read_array" + oSuffix.str(), nCount, nCount * sizeof(T), [&]()
+            {
+                a_util::memory::BitSerializer oSerializer(&vecBuffer[0], vecBuffer.size());
+                oSerializer.readArray<T>(nBitOffset, nCount, &vecValues[0], eEndianess);
+                consume(static_cast<uint64_t>(vecValues[0]));
+            });
+
+            oRunner.run("bitserializer/write_array" + oSuffix.str(), nCount, nCount * sizeof(T), [&]()
+            {
+                a_util::memory::BitSerializer oSerializer(&vecBuffer[0], vecBuffer.size());
+                oSerializer.writeArray<T>(nBitOffset, nCount, &vecValues[0], eEndianess);
+                consume(vecBuffer[0]);
+            });
+        }
+    }
+}
+
+void printUsage(const char* strProgram)
+{
+    std::cerr << "Usage: " << strProgram << " [--json <file>] [--filter <substring>] [--min-time <seconds>]\n"
+              << "  --json      Write the results to the given file instead of stdout.\n"
+              << "  --filter    Only run benchmarks whose name contains the given substring.\n"
+              << "  --min-time  Minimum measurement time per benchmark in seconds (default: 0.2).\n";
+}
+
+}
+
+int main(int argc, char* argv[])
+{
+    std::string strJsonFile;
+    std::string strFilter;
+    double fMinSeconds = 0.2;
+    for (int nArg = 1; nArg < argc; ++nArg)
+    {
+        std::string strArg = argv[nArg];
+        if (strArg == "--json" && nArg + 1 < argc)
+        {
+            strJsonFile = argv[++nArg];
+        }
+        else if (strArg == "--filter" && nArg + 1 < argc)
+        {
+            strFilter = argv[++nArg];
+        }
+        else if (strArg == "--min-time" && nArg + 1 < argc)
+        {
+            fMinSeconds = std::atof(argv[++nArg]);
+        }
+        else
+        {
+            printUsage(argv[0]);
+            return strArg == "--help" ? 0 : 1;
+        }
+    }
+
+    BenchmarkRunner oRunner(strFilter, fMinSeconds);
+
+    BenchmarkStruct aStructs[3];
+    aStructs[0].strLabel = "flat";
+    aStructs[0].strStructName = "flat";
+    aStructs[0].strDescription = strFlatDesc;
+    aStructs[1].strLabel = "nested";
+    aStructs[1].strStructName = "nested";
+    aStructs[1].strDescription = strNestedDesc;
+    aStructs[2].strLabel = "dynamic";
+    aStructs[2].strStructName = "dynamic";
+    aStructs[2].strDescription = strDynamicDesc;
+
+    for (size_t nStruct = 0; nStruct < 3; ++nStruct)
+    {
+        BenchmarkStruct& sStruct = aStructs[nStruct];
+        a_util::result::Result oResult = createSampleData(sStruct);
+        if (isOk(oResult))
+        {
+            benchmarkFactory(oRunner, sStruct);
+            oResult = benchmarkCodecs(oRunner, sStruct);
+        }
+        if (isOk(oResult))
+        {
+            oResult = benchmarkTransform(oRunner, sStruct);
+        }
+        if (isOk(oResult) && nStruct == 0)
+        {
+            oResult = benchmarkMapping(oRunner, sStruct);
+        }
+        if (isFailed(oResult))
+        {
+            std::cerr << "Benchmarking struct '" << sStruct.strLabel << "' failed: "
+                      << oResult.getDescription() << "\n";
+            return 1;
+        }
+    }
+
+    a_util::result::Result oArrayResult = benchmarkArrays(oRunner);
+    if (isFailed(oArrayResult))
+    {
+        std::cerr << "Benchmarking arrays failed: " << oArrayResult.getDescription() << "\n";
+        return 1;
+    }
+
+    const size_t nBitSerializerCount = 1024;
+    std::vector<uint8_t> vecBuffer(nBitSerializerCount * 8 + 8, 0);
+    benchmarkBitSerializer<uint16_t>(oRunner, "u16", vecBuffer, nBitSerializerCount);
+    benchmarkBitSerializer<uint32_t>(oRunner, "u32", vecBuffer, nBitSerializerCount);
+    benchmarkBitSerializer<uint64_t>(oRunner, "u64", vecBuffer, nBitSerializerCount);
+
+    if (strJsonFile.empty())
+    {
+        oRunner.writeJson(std::cout);
+    }
+    else
+    {
+        std::ofstream oFile(strJsonFile.c_str());
+        if (!oFile)
+        {
+            std::cerr << "Unable to open '" << strJsonFile << "' for writing\n";
+            return 1;
+        }
+        oRunner.writeJson(oFile);
+    }
+
+    return 0;
+}
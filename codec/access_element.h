@@ -66,6 +66,62 @@ inline a_util::result::Result getElement(const CodecFactory& type, size_t elemen
     return type.getStaticElement(element_index, element);
 }
 
+/// For internal use only. @internal
+template <typename T>
+a_util::result::Result find_element_index(const T& decoder, const std::string& element_name, size_t& index)
+{
+    size_t element_count = getElementCount(decoder);
+    for (size_t element_index = 0; element_index < element_count; ++element_index)
+    {
+        const StructElement* element;
+        if (isOk(getElement(decoder, element_index, element)))
+        {
+            if (element->name == element_name)
+            {
+                index = element_index;
+                return a_util::result::SUCCESS;
+            }
+        }
+    }
+
+    return ERR_NOT_FOUND;
+}
+
+/// For internal use only. @internal
+template <>
+inline a_util::result::Result find_element_index(const CodecFactory& type, const std::string& element_name, size_t& index)
+{
+    return type.findStaticElementIndex(element_name, index);
+}
+
+/// For internal use only. @internal
+template <>
+inline a_util::result::Result find_element_index(const StaticDecoder& type, const std::string& element_name, size_t& index)
+{
+    return type.findElementIndex(element_name, index);
+}
+
+/// For internal use only. @internal
+template <>
+inline a_util::result::Result find_element_index(const StaticCodec& type, const std::string& element_name, size_t& index)
+{
+    return type.findElementIndex(element_name, index);
+}
+
+/// For internal use only. @internal
+template <>
+inline a_util::result::Result find_element_index(const Decoder& type, const std::string& element_name, size_t& index)
+{
+    return type.findElementIndex(element_name, index);
+}
+
+/// For internal use only. @internal
+template <>
+inline a_util::result::Result find_element_index(const Codec& type, const std::string& element_name, size_t& index)
+{
+    return type.findElementIndex(element_name, index);
+}
+
 /// For internal use only. @internal
 template <typename T>
 a_util::result::Result find_complex_index(const T& decoder, const std::string& struct_name,
@@ -108,21 +164,7 @@ a_util::result::Result find_complex_index(const T& decoder, const std::string& s
 template <typename T>
 a_util::result::Result find_index(const T& decoder, const std::string& element_name, size_t& index)
 {
-    size_t element_count = detail::getElementCount(decoder);
-    for (size_t element_index = 0; element_index < element_count; ++element_index)
-    {
-        const StructElement* element;
-        if (isOk(detail::getElement(decoder, element_index, element)))
-        {
-            if (element->name == element_name)
-            {
-                index = element_index;
-                return a_util::result::SUCCESS;
-            }
-        }
-    }
-
-    return ERR_NOT_FOUND;
+    return detail::find_element_index(decoder, element_name, index);
 }
 
 /**
@@ -477,6 +519,61 @@ a_util::result::Result get_array_value(const CODEC& decoder, const std::string&
     return a_util::result::SUCCESS;
 }
 
+/// For internal use only. @internal
+template <typename CODEC>
+a_util::result::Result find_array_range(const CODEC& decoder, const std::string& array_name,
+                                        size_t& start_index, size_t& count)
+{
+    a_util::result::Result res = find_array_index(decoder, array_name, start_index);
+    if (a_util::result::isFailed(res)) return res;
+
+    size_t end_index = start_index;
+    res = find_array_end_index(decoder, array_name, end_index);
+    if (a_util::result::isFailed(res)) return res;
+
+    count = end_index - start_index;
+    return a_util::result::SUCCESS;
+}
+
+/**
+ * Copy the values of an array out of the structure. In contrast to @ref get_array_value
+ * the values are converted to the deserialized representation, big endian arrays are
+ * swapped at once.
+ * @param[in] decoder The decoder.
+ * @param[in] array_name The name of the array.
+ * @param[out] array_values The location the values will be copied to.
+ * @retval ERR_NOT_FOUND No array with the requested name was found.
+ */
+template <typename T, typename CODEC>
+a_util::result::Result get_array_values(const CODEC& decoder, const std::string& array_name, T* array_values)
+{
+    size_t start_index = 0;
+    size_t count = 0;
+    a_util::result::Result res = find_array_range(decoder, array_name, start_index, count);
+    if (a_util::result::isFailed(res)) return res;
+
+    return decoder.getArrayValues(start_index, count, array_values);
+}
+
+/**
+ * Copy the values of an array into the structure, converted from the deserialized
+ * representation.
+ * @param[in] codec The codec.
+ * @param[in] array_name The name of the array.
+ * @param[in] array_values The location the values will be copied from.
+ * @retval ERR_NOT_FOUND No array with the requested name was found.
+ */
+template <typename T, typename CODEC>
+a_util::result::Result set_array_values(CODEC& codec, const std::string& array_name, const T* array_values)
+{
+    size_t start_index = 0;
+    size_t count = 0;
+    a_util::result::Result res = find_array_range(codec, array_name, start_index, count);
+    if (a_util::result::isFailed(res)) return res;
+
+    return codec.setArrayValues(start_index, count, array_values);
+}
+
 /**
  * Set the value of the requested element to zero.
  * @param[in] codec The codec.
@@ -21,6 +21,25 @@
 #include "a_util/memory.h"
 #include "bitserializer.h"
 
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define DDL_BITSERIALIZER_X86
+#include <emmintrin.h>
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// The kernels are compiled for their instruction set even if the whole build does not enable it
+// (e.g. i386 without -msse2), they are only called after the CPU support has been checked.
+#if defined(DDL_BITSERIALIZER_X86) && (defined(__GNUC__) || defined(__clang__))
+#define DDL_TARGET_SSE2 __attribute__((target("sse2")))
+#define DDL_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define DDL_TARGET_SSE2
+#define DDL_TARGET_AVX2
+#endif
+
 using namespace a_util;
 using namespace a_util::memory;
 
@@ -95,3 +114,202 @@ a_util::result::Result a_util::memory::detail::convertSignalEndianess(uint64_t *
 
     return a_util::result::SUCCESS;
 }
+
+namespace
+{
+
+template<typename T>
+void swapArrayScalar(uint8_t* destination, const uint8_t* source, size_t count)
+{
+    for (size_t index = 0; index < count; ++index)
+    {
+        T value;
+        a_util::memory::copy(&value, sizeof(T), source + index * sizeof(T), sizeof(T));
+        value = a_util::memory::swapEndianess(value);
+        a_util::memory::copy(destination + index * sizeof(T), sizeof(T), &value, sizeof(T));
+    }
+}
+
+void swapArrayScalar(uint8_t* destination, const uint8_t* source, size_t element_size, size_t count)
+{
+    switch (element_size)
+    {
+        case 2: swapArrayScalar<uint16_t>(destination, source, count); break;
+        case 4: swapArrayScalar<uint32_t>(destination, source, count); break;
+        default: swapArrayScalar<uint64_t>(destination, source, count); break;
+    }
+}
+
+#ifdef DDL_BITSERIALIZER_X86
+
+DDL_TARGET_SSE2
+inline __m128i swapVectorSSE2(__m128i value, size_t element_size)
+{
+    // SSE2 has no byte shuffle, so swap words within the element first and then the bytes
+    // within each word.
+    if (element_size == 4)
+    {
+        value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+        value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(2, 3, 0, 1));
+    }
+    else if (element_size == 8)
+    {
+        value = _mm_shufflelo_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+        value = _mm_shufflehi_epi16(value, _MM_SHUFFLE(0, 1, 2, 3));
+    }
+    return _mm_or_si128(_mm_slli_epi16(value, 8), _mm_srli_epi16(value, 8));
+}
+
+DDL_TARGET_SSE2
+void swapArraySSE2(uint8_t* destination, const uint8_t* source, size_t element_size, size_t count)
+{
+    const size_t bytes = element_size * count;
+    size_t offset = 0;
+    for (; offset + 16 <= bytes; offset += 16)
+    {
+        __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + offset));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + offset),
+                         swapVectorSSE2(value, element_size));
+    }
+    swapArrayScalar(destination + offset, source + offset, element_size, (bytes - offset) / element_size);
+}
+
+DDL_TARGET_AVX2
+void swapArrayAVX2(uint8_t* destination, const uint8_t* source, size_t element_size, size_t count)
+{
+    __m256i mask;
+    switch (element_size)
+    {
+        case 2:
+            mask = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+            break;
+        case 4:
+            mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+            break;
+        default:
+            mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8,
+                                    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+            break;
+    }
+
+    const size_t bytes = element_size * count;
+    size_t offset = 0;
+    for (; offset + 32 <= bytes; offset += 32)
+    {
+        __m256i value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(source + offset));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination + offset),
+                            _mm256_shuffle_epi8(value, mask));
+    }
+    swapArraySSE2(destination + offset, source + offset, element_size, (bytes - offset) / element_size);
+}
+
+bool cpuSupportsSSE2()
+{
+#if defined(__x86_64__) || defined(_M_X64)
+    // SSE2 is part of every x86-64 CPU
+    return true;
+#elif defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 1);
+    return (info[3] & (1 << 26)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse2") != 0;
+#endif
+}
+
+bool cpuSupportsAVX2()
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] < 7)
+    {
+        return false;
+    }
+    __cpuid(info, 1);
+    // OSXSAVE and AVX, the OS has to save the ymm registers as well
+    if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0 ||
+        (_xgetbv(0) & 0x6) != 0x6)
+    {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+
+#endif // DDL_BITSERIALIZER_X86
+
+} // namespace
+
+a_util::memory::detail::SwapKernel a_util::memory::detail::getSwapKernel()
+{
+    static const SwapKernel kernel = isSwapKernelSupported(swap_kernel_avx2) ? swap_kernel_avx2 :
+                                     isSwapKernelSupported(swap_kernel_sse2) ? swap_kernel_sse2 :
+                                                                               swap_kernel_scalar;
+    return kernel;
+}
+
+bool a_util::memory::detail::isSwapKernelSupported(SwapKernel kernel)
+{
+    switch (kernel)
+    {
+        case swap_kernel_scalar:
+            return true;
+#ifdef DDL_BITSERIALIZER_X86
+        case swap_kernel_sse2:
+        {
+            static const bool supported = cpuSupportsSSE2();
+            return supported;
+        }
+        case swap_kernel_avx2:
+        {
+            static const bool supported = cpuSupportsAVX2();
+            return supported;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+a_util::result::Result a_util::memory::detail::swapEndianessArray(void* destination, const void* source,
+                                                                  size_t element_size, size_t count,
+                                                                  SwapKernel kernel)
+{
+    if (!destination || !source)
+    {
+        return ERR_POINTER;
+    }
+
+    if ((element_size != 2 && element_size != 4 && element_size != 8) ||
+        !isSwapKernelSupported(kernel))
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    uint8_t* destination_bytes = static_cast<uint8_t*>(destination);
+    const uint8_t* source_bytes = static_cast<const uint8_t*>(source);
+    switch (kernel)
+    {
+#ifdef DDL_BITSERIALIZER_X86
+        case swap_kernel_avx2:
+            swapArrayAVX2(destination_bytes, source_bytes, element_size, count);
+            break;
+        case swap_kernel_sse2:
+            swapArraySSE2(destination_bytes, source_bytes, element_size, count);
+            break;
+#endif
+        default:
+            swapArrayScalar(destination_bytes, source_bytes, element_size, count);
+            break;
+    }
+
+    return a_util::result::SUCCESS;
+}
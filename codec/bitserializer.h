@@ -21,6 +21,7 @@
 #define A_UTILS_UTIL_MEMORY_BITSERIALIZER_INCLUDED
 
 #include <algorithm>
+#include <type_traits>
 
 #include "a_util/memory.h"
 #include "a_util/result.h"
@@ -73,6 +74,45 @@ std::string formatBits(uint64_t value);
 */
 a_util::result::Result convertSignalEndianess(uint64_t *signal, Endianess endianess, size_t bit_length);
 
+/// Enum describing the implementations available to swap the byte order of arrays
+typedef enum
+{
+    swap_kernel_scalar = 0,
+    swap_kernel_sse2 = 1,
+    swap_kernel_avx2 = 2
+} SwapKernel;
+
+/**
+* Returns the fastest byte swap implementation supported by the CPU at runtime.
+* @return See \ref SwapKernel
+*/
+SwapKernel getSwapKernel();
+
+/**
+* Checks whether the given byte swap implementation is supported by the CPU.
+*
+* @param [in] kernel The implementation to check.
+*
+* @return Returns true if the implementation can be used.
+*/
+bool isSwapKernelSupported(SwapKernel kernel);
+
+/**
+* Copies an array of 16, 32 or 64 bit values and swaps the byte order of each value.
+* Source and destination may be identical but must not overlap otherwise.
+*
+* @param [out] destination   Pointer to the destination array.
+* @param [in]  source        Pointer to the source array.
+* @param [in]  element_size  Size of a single value in bytes (2, 4 or 8).
+* @param [in]  count         Number of values to copy.
+* @param [in]  kernel        The implementation to use, see \ref getSwapKernel.
+*
+* @return Returns a standard result code.
+*/
+a_util::result::Result swapEndianessArray(void* destination, const void* source,
+                                          size_t element_size, size_t count,
+                                          SwapKernel kernel = getSwapKernel());
+
 /**
 * Converter Base
 * Contains the base methods used by all inheriting Converter classes.
@@ -693,6 +733,110 @@ public:
         return a_util::result::SUCCESS;
     }
 
+    /**
+    * Read an array of values from the bitfield. If the array starts at a byte boundary
+    * and each value occupies its full size, the whole array is copied at once and the
+    * byte order is swapped with vectorized instructions if required. Otherwise the
+    * values are read one by one.
+    *
+    * @param [in]  start_bit    Bit position of the first value.
+    * @param [in]  count        Number of values to read.
+    * @param [out] values       Pointer to the array to store the read values in.
+    * @param [in]  endianess   Parameter describing the endianess of the bitfield to read from.
+    *
+    * @return Returns a standard result code.
+    */
+    template<typename T>
+    a_util::result::Result readArray(size_t start_bit, size_t count, T* values,
+        Endianess endianess = get_platform_endianess())
+    {
+        if (count == 0)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result result_code = checkForInvalidArguments(start_bit, count * sizeof(T) * 8,
+                                                                      count * sizeof(T));
+        if (result_code != a_util::result::SUCCESS)
+        {
+            return result_code;
+        }
+
+        if (start_bit % 8 != 0 || std::is_same<T, bool>::value)
+        {
+            for (size_t index = 0; index < count; ++index)
+            {
+                result_code = read(start_bit + index * sizeof(T) * 8, sizeof(T) * 8,
+                                   values + index, endianess);
+                if (result_code != a_util::result::SUCCESS)
+                {
+                    return result_code;
+                }
+            }
+            return a_util::result::SUCCESS;
+        }
+
+        if (sizeof(T) == 1 || endianess == get_platform_endianess())
+        {
+            a_util::memory::copy(values, count * sizeof(T), _buffer + start_bit / 8, count * sizeof(T));
+            return a_util::result::SUCCESS;
+        }
+
+        return detail::swapEndianessArray(values, _buffer + start_bit / 8, sizeof(T), count);
+    }
+
+    /**
+    * Write an array of values to the bitfield. If the array starts at a byte boundary
+    * and each value occupies its full size, the whole array is copied at once and the
+    * byte order is swapped with vectorized instructions if required. Otherwise the
+    * values are written one by one.
+    *
+    * @param [in]  start_bit    Bit position of the first value.
+    * @param [in]  count        Number of values to write.
+    * @param [in]  values       Pointer to the array of values to write.
+    * @param [in]  endianess   Parameter describing the endianess of the bitfield to write to.
+    *
+    * @return Returns a standard result code.
+    */
+    template<typename T>
+    a_util::result::Result writeArray(size_t start_bit, size_t count, const T* values,
+        Endianess endianess = get_platform_endianess())
+    {
+        if (count == 0)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result result_code = checkForInvalidArguments(start_bit, count * sizeof(T) * 8,
+                                                                      count * sizeof(T));
+        if (result_code != a_util::result::SUCCESS)
+        {
+            return result_code;
+        }
+
+        if (start_bit % 8 != 0 || std::is_same<T, bool>::value)
+        {
+            for (size_t index = 0; index < count; ++index)
+            {
+                result_code = write(start_bit + index * sizeof(T) * 8, sizeof(T) * 8,
+                                    values[index], endianess);
+                if (result_code != a_util::result::SUCCESS)
+                {
+                    return result_code;
+                }
+            }
+            return a_util::result::SUCCESS;
+        }
+
+        if (sizeof(T) == 1 || endianess == get_platform_endianess())
+        {
+            a_util::memory::copy(_buffer + start_bit / 8, count * sizeof(T), values, count * sizeof(T));
+            return a_util::result::SUCCESS;
+        }
+
+        return detail::swapEndianessArray(_buffer + start_bit / 8, values, sizeof(T), count);
+    }
+
 private:
     /// internal buffer
     uint8_t *_buffer;
@@ -24,9 +24,9 @@
 #include "a_util/logging.h"
 #include "legacy_error_macros.h"
 #include "struct_layout.h"
+#include "dynamic_layout.h"
 #include "static_codec.h"
 #include "element_accessor.h"
-#include "access_element.h"
 
 namespace ddl
 {
@@ -34,6 +34,8 @@ namespace ddl
 //define all needed error types and values locally
 _MAKE_RESULT(-5, ERR_INVALID_ARG);
 _MAKE_RESULT(-10, ERR_INVALID_INDEX);
+_MAKE_RESULT(-19, ERR_NOT_SUPPORTED);
+_MAKE_RESULT(-20, ERR_NOT_FOUND);
 
 static inline void BitToBytes(size_t& size)
 {
@@ -50,7 +52,8 @@ static inline void BitToBytes(size_t& size)
 Decoder::Decoder(const Decoder& oDecoder, const void* pData, size_t nDataSize,
                    DataRepresentation eRep):
     StaticDecoder(oDecoder._layout, pData, nDataSize, eRep),
-    _dynamic_elements(oDecoder._dynamic_elements),
+    _dynamic_layout(oDecoder._dynamic_layout),
+    _dynamic_result(oDecoder._dynamic_result),
     _buffer_sizes(oDecoder._buffer_sizes)
 {
 }
@@ -76,6 +79,7 @@ Decoder::Decoder(a_util::memory::shared_ptr<const StructLayout> pLayout, const v
 a_util::result::Result Decoder::isValid() const
 {
     RETURN_IF_FAILED(_layout->isValid());
+    RETURN_IF_FAILED(_dynamic_result);
     if (_data_size < getBufferSize(getRepresentation()))
     {
         return ERR_INVALID_ARG;
@@ -86,151 +90,84 @@ a_util::result::Result Decoder::isValid() const
 
 a_util::result::Result Decoder::calculateDynamicElements()
 {
-    _dynamic_elements.reset(new std::vector<StructLayoutElement>());
-
-    for (std::vector<DynamicStructLayoutElement>::const_iterator
-        itDynamicElement = _layout->getDynamicElements().begin();
-         itDynamicElement != _layout->getDynamicElements().end(); ++ itDynamicElement)
+    // reuse the layout of previous data with the same array sizes if possible
+    DynamicLayoutCache& oCache = _layout->getDynamicLayoutCache();
+    _dynamic_layout = oCache.find(*_element_accessor, _data, _data_size);
+    if (_dynamic_layout &&
+        _dynamic_layout->getBitEnd(_element_accessor->getRepresentation()) > _data_size * 8)
     {
-        RETURN_IF_FAILED(addDynamicElements(*itDynamicElement, _buffer_sizes, ""));
+        // the data is too small, only keep the elements that are within the data
+        _dynamic_layout.reset();
     }
 
-    return a_util::result::SUCCESS;
-}
-
-void Decoder::moveToAlignment(size_t& bit_offset, size_t alignment)
-{
-    size_t nBitRest = bit_offset % 8;
-    if (nBitRest)
+    _dynamic_result = a_util::result::SUCCESS;
+    if (!_dynamic_layout)
     {
-        bit_offset += 8 - nBitRest;
+        _dynamic_result = DynamicLayout::create(*_layout, *_element_accessor, _data, _data_size,
+                                                _dynamic_layout);
+        if (_dynamic_layout->isReusable())
+        {
+            oCache.insert(_dynamic_layout);
+        }
     }
 
-    size_t nByteOffset = bit_offset / 8;
-    size_t nRest = nByteOffset % alignment;
-    if (nRest)
-    {
-        bit_offset += (alignment - nRest) * 8;
-    }
+    _buffer_sizes = _dynamic_layout->getBufferBitSizes();
+    return _dynamic_result;
 }
 
-a_util::result::Result Decoder::addDynamicElements(const DynamicStructLayoutElement& sDynamicElement,
-                                     Offsets& sOverallOffsets,
-                                     const std::string& strPrefix)
+a_util::result::Result Decoder::rebind(const void* pData, size_t nDataSize)
 {
-    moveToAlignment(sOverallOffsets.deserialized, sDynamicElement.alignment);
-
-    if (sDynamicElement.isAlignmentElement())
+    RETURN_IF_FAILED(StaticDecoder::rebind(pData, nDataSize));
+    if (!_layout->hasDynamicElements())
     {
         return a_util::result::SUCCESS;
     }
 
-    a_util::variant::Variant oArraySize((uint64_t)1);
-    bool bIsArray = sDynamicElement.isDynamicArray();
-    if (bIsArray)
-    {
-        oArraySize = access_element::get_value(*this,
-                                               strPrefix + sDynamicElement.size_element_name);
-    }
-    size_t nArraySize = static_cast<size_t>(oArraySize.asUInt64());
-
-    for (size_t nArrayIndex = 0; nArrayIndex < nArraySize; ++nArrayIndex)
+    if (_dynamic_layout && _dynamic_layout->matches(*_element_accessor, _data, _data_size) &&
+        _dynamic_layout->getBitEnd(_element_accessor->getRepresentation()) <= _data_size * 8)
     {
-        RETURN_IF_FAILED(addDynamicElement(sDynamicElement,
-                                           bIsArray ? a_util::strings::format("[%d]", nArrayIndex) : "",
-                                           sOverallOffsets, strPrefix));
+        _dynamic_result = a_util::result::SUCCESS;
+        return a_util::result::SUCCESS;
     }
 
-    moveToAlignment(sOverallOffsets.deserialized, sDynamicElement.alignment);
-
-    return a_util::result::SUCCESS;
-}
-
-a_util::result::Result Decoder::addDynamicElement(const DynamicStructLayoutElement& sDynamicElement,
-                                    const std::string& strArrayIndex,
-                                    Offsets& sOverallOffsets,
-                                    const std::string& strPrefix)
-{
-    RETURN_IF_FAILED(addStaticStructElements(sDynamicElement, strArrayIndex, sOverallOffsets, strPrefix));
-    RETURN_IF_FAILED(addDynamicStructElements(sDynamicElement, strArrayIndex, sOverallOffsets, strPrefix));
-
-    return a_util::result::SUCCESS;
+    _buffer_sizes = _layout->getStaticBufferBitSizes();
+    a_util::result::Result oResult = calculateDynamicElements();
+    BitToBytes(_buffer_sizes.deserialized);
+    BitToBytes(_buffer_sizes.serialized);
+    return oResult;
 }
 
-a_util::result::Result Decoder::addStaticStructElements(const DynamicStructLayoutElement& sDynamicElement,
-                                          const std::string& strArrayIndex,
-                                          Offsets& nOverallBitOffset,
-                                          const std::string& strPrefix)
+size_t Decoder::getElementCount() const
 {
-    Offsets sStartOffsets = nOverallBitOffset;
-    for (std::vector<StructLayoutElement>::const_iterator itStaticElement = sDynamicElement.static_elements.begin();
-         itStaticElement != sDynamicElement.static_elements.end(); ++itStaticElement)
+    if (_dynamic_layout)
     {
-        StructLayoutElement sElement = *itStaticElement;
-        sElement.deserialized.bit_offset += sStartOffsets.deserialized;
-        sElement.serialized.bit_offset += sStartOffsets.serialized;
-        nOverallBitOffset.deserialized = sElement.deserialized.bit_offset + sElement.deserialized.bit_size;
-        nOverallBitOffset.serialized = sElement.serialized.bit_offset + sElement.serialized.bit_size;
-        if (!sElement.name.empty())
-        {
-            sElement.name = a_util::strings::format("%s%s%s.%s", strPrefix.c_str(),
-                                                           sDynamicElement.name.c_str(),
-                                                           strArrayIndex.c_str(),
-                                                           itStaticElement->name.c_str());
-        }
-        else
-        {
-            // not part of a struct, just a plain array element
-            sElement.name = a_util::strings::format("%s%s%s", strPrefix.c_str(),
-                                                           sDynamicElement.name.c_str(),
-                                                           strArrayIndex.c_str());
-        }
-        RETURN_IF_FAILED(addDynamicStructElement(sElement));
+        return _layout->getStaticElements().size() + _dynamic_layout->getElements().size();
     }
 
-    return a_util::result::SUCCESS;
+    return _layout->getStaticElements().size();
 }
 
-a_util::result::Result Decoder::addDynamicStructElements(const DynamicStructLayoutElement& sDynamicElement,
-                                           const std::string& strArrayIndex,
-                                           Offsets& sOverallOffsets,
-                                           const std::string& strPrefix)
+a_util::result::Result Decoder::findElementIndex(const std::string& strName, size_t& nIndex) const
 {
-    std::string strChildPrefix = a_util::strings::format("%s%s%s.", strPrefix.c_str(),
-                                                                     sDynamicElement.name.c_str(),
-                                                                     strArrayIndex.c_str());
-    for (std::vector<DynamicStructLayoutElement>::const_iterator
-        itDynamicChildElement = sDynamicElement.dynamic_elements.begin();
-         itDynamicChildElement != sDynamicElement.dynamic_elements.end();
-         ++itDynamicChildElement)
+    if (isOk(StaticDecoder::findElementIndex(strName, nIndex)))
     {
-        RETURN_IF_FAILED(addDynamicElements(*itDynamicChildElement, sOverallOffsets, strChildPrefix));
+        return a_util::result::SUCCESS;
     }
 
-    return a_util::result::SUCCESS;
-}
-
-a_util::result::Result Decoder::addDynamicStructElement(const StructLayoutElement& sElement)
-{
-    const Position& sPos = _element_accessor->getRepresentation() == deserialized ?
-                                sElement.deserialized : sElement.serialized;
-    if (sPos.bit_offset + sPos.bit_size > _data_size * 8)
+    if (!_dynamic_layout)
     {
-        return ERR_INVALID_ARG;
+        return ERR_NOT_FOUND;
     }
 
-    _dynamic_elements->push_back(sElement);
-    return a_util::result::SUCCESS;
-}
-
-size_t Decoder::getElementCount() const
-{
-    if (_dynamic_elements)
+    const ElementNameIndex& oIndex = _dynamic_layout->getElementIndex(*_layout);
+    ElementNameIndex::const_iterator itElement = oIndex.find(strName);
+    if (itElement == oIndex.end())
     {
-        return _layout->getStaticElements().size() + _dynamic_elements->size();
+        return ERR_NOT_FOUND;
     }
 
-    return _layout->getStaticElements().size();
+    nIndex = itElement->second;
+    return a_util::result::SUCCESS;
 }
 
 size_t Decoder::getBufferSize(DataRepresentation eRep) const
@@ -253,15 +190,37 @@ const StructLayoutElement* Decoder::getLayoutElement(size_t nIndex) const
     {
         pElement = &_layout->getStaticElements()[nIndex];
     }
-    else if (_dynamic_elements &&
-             nIndex - nStaticElementCount < _dynamic_elements->size())
+    else if (_dynamic_layout &&
+             nIndex - nStaticElementCount < _dynamic_layout->getElements().size())
     {
-        pElement = &(*_dynamic_elements)[nIndex - nStaticElementCount];
+        pElement = &_dynamic_layout->getElements()[nIndex - nStaticElementCount];
     }
 
     return pElement;
 }
 
+const DynamicLayout* Decoder::getDynamicLayout() const
+{
+    return _dynamic_layout.get();
+}
+
+const StructLayoutElement* Decoder::getNamedLayoutElement(size_t nIndex) const
+{
+    size_t nStaticElementCount = _layout->getStaticElements().size();
+    if (nIndex < nStaticElementCount || !_dynamic_layout)
+    {
+        return getLayoutElement(nIndex);
+    }
+
+    const std::vector<StructLayoutElement>& vecElements = _dynamic_layout->getNamedElements(*_layout);
+    if (nIndex - nStaticElementCount < vecElements.size())
+    {
+        return &vecElements[nIndex - nStaticElementCount];
+    }
+
+    return NULL;
+}
+
 Codec::Codec(a_util::memory::shared_ptr<const StructLayout> pLayout, void* pData, size_t nDataSize,
                DataRepresentation eRep):
     Decoder(pLayout, pData, nDataSize, eRep)
@@ -297,6 +256,11 @@ a_util::result::Result Codec::setElementValue(size_t nIndex, const a_util::varia
                                         _data_size, oValue);
 }
 
+a_util::result::Result Codec::setArrayValues(size_t nIndex, size_t nCount, const void* pValues)
+{
+    return writeArrayValues(const_cast<void*>(_data), nIndex, nCount, pValues);
+}
+
 void* Codec::getElementAddress(size_t nIndex)
 {
     return const_cast<void*>(StaticDecoder::getElementAddress(nIndex));
@@ -321,4 +285,14 @@ a_util::result::Result Codec::setConstants()
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result Codec::rebind(void* pData, size_t nDataSize)
+{
+    return Decoder::rebind(pData, nDataSize);
+}
+
+a_util::result::Result Codec::rebind(const void* /*pData*/, size_t /*nDataSize*/)
+{
+    return ERR_NOT_SUPPORTED;
+}
+
 }
@@ -29,6 +29,7 @@ namespace ddl
 {
 
 class Codec;
+class DynamicLayout;
 
 /**
  * Decoder for dynamic structures defined by a DDL definition.
@@ -46,6 +47,11 @@ class Decoder: public StaticDecoder
          */
         virtual size_t getElementCount() const;
 
+        /**
+         * @copydoc StaticDecoder::findElementIndex
+         */
+        virtual a_util::result::Result findElementIndex(const std::string& name, size_t& index) const;
+
         /**
          * @param[in] rep The data representation for which the buffer size should be returned.
          * @return The size of the structure in the requested data representation.
@@ -61,6 +67,17 @@ class Decoder: public StaticDecoder
          */
         Codec makeCodecFor(void* data, size_t data_size, DataRepresentation rep) const;
 
+        /**
+         * Binds the decoder to new data with the same representation. The dynamic structure
+         * layout is only recalculated if the values of the array size elements have changed.
+         * @param[in] data The pointer to the new raw data.
+         * @param[in] data_size The size of the new raw data.
+         * @retval ERR_INVALID_ARG The data is not large enough for the dynamic elements.
+         * @retval ERR_OUT_OF_RANGE The data contains an array size that exceeds the data.
+         * @retval ERR_NOT_SUPPORTED The decoder is a codec, those can not be bound to read-only data.
+         */
+        virtual a_util::result::Result rebind(const void* data, size_t data_size);
+
     protected:
         friend class CodecFactory;
         /// For internal use only. @internal
@@ -71,37 +88,20 @@ class Decoder: public StaticDecoder
                 DataRepresentation rep);
         /// For internal use only. @internal
         virtual const StructLayoutElement* getLayoutElement(size_t index) const;
+        /// For internal use only. @internal
+        virtual const StructLayoutElement* getNamedLayoutElement(size_t index) const;
+        /// For internal use only. @internal
+        virtual const DynamicLayout* getDynamicLayout() const;
 
     private:
         /// For internal use only. @internal
         a_util::result::Result calculateDynamicElements();
-        /// For internal use only. @internal
-        a_util::result::Result addDynamicElements(const DynamicStructLayoutElement& dynamic_element,
-                                   Offsets& overall_offsets,
-                                   const std::string& prefix);
-        /// For internal use only. @internal
-        a_util::result::Result addDynamicElement(const DynamicStructLayoutElement& dynamic_element,
-                                  const std::string& array_index,
-                                  Offsets& overall_offsets,
-                                  const std::string& prefix);
-        /// For internal use only. @internal
-        a_util::result::Result addStaticStructElements(const DynamicStructLayoutElement& dynamic_element,
-                                        const std::string& array_index,
-                                        Offsets& overall_offsets,
-                                        const std::string& prefix);
-        /// For internal use only. @internal
-        a_util::result::Result addDynamicStructElements(const DynamicStructLayoutElement& dynamic_element,
-                                         const std::string& array_index,
-                                         Offsets& overall_offsets,
-                                         const std::string& prefix);
-        /// For internal use only. @internal
-        a_util::result::Result addDynamicStructElement(const StructLayoutElement& element);
-        /// For internal use only. @internal
-        void moveToAlignment(size_t& bit_offset, size_t alignment);
 
     protected:
-        /// For internal use only. @internal
-        a_util::memory::shared_ptr<std::vector<StructLayoutElement> > _dynamic_elements;
+        /// For internal use only. @internal Shared between all decoders with the same array sizes.
+        a_util::memory::shared_ptr<const DynamicLayout> _dynamic_layout;
+        /// For internal use only. @internal The result of the calculation of the dynamic elements.
+        a_util::result::Result _dynamic_result;
         /// For internal use only. @internal
         Offsets _buffer_sizes;
 };
@@ -131,6 +131,20 @@ class Codec: public Decoder
          */
         a_util::result::Result setElementValue(size_t index, const a_util::variant::Variant& value);
 
+        /**
+         * @copydoc StaticCodec::setArrayValues
+         */
+        a_util::result::Result setArrayValues(size_t index, size_t count, const void* values);
+
+        /**
+         * @copydoc StaticCodec::setValue
+         */
+        template <typename T>
+        void setValue(const ElementHandle<T>& handle, typename ElementHandle<T>::value_type value)
+        {
+            handle.write(const_cast<void*>(_data), _data_size, _representation, value);
+        }
+
         /**
          * @param[in] index The index of the element.
          * @return A pointer to the element or NULL in case of an error.
@@ -144,6 +158,16 @@ class Codec: public Decoder
          */
         a_util::result::Result setConstants();
 
+        /**
+         * Binds the codec to new data with the same representation.
+         * @copydetails Decoder::rebind
+         */
+        a_util::result::Result rebind(void* data, size_t data_size);
+
+    private:
+        /// A codec can not be bound to read-only data, fails when called through a decoder.
+        virtual a_util::result::Result rebind(const void* data, size_t data_size);
+
     protected:
         friend class CodecFactory;
         friend class Decoder;
@@ -19,6 +19,7 @@
  */
 
 #include "struct_layout.h"
+#include "layout_cache.h"
 #include "codec_factory.h"
 
 #include "ddlrepresentation/ddl_error.h"
@@ -29,6 +30,7 @@
 namespace ddl
 {
 //define all needed error types and values locally
+_MAKE_RESULT(-4, ERR_POINTER);
 _MAKE_RESULT(-10, ERR_INVALID_INDEX);
 _MAKE_RESULT(-20, ERR_NOT_FOUND);
 _MAKE_RESULT(-37, ERR_NOT_INITIALIZED);
@@ -59,6 +61,21 @@ CodecFactory::CodecFactory():
 
 CodecFactory::CodecFactory(const char* strStructName, const char* strMediaDescription)
 {
+    if (!strStructName || !strMediaDescription)
+    {
+        _layout.reset(new StructLayout());
+        _constructor_result = ERR_POINTER;
+        return;
+    }
+
+    LayoutCache& oCache = LayoutCache::getInstance();
+    _layout = oCache.find(strStructName, strMediaDescription);
+    if (_layout)
+    {
+        _constructor_result = a_util::result::SUCCESS;
+        return;
+    }
+
     a_util::memory::unique_ptr<DDLDescription> pDDL;
     _constructor_result = getDDL(strMediaDescription, pDDL);
     if(isOk(_constructor_result))
@@ -68,6 +85,10 @@ CodecFactory::CodecFactory(const char* strStructName, const char* strMediaDescri
         {
             _layout.reset(new StructLayout(pStruct));
             _constructor_result = _layout->isValid();
+            if (isOk(_constructor_result))
+            {
+                oCache.insert(strStructName, strMediaDescription, _layout);
+            }
         }
         else
         {
@@ -87,6 +108,13 @@ CodecFactory::CodecFactory(const DDLComplex* pStruct):
     _constructor_result = _layout->isValid();
 }
 
+CodecFactory::CodecFactory(const a_util::memory::shared_ptr<const StructLayout>& pLayout,
+                           a_util::result::Result nConstructorResult):
+    _layout(pLayout),
+    _constructor_result(nConstructorResult)
+{
+}
+
 a_util::result::Result CodecFactory::isValid() const
 {
     return _constructor_result;
@@ -108,10 +136,53 @@ a_util::result::Result CodecFactory::getStaticElement(size_t nIndex, const Struc
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result CodecFactory::findStaticElementIndex(const std::string& strName, size_t& nIndex) const
+{
+    const ElementNameIndex& oIndex = _layout->getStaticElementIndex();
+    ElementNameIndex::const_iterator itElement = oIndex.find(strName);
+    if (itElement == oIndex.end())
+    {
+        return ERR_NOT_FOUND;
+    }
+
+    nIndex = itElement->second;
+    return a_util::result::SUCCESS;
+}
+
+const StructLayoutElement* CodecFactory::getStaticLayoutElement(size_t nIndex) const
+{
+    return &_layout->getStaticElements()[nIndex];
+}
+
 size_t CodecFactory::getStaticBufferSize(DataRepresentation eRep) const
 {
     return _layout->getStaticBufferSize(eRep);
 }
 
+bool CodecFactory::hasDynamicElements() const
+{
+    return _layout->hasDynamicElements();
+}
+
+void CodecFactory::clearLayoutCache()
+{
+    LayoutCache::getInstance().clear();
+}
+
+size_t CodecFactory::getLayoutCacheSize()
+{
+    return LayoutCache::getInstance().getSize();
+}
+
+void CodecFactory::setLayoutCacheCapacity(size_t nCapacity)
+{
+    LayoutCache::getInstance().setCapacity(nCapacity);
+}
+
+size_t CodecFactory::getLayoutCacheCapacity()
+{
+    return LayoutCache::getInstance().getCapacity();
+}
+
 
 }
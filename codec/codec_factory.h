@@ -26,6 +26,7 @@
 #include "ddlrepresentation/ddlcomplex.h"
 #include "struct_element.h"
 #include "static_codec.h"
+#include "element_handle.h"
 
 
 
@@ -46,6 +47,8 @@ class CodecFactory
 
         /**
          * Constructor that take a DDL string for initialization.
+         * The struct layouts are cached process wide, so creating further factories for the
+         * same struct name and DDL description does not parse the description again.
          * @param[in] struct_name The name of the struct for which codecs should be generated.
          * @param[in] media_description The DDL description.
          */
@@ -129,13 +132,84 @@ class CodecFactory
          */
         a_util::result::Result getStaticElement(size_t index, const StructElement*& element) const;
 
+        /**
+         * Find the index of a static element by name.
+         * @param[in] name The full name of the element.
+         * @param[out] index The index of the element.
+         * @retval ERR_NOT_FOUND No element with the requested name was found.
+         */
+        a_util::result::Result findStaticElementIndex(const std::string& name, size_t& index) const;
+
+        /**
+         * Resolves a static element into a handle that allows name-free access with
+         * StaticDecoder::getValue and StaticCodec::setValue.
+         * @param[in] name The full name of the element.
+         * @return The handle, which is invalid if no element with the requested name and
+         *         a type matching T was found.
+         */
+        template <typename T>
+        ElementHandle<T> resolve(const std::string& name) const
+        {
+            size_t index = 0;
+            if (isOk(findStaticElementIndex(name, index)))
+            {
+                const StructLayoutElement* element = getStaticLayoutElement(index);
+                if (element->type == detail::VariantTypeOf<T>::value)
+                {
+                    return ElementHandle<T>(index, *element);
+                }
+            }
+
+            return ElementHandle<T>();
+        }
+
         /**
          * @param[in] rep The data representation for which the buffer size should be returned.
          * @return The size of the structure in the requested data representation.
          */
         size_t getStaticBufferSize(DataRepresentation rep = deserialized) const;
 
-    private:        
+        /**
+         * @return Whether or not the layout of the structure depends on dynamic array sizes.
+         */
+        bool hasDynamicElements() const;
+
+        /**
+         * Removes all struct layouts from the process wide cache that is used by
+         * @ref CodecFactory(const char*, const char*). Existing factories, decoders and codecs
+         * stay valid.
+         */
+        static void clearLayoutCache();
+
+        /**
+         * @return The amount of struct layouts in the process wide cache.
+         */
+        static size_t getLayoutCacheSize();
+
+        /**
+         * Sets the maximum amount of struct layouts in the process wide cache. If the cache is
+         * full, the least recently used layout is removed. Each distinct media description is
+         * kept once as long as a cached layout refers to it. The default capacity is 256,
+         * 0 disables the cache. Existing factories, decoders and codecs stay valid.
+         * @param[in] capacity The maximum amount of layouts.
+         */
+        static void setLayoutCacheCapacity(size_t capacity);
+
+        /**
+         * @return The maximum amount of struct layouts in the process wide cache.
+         */
+        static size_t getLayoutCacheCapacity();
+
+    private:
+        friend class ColumnExtractor;
+        friend class PrecompiledLayouts;
+        /// For internal use only. @internal
+        CodecFactory(const a_util::memory::shared_ptr<const StructLayout>& layout,
+                     a_util::result::Result constructor_result);
+        /// For internal use only. @internal
+        const StructLayoutElement* getStaticLayoutElement(size_t index) const;
+
+    private:
         /// For internal use only.  @internal The struct layout.
         a_util::memory::shared_ptr<const StructLayout> _layout;
         /// For internal use only. @internal The constructor result.
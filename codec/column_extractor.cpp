@@ -0,0 +1,269 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#include "column_extractor.h"
+
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
+#include "codec_factory.h"
+#include "bitserializer.h"
+
+namespace ddl
+{
+
+//define all needed error types and values locally
+_MAKE_RESULT(-4, ERR_POINTER);
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+_MAKE_RESULT(-19, ERR_NOT_SUPPORTED);
+_MAKE_RESULT(-37, ERR_NOT_INITIALIZED);
+
+namespace
+{
+
+/// Access to samples stored at arbitrary locations.
+struct ScatteredSamples
+{
+    const void* const* samples;
+
+    const uint8_t* operator[](size_t nSample) const
+    {
+        return static_cast<const uint8_t*>(samples[nSample]);
+    }
+};
+
+/// Access to samples stored one after another.
+struct ContiguousSamples
+{
+    const uint8_t* first_sample;
+    size_t sample_size;
+
+    const uint8_t* operator[](size_t nSample) const
+    {
+        return first_sample + nSample * sample_size;
+    }
+};
+
+template <typename T, typename SAMPLES>
+void extractPlain(size_t nByteOffset, const SAMPLES& oSamples, size_t nSampleCount, T* pColumn)
+{
+    // a fixed size copy per sample, which the compiler turns into a plain load and store
+    for (size_t nSample = 0; nSample < nSampleCount; ++nSample)
+    {
+        a_util::memory::copy(pColumn + nSample, sizeof(T), oSamples[nSample] + nByteOffset, sizeof(T));
+    }
+}
+
+template <typename T, typename SAMPLES>
+a_util::result::Result extractColumn(const Position& sPosition, int nByteOrder, bool bIsPlain, bool bNeedsSwap,
+                                     const SAMPLES& oSamples, size_t nSampleCount, size_t nSampleSize,
+                                     void* pColumn)
+{
+    T* pValues = static_cast<T*>(pColumn);
+    if (bIsPlain)
+    {
+        extractPlain(sPosition.bit_offset / 8, oSamples, nSampleCount, pValues);
+        if (bNeedsSwap)
+        {
+            return a_util::memory::detail::swapEndianessArray(pValues, pValues, sizeof(T), nSampleCount);
+        }
+        return a_util::result::SUCCESS;
+    }
+
+    for (size_t nSample = 0; nSample < nSampleCount; ++nSample)
+    {
+        pValues[nSample] = T();
+        a_util::memory::BitSerializer oSerializer(const_cast<uint8_t*>(oSamples[nSample]), nSampleSize);
+        RETURN_IF_FAILED(oSerializer.read(sPosition.bit_offset, sPosition.bit_size, pValues + nSample,
+                                          static_cast<a_util::memory::Endianess>(nByteOrder)));
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+}
+
+ColumnExtractor::ColumnExtractor():
+    _minimum_sample_size(0),
+    _representation(deserialized)
+{
+}
+
+a_util::result::Result ColumnExtractor::create(const CodecFactory& oFactory,
+                                               const std::vector<std::string>& vecElementNames,
+                                               DataRepresentation eRep)
+{
+    _columns.clear();
+    _minimum_sample_size = 0;
+    _representation = eRep;
+    if (isFailed(oFactory.isValid()))
+    {
+        return ERR_NOT_INITIALIZED;
+    }
+
+    for (std::vector<std::string>::const_iterator itName = vecElementNames.begin();
+         itName != vecElementNames.end(); ++itName)
+    {
+        size_t nIndex = 0;
+        RETURN_IF_FAILED(oFactory.findStaticElementIndex(*itName, nIndex));
+        const StructLayoutElement* pElement = oFactory.getStaticLayoutElement(nIndex);
+
+        Column sColumn;
+        sColumn.type = pElement->type;
+        sColumn.position = eRep == deserialized ? pElement->deserialized : pElement->serialized;
+        sColumn.byte_order = pElement->byte_order;
+        sColumn.is_plain = eRep == deserialized ||
+                           (sColumn.position.bit_offset % 8 == 0 &&
+                            sColumn.position.bit_size == pElement->deserialized.bit_size);
+        sColumn.needs_swap = eRep == serialized && sColumn.is_plain &&
+                             sColumn.position.bit_size > 8 &&
+                             sColumn.byte_order != a_util::memory::get_platform_endianess();
+        _columns.push_back(sColumn);
+
+        _minimum_sample_size = std::max(_minimum_sample_size,
+            (sColumn.position.bit_offset + sColumn.position.bit_size + 7) / 8);
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+size_t ColumnExtractor::getColumnCount() const
+{
+    return _columns.size();
+}
+
+a_util::variant::VariantType ColumnExtractor::getColumnType(size_t nColumn) const
+{
+    return _columns[nColumn].type;
+}
+
+size_t ColumnExtractor::getColumnValueSize(size_t nColumn) const
+{
+    switch (_columns[nColumn].type)
+    {
+        case a_util::variant::VT_Bool: return sizeof(bool);
+        case a_util::variant::VT_Int8: return sizeof(int8_t);
+        case a_util::variant::VT_UInt8: return sizeof(uint8_t);
+        case a_util::variant::VT_Int16: return sizeof(int16_t);
+        case a_util::variant::VT_UInt16: return sizeof(uint16_t);
+        case a_util::variant::VT_Int32: return sizeof(int32_t);
+        case a_util::variant::VT_UInt32: return sizeof(uint32_t);
+        case a_util::variant::VT_Int64: return sizeof(int64_t);
+        case a_util::variant::VT_UInt64: return sizeof(uint64_t);
+        case a_util::variant::VT_Float32: return sizeof(float);
+        case a_util::variant::VT_Float64: return sizeof(double);
+        default: return 0;
+    }
+}
+
+size_t ColumnExtractor::getMinimumSampleSize() const
+{
+    return _minimum_sample_size;
+}
+
+#define EXTRACT_CASE_TYPE(__variant_type, __data_type) \
+    case a_util::variant::__variant_type: \
+        RETURN_IF_FAILED(extractColumn<__data_type>(itColumn->position, itColumn->byte_order, \
+                                                    itColumn->is_plain, itColumn->needs_swap, \
+                                                    oSamples, nSampleCount, nSampleSize, *pColumn)); \
+        break;
+
+template <typename SAMPLES>
+a_util::result::Result ColumnExtractor::extractColumns(const SAMPLES& oSamples, size_t nSampleCount,
+                                                       size_t nSampleSize, void* const* pColumns) const
+{
+    if (nSampleSize < _minimum_sample_size)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    // one column after the other, so that each inner loop only touches one output array
+    void* const* pColumn = pColumns;
+    for (std::vector<Column>::const_iterator itColumn = _columns.begin();
+         itColumn != _columns.end(); ++itColumn, ++pColumn)
+    {
+        if (!*pColumn)
+        {
+            return ERR_POINTER;
+        }
+
+        switch (itColumn->type)
+        {
+            EXTRACT_CASE_TYPE(VT_Bool, bool)
+            EXTRACT_CASE_TYPE(VT_Int8, int8_t)
+            EXTRACT_CASE_TYPE(VT_UInt8, uint8_t)
+            EXTRACT_CASE_TYPE(VT_Int16, int16_t)
+            EXTRACT_CASE_TYPE(VT_UInt16, uint16_t)
+            EXTRACT_CASE_TYPE(VT_Int32, int32_t)
+            EXTRACT_CASE_TYPE(VT_UInt32, uint32_t)
+            EXTRACT_CASE_TYPE(VT_Int64, int64_t)
+            EXTRACT_CASE_TYPE(VT_UInt64, uint64_t)
+            EXTRACT_CASE_TYPE(VT_Float32, float)
+            EXTRACT_CASE_TYPE(VT_Float64, double)
+            default: return ERR_NOT_SUPPORTED;
+        }
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result ColumnExtractor::extract(const void* const* pSamples, size_t nSampleCount,
+                                                size_t nSampleSize, void* const* pColumns) const
+{
+    if (nSampleCount == 0)
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    if (!pSamples || !pColumns)
+    {
+        return ERR_POINTER;
+    }
+
+    for (size_t nSample = 0; nSample < nSampleCount; ++nSample)
+    {
+        if (!pSamples[nSample])
+        {
+            return ERR_POINTER;
+        }
+    }
+
+    ScatteredSamples oSamples = { pSamples };
+    return extractColumns(oSamples, nSampleCount, nSampleSize, pColumns);
+}
+
+a_util::result::Result ColumnExtractor::extractContiguous(const void* pSamples, size_t nSampleCount,
+                                                          size_t nSampleSize, void* const* pColumns) const
+{
+    if (nSampleCount == 0)
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    if (!pSamples || !pColumns)
+    {
+        return ERR_POINTER;
+    }
+
+    ContiguousSamples oSamples = { static_cast<const uint8_t*>(pSamples), nSampleSize };
+    return extractColumns(oSamples, nSampleCount, nSampleSize, pColumns);
+}
+
+}
@@ -0,0 +1,144 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#ifndef DDL_COLUMN_EXTRACTOR_CLASS_HEADER
+#define DDL_COLUMN_EXTRACTOR_CLASS_HEADER
+
+#include <string>
+#include <vector>
+
+#include "a_util/result.h"
+
+#include "struct_element.h"
+
+namespace ddl
+{
+
+class CodecFactory;
+
+/**
+ * Extracts a set of elements from many samples of the same structure at once.
+ * The values of each element are written into a contiguous array (column) of the element
+ * type, i.e. the samples are converted into a struct of arrays.
+ * No decoders or variants are created per sample.
+ * Only static elements are supported.
+ */
+class ColumnExtractor
+{
+    public:
+        /**
+         * Constructor that creates an empty extractor.
+         */
+        ColumnExtractor();
+
+        /**
+         * Prepares the extraction of the given elements.
+         * @param[in] factory The factory of the structure.
+         * @param[in] element_names The full names of the elements, one column per element.
+         * @param[in] rep The representation of the samples.
+         * @retval ERR_NOT_FOUND One of the elements does not exist.
+         * @retval ERR_NOT_INITIALIZED The factory is not valid.
+         */
+        a_util::result::Result create(const CodecFactory& factory,
+                                      const std::vector<std::string>& element_names,
+                                      DataRepresentation rep);
+
+        /**
+         * @return The amount of columns.
+         */
+        size_t getColumnCount() const;
+
+        /**
+         * @param[in] column The index of the column.
+         * @return The type of the values in the column.
+         */
+        a_util::variant::VariantType getColumnType(size_t column) const;
+
+        /**
+         * @param[in] column The index of the column.
+         * @return The size of a single value in the column in bytes.
+         */
+        size_t getColumnValueSize(size_t column) const;
+
+        /**
+         * @return The minimum size of a sample that is required to extract all columns.
+         */
+        size_t getMinimumSampleSize() const;
+
+        /**
+         * Extracts the columns from samples that are stored at arbitrary locations.
+         * @param[in] samples Array of pointers to the samples.
+         * @param[in] sample_count The amount of samples.
+         * @param[in] sample_size The size of each of the samples.
+         * @param[out] columns Array with one output array per column, each output array has to
+         *                     provide space for sample_count values of the column type.
+         * @retval ERR_INVALID_ARG The samples are too small.
+         * @retval ERR_POINTER One of the pointers is NULL.
+         */
+        a_util::result::Result extract(const void* const* samples, size_t sample_count,
+                                       size_t sample_size, void* const* columns) const;
+
+        /**
+         * Extracts the columns from samples that are stored one after another.
+         * @param[in] samples Pointer to the first sample.
+         * @param[in] sample_count The amount of samples.
+         * @param[in] sample_size The size of each of the samples, which is also the distance
+         *                        between two samples.
+         * @param[out] columns Array with one output array per column, each output array has to
+         *                     provide space for sample_count values of the column type.
+         * @retval ERR_INVALID_ARG The samples are too small.
+         * @retval ERR_POINTER One of the pointers is NULL.
+         */
+        a_util::result::Result extractContiguous(const void* samples, size_t sample_count,
+                                                 size_t sample_size, void* const* columns) const;
+
+    private:
+        /// For internal use only. @internal
+        struct Column
+        {
+            /// The type of the element.
+            a_util::variant::VariantType type;
+            /// The position of the element in the chosen representation.
+            Position position;
+            /// The byte order of the element.
+            int byte_order;
+            /// Whether the element is byte aligned and occupies its full size.
+            bool is_plain;
+            /// Whether the byte order of a plain element has to be swapped.
+            bool needs_swap;
+        };
+
+        /// For internal use only. @internal
+        template <typename SAMPLES>
+        a_util::result::Result extractColumns(const SAMPLES& samples, size_t sample_count,
+                                              size_t sample_size, void* const* columns) const;
+
+    private:
+        /// For internal use only. @internal
+        std::vector<Column> _columns;
+        /// For internal use only. @internal
+        size_t _minimum_sample_size;
+        /// For internal use only. @internal
+        DataRepresentation _representation;
+};
+
+}
+
+#endif
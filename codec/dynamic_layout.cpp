@@ -0,0 +1,552 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#include "dynamic_layout.h"
+
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
+#include "struct_layout.h"
+#include "element_accessor.h"
+
+namespace ddl
+{
+
+//define all needed error types and values locally
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+_MAKE_RESULT(-49, ERR_OUT_OF_RANGE);
+
+static const size_t nNoIndex = static_cast<size_t>(-1);
+
+/// the amount of array size combinations that are kept per struct
+static const size_t nMaxCachedLayouts = 8;
+
+static void moveToAlignment(size_t& bit_offset, size_t alignment)
+{
+    size_t nBitRest = bit_offset % 8;
+    if (nBitRest)
+    {
+        bit_offset += 8 - nBitRest;
+    }
+
+    size_t nByteOffset = bit_offset / 8;
+    size_t nRest = nByteOffset % alignment;
+    if (nRest)
+    {
+        bit_offset += (alignment - nRest) * 8;
+    }
+}
+
+/**
+ * Expands the dynamic elements of a struct for the array sizes found in the data.
+ * The size elements are located by the indices that have been resolved by the struct layout,
+ * so no names are required. Size elements that could not be resolved that way are looked up
+ * by their full name like it was done before the indices were introduced.
+ */
+class DynamicLayoutBuilder
+{
+    public:
+        DynamicLayoutBuilder(const StructLayout& oLayout,
+                             const ElementAccessor& oAccessor,
+                             const void* pData, size_t nDataSize,
+                             DynamicLayout& oDynamicLayout):
+            _layout(oLayout),
+            _accessor(oAccessor),
+            _data(pData),
+            _data_size(nDataSize),
+            _dynamic_layout(oDynamicLayout),
+            _resolve_by_name(hasUnresolvedSizeElements(oLayout.getDynamicElements()))
+        {
+        }
+
+        a_util::result::Result build()
+        {
+            _dynamic_layout._buffer_bit_sizes = _layout.getStaticBufferBitSizes();
+            return addElements(_layout.getDynamicElements(), nNoIndex, "",
+                               _dynamic_layout._buffer_bit_sizes);
+        }
+
+    private:
+        static bool hasUnresolvedSizeElements(const std::vector<DynamicStructLayoutElement>& vecElements)
+        {
+            for (std::vector<DynamicStructLayoutElement>::const_iterator itElement = vecElements.begin();
+                 itElement != vecElements.end(); ++itElement)
+            {
+                if ((itElement->isDynamicArray() && itElement->size_element_index == nNoIndex) ||
+                    hasUnresolvedSizeElements(itElement->dynamic_elements))
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        a_util::result::Result addElements(const std::vector<DynamicStructLayoutElement>& vecElements,
+                                           size_t nScopeStart,
+                                           const std::string& strPrefix,
+                                           Offsets& sOverallOffsets)
+        {
+            // the first element of each (non array) dynamic element in this scope
+            std::vector<size_t> vecFirstElements(vecElements.size(), nNoIndex);
+            for (size_t nDynamicElement = 0; nDynamicElement < vecElements.size(); ++nDynamicElement)
+            {
+                const DynamicStructLayoutElement& sDynamicElement = vecElements[nDynamicElement];
+                moveToAlignment(sOverallOffsets.deserialized, sDynamicElement.alignment);
+                if (sDynamicElement.isAlignmentElement())
+                {
+                    continue;
+                }
+
+                size_t nArraySize = 1;
+                bool bIsArray = sDynamicElement.isDynamicArray();
+                if (bIsArray)
+                {
+                    DynamicLayout::ArraySize sArraySize = readArraySize(sDynamicElement, nScopeStart,
+                                                                        strPrefix, vecFirstElements);
+                    RETURN_IF_FAILED(checkArraySize(sDynamicElement, sArraySize.value, sOverallOffsets));
+                    // only checked sizes are recorded, the namer expands the arrays by them
+                    _dynamic_layout._array_sizes.push_back(sArraySize);
+                    nArraySize = static_cast<size_t>(sArraySize.value);
+                }
+
+                for (size_t nArrayIndex = 0; nArrayIndex < nArraySize; ++nArrayIndex)
+                {
+                    size_t nInstanceStart = _layout.getStaticElements().size() +
+                                            _dynamic_layout._elements.size();
+                    if (nArrayIndex == 0)
+                    {
+                        vecFirstElements[nDynamicElement] = nInstanceStart;
+                    }
+
+                    std::string strName;
+                    if (_resolve_by_name)
+                    {
+                        strName = strPrefix + sDynamicElement.name;
+                        if (bIsArray)
+                        {
+                            strName += a_util::strings::format("[%d]", nArrayIndex);
+                        }
+                    }
+
+                    RETURN_IF_FAILED(addStaticElements(sDynamicElement, strName, sOverallOffsets));
+                    RETURN_IF_FAILED(addElements(sDynamicElement.dynamic_elements, nInstanceStart,
+                                                 _resolve_by_name ? strName + "." : std::string(),
+                                                 sOverallOffsets));
+                }
+
+                moveToAlignment(sOverallOffsets.deserialized, sDynamicElement.alignment);
+            }
+
+            return a_util::result::SUCCESS;
+        }
+
+        a_util::result::Result addStaticElements(const DynamicStructLayoutElement& sDynamicElement,
+                                                 const std::string& strName,
+                                                 Offsets& sOverallOffsets)
+        {
+            Offsets sStartOffsets = sOverallOffsets;
+            for (std::vector<StructLayoutElement>::const_iterator itStaticElement = sDynamicElement.static_elements.begin();
+                 itStaticElement != sDynamicElement.static_elements.end(); ++itStaticElement)
+            {
+                StructLayoutElement sElement = *itStaticElement;
+                sElement.name.clear();
+                sElement.deserialized.bit_offset += sStartOffsets.deserialized;
+                sElement.serialized.bit_offset += sStartOffsets.serialized;
+
+                // elements outside of the data can not be accessed
+                const Position& sPos = getPosition(sElement);
+                if (sPos.bit_offset + sPos.bit_size > _data_size * 8)
+                {
+                    return ERR_INVALID_ARG;
+                }
+
+                sOverallOffsets.deserialized = sElement.deserialized.bit_offset + sElement.deserialized.bit_size;
+                sOverallOffsets.serialized = sElement.serialized.bit_offset + sElement.serialized.bit_size;
+                _dynamic_layout._bit_end.deserialized = std::max(_dynamic_layout._bit_end.deserialized,
+                                                                 sOverallOffsets.deserialized);
+                _dynamic_layout._bit_end.serialized = std::max(_dynamic_layout._bit_end.serialized,
+                                                               sOverallOffsets.serialized);
+
+                if (_resolve_by_name)
+                {
+                    _element_names.insert(std::make_pair(itStaticElement->name.empty() ?
+                                                            strName : strName + "." + itStaticElement->name,
+                                                         _layout.getStaticElements().size() +
+                                                            _dynamic_layout._elements.size()));
+                }
+                _dynamic_layout._elements.push_back(sElement);
+            }
+
+            return a_util::result::SUCCESS;
+        }
+
+        const Position& getPosition(const StructLayoutElement& sElement) const
+        {
+            return _accessor.getRepresentation() == deserialized ?
+                        sElement.deserialized : sElement.serialized;
+        }
+
+        a_util::result::Result checkArraySize(const DynamicStructLayoutElement& sDynamicElement,
+                                              uint64_t nArraySize,
+                                              const Offsets& sOverallOffsets) const
+        {
+            // each array element needs at least the space of its static elements, so an array size
+            // read from corrupted data can not expand to more elements than the data can hold
+            size_t nElementBits = 0;
+            for (std::vector<StructLayoutElement>::const_iterator itStaticElement = sDynamicElement.static_elements.begin();
+                 itStaticElement != sDynamicElement.static_elements.end(); ++itStaticElement)
+            {
+                const Position& sPos = getPosition(*itStaticElement);
+                nElementBits = std::max(nElementBits, sPos.bit_offset + sPos.bit_size);
+            }
+
+            size_t nOffset = _accessor.getRepresentation() == deserialized ?
+                                sOverallOffsets.deserialized : sOverallOffsets.serialized;
+            size_t nRemainingBits = _data_size * 8 > nOffset ? _data_size * 8 - nOffset : 0;
+            if (nArraySize > nRemainingBits / std::max<size_t>(nElementBits, 1))
+            {
+                return ERR_OUT_OF_RANGE;
+            }
+
+            return a_util::result::SUCCESS;
+        }
+
+        const StructLayoutElement* getElement(size_t nIndex) const
+        {
+            size_t nStaticElementCount = _layout.getStaticElements().size();
+            if (nIndex < nStaticElementCount)
+            {
+                return &_layout.getStaticElements()[nIndex];
+            }
+            else if (nIndex - nStaticElementCount < _dynamic_layout._elements.size())
+            {
+                return &_dynamic_layout._elements[nIndex - nStaticElementCount];
+            }
+            return NULL;
+        }
+
+        const StructLayoutElement* findElement(const std::string& strName) const
+        {
+            ElementNameIndex::const_iterator itElement = _layout.getStaticElementIndex().find(strName);
+            if (itElement != _layout.getStaticElementIndex().end())
+            {
+                return getElement(itElement->second);
+            }
+
+            itElement = _element_names.find(strName);
+            if (itElement != _element_names.end())
+            {
+                return getElement(itElement->second);
+            }
+
+            return NULL;
+        }
+
+        DynamicLayout::ArraySize readArraySize(const DynamicStructLayoutElement& sDynamicElement,
+                                               size_t nScopeStart,
+                                               const std::string& strPrefix,
+                                               const std::vector<size_t>& vecFirstElements)
+        {
+            const StructLayoutElement* pElement = NULL;
+            if (sDynamicElement.size_element_index != nNoIndex)
+            {
+                // the static elements of the top level are the static elements of the struct
+                size_t nElement = nScopeStart == nNoIndex ? 0 : nScopeStart;
+                if (sDynamicElement.size_element_dynamic_index != nNoIndex)
+                {
+                    nElement = vecFirstElements[sDynamicElement.size_element_dynamic_index];
+                }
+
+                if (nElement != nNoIndex)
+                {
+                    pElement = getElement(nElement + sDynamicElement.size_element_index);
+                }
+            }
+            else if (_resolve_by_name)
+            {
+                pElement = findElement(strPrefix + sDynamicElement.size_element_name);
+            }
+
+            DynamicLayout::ArraySize sArraySize;
+            sArraySize.value = 0;
+            if (pElement)
+            {
+                a_util::variant::Variant oValue;
+                if (isOk(_accessor.getValue(*pElement, _data, _data_size, oValue)))
+                {
+                    sArraySize.value = oValue.asUInt64();
+                    sArraySize.element = *pElement;
+                    sArraySize.element.name.clear();
+                    return sArraySize;
+                }
+
+                // the result depends on the size of the data
+                _dynamic_layout._reusable = false;
+            }
+
+            // unresolved size elements are treated as empty arrays
+            sArraySize.element.type = a_util::variant::VT_Empty;
+            return sArraySize;
+        }
+
+    private:
+        const StructLayout& _layout;
+        const ElementAccessor& _accessor;
+        const void* _data;
+        size_t _data_size;
+        DynamicLayout& _dynamic_layout;
+        bool _resolve_by_name;
+        // the names of the expanded elements, only used to resolve size elements by name
+        ElementNameIndex _element_names;
+};
+
+/**
+ * Generates the names of the expanded dynamic elements by walking the layout with the
+ * array sizes that were recorded while building it.
+ */
+class DynamicLayoutNamer
+{
+    public:
+        DynamicLayoutNamer(const DynamicLayout& oDynamicLayout):
+            _dynamic_layout(oDynamicLayout),
+            _next_array_size(0)
+        {
+        }
+
+        void generate(const StructLayout& oLayout)
+        {
+            _dynamic_layout._named_elements = _dynamic_layout._elements;
+            _next_element = _dynamic_layout._named_elements.begin();
+            addElements(oLayout.getDynamicElements(), "");
+
+            size_t nStaticElementCount = oLayout.getStaticElements().size();
+            _dynamic_layout._element_index.reserve(_dynamic_layout._named_elements.size());
+            for (size_t nElement = 0; nElement < _dynamic_layout._named_elements.size(); ++nElement)
+            {
+                _dynamic_layout._element_index.insert(std::make_pair(_dynamic_layout._named_elements[nElement].name,
+                                                                     nStaticElementCount + nElement));
+            }
+        }
+
+    private:
+        void addElements(const std::vector<DynamicStructLayoutElement>& vecElements,
+                         const std::string& strPrefix)
+        {
+            for (std::vector<DynamicStructLayoutElement>::const_iterator itDynamicElement = vecElements.begin();
+                 itDynamicElement != vecElements.end(); ++itDynamicElement)
+            {
+                if (itDynamicElement->isAlignmentElement())
+                {
+                    continue;
+                }
+
+                bool bIsArray = itDynamicElement->isDynamicArray();
+                if (bIsArray && _next_array_size == _dynamic_layout._array_sizes.size())
+                {
+                    // the layout ends before this array, see DynamicLayout::create
+                    return;
+                }
+                size_t nArraySize = bIsArray ?
+                    static_cast<size_t>(_dynamic_layout._array_sizes[_next_array_size++].value) : 1;
+                for (size_t nArrayIndex = 0; nArrayIndex < nArraySize; ++nArrayIndex)
+                {
+                    if (_next_element == _dynamic_layout._named_elements.end())
+                    {
+                        // all elements of the layout have their names
+                        return;
+                    }
+
+                    std::string strName = strPrefix + itDynamicElement->name;
+                    if (bIsArray)
+                    {
+                        strName += a_util::strings::format("[%d]", nArrayIndex);
+                    }
+
+                    for (std::vector<StructLayoutElement>::const_iterator itStaticElement =
+                            itDynamicElement->static_elements.begin();
+                         itStaticElement != itDynamicElement->static_elements.end(); ++itStaticElement)
+                    {
+                        if (_next_element == _dynamic_layout._named_elements.end())
+                        {
+                            return;
+                        }
+
+                        if (!itStaticElement->name.empty())
+                        {
+                            _next_element->name = strName + "." + itStaticElement->name;
+                        }
+                        else
+                        {
+                            // not part of a struct, just a plain array element
+                            _next_element->name = strName;
+                        }
+                        ++_next_element;
+                    }
+
+                    addElements(itDynamicElement->dynamic_elements, strName + ".");
+                }
+            }
+        }
+
+    private:
+        const DynamicLayout& _dynamic_layout;
+        std::vector<StructLayoutElement>::iterator _next_element;
+        size_t _next_array_size;
+};
+
+static void generateNames(const DynamicLayout* pDynamicLayout, const StructLayout* pLayout)
+{
+    DynamicLayoutNamer(*pDynamicLayout).generate(*pLayout);
+}
+
+DynamicLayout::DynamicLayout():
+    _reusable(true)
+{
+    _buffer_bit_sizes.deserialized = 0;
+    _buffer_bit_sizes.serialized = 0;
+    _bit_end = _buffer_bit_sizes;
+}
+
+a_util::result::Result DynamicLayout::create(const StructLayout& oLayout,
+                                             const ElementAccessor& oAccessor,
+                                             const void* pData, size_t nDataSize,
+                                             a_util::memory::shared_ptr<const DynamicLayout>& pDynamicLayout)
+{
+    a_util::memory::shared_ptr<DynamicLayout> pNewLayout(new DynamicLayout());
+    DynamicLayoutBuilder oBuilder(oLayout, oAccessor, pData, nDataSize, *pNewLayout);
+    a_util::result::Result oResult = oBuilder.build();
+    if (isFailed(oResult))
+    {
+        // keep the elements that have been expanded so far, they are all within the data
+        pNewLayout->_reusable = false;
+    }
+    pDynamicLayout = pNewLayout;
+    return oResult;
+}
+
+bool DynamicLayout::matches(const ElementAccessor& oAccessor, const void* pData, size_t nDataSize) const
+{
+    if (!_reusable)
+    {
+        return false;
+    }
+
+    // the positions of all size elements only depend on the sizes read before them,
+    // so comparing the values in order is sufficient
+    for (std::vector<ArraySize>::const_iterator itArraySize = _array_sizes.begin();
+         itArraySize != _array_sizes.end(); ++itArraySize)
+    {
+        if (itArraySize->element.type == a_util::variant::VT_Empty)
+        {
+            continue;
+        }
+
+        a_util::variant::Variant oValue;
+        if (isFailed(oAccessor.getValue(itArraySize->element, pData, nDataSize, oValue)) ||
+            oValue.asUInt64() != itArraySize->value)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DynamicLayout::getArraySizes(std::vector<uint64_t>& vecArraySizes) const
+{
+    vecArraySizes.clear();
+    vecArraySizes.reserve(_array_sizes.size());
+    for (std::vector<ArraySize>::const_iterator itArraySize = _array_sizes.begin();
+         itArraySize != _array_sizes.end(); ++itArraySize)
+    {
+        vecArraySizes.push_back(itArraySize->value);
+    }
+}
+
+bool DynamicLayout::hasArraySizes(const std::vector<uint64_t>& vecArraySizes) const
+{
+    if (vecArraySizes.size() != _array_sizes.size())
+    {
+        return false;
+    }
+
+    for (size_t nArraySize = 0; nArraySize < _array_sizes.size(); ++nArraySize)
+    {
+        if (_array_sizes[nArraySize].value != vecArraySizes[nArraySize])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const std::vector<StructLayoutElement>& DynamicLayout::getNamedElements(const StructLayout& oLayout) const
+{
+    std::call_once(_names_flag, generateNames, this, &oLayout);
+    return _named_elements;
+}
+
+const ElementNameIndex& DynamicLayout::getElementIndex(const StructLayout& oLayout) const
+{
+    getNamedElements(oLayout);
+    return _element_index;
+}
+
+DynamicLayoutCache::DynamicLayoutCache():
+    _layouts(new LayoutList())
+{
+}
+
+a_util::memory::shared_ptr<const DynamicLayout> DynamicLayoutCache::find(const ElementAccessor& oAccessor,
+                                                                         const void* pData, size_t nDataSize) const
+{
+    // readers only take a snapshot of the list, so decoders never wait for each other
+    a_util::memory::shared_ptr<const LayoutList> pLayouts = std::atomic_load(&_layouts);
+    for (LayoutList::const_iterator itLayout = pLayouts->begin(); itLayout != pLayouts->end(); ++itLayout)
+    {
+        if ((*itLayout)->matches(oAccessor, pData, nDataSize))
+        {
+            return *itLayout;
+        }
+    }
+
+    return a_util::memory::shared_ptr<const DynamicLayout>();
+}
+
+void DynamicLayoutCache::insert(const a_util::memory::shared_ptr<const DynamicLayout>& pDynamicLayout)
+{
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    a_util::memory::shared_ptr<LayoutList> pLayouts(new LayoutList());
+    pLayouts->reserve(nMaxCachedLayouts);
+    pLayouts->push_back(pDynamicLayout);
+
+    // keep the most recently inserted layouts
+    a_util::memory::shared_ptr<const LayoutList> pOldLayouts = std::atomic_load(&_layouts);
+    for (LayoutList::const_iterator itLayout = pOldLayouts->begin();
+         itLayout != pOldLayouts->end() && pLayouts->size() < nMaxCachedLayouts; ++itLayout)
+    {
+        pLayouts->push_back(*itLayout);
+    }
+
+    std::atomic_store(&_layouts, a_util::memory::shared_ptr<const LayoutList>(pLayouts));
+}
+
+}
@@ -0,0 +1,135 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#ifndef DDL_DYNAMIC_LAYOUT_CLASS_HEADER
+#define DDL_DYNAMIC_LAYOUT_CLASS_HEADER
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "a_util/memory.h"
+#include "a_util/concurrency.h"
+
+#include "struct_element.h"
+
+namespace ddl
+{
+
+class StructLayout;
+class ElementAccessor;
+
+/**
+ * @internal
+ * This class is for internal use only.
+ * The expanded dynamic elements of a struct for one combination of array sizes.
+ * Element names are only generated when they are requested for the first time.
+ */
+class DynamicLayout
+{
+    public:
+        // on failure dynamic_layout contains the elements up to the first one outside of the data
+        static a_util::result::Result create(const StructLayout& layout,
+                                             const ElementAccessor& accessor,
+                                             const void* data, size_t data_size,
+                                             a_util::memory::shared_ptr<const DynamicLayout>& dynamic_layout);
+
+        // false if a size element could not be read, i.e. the layout depends on the data size
+        bool isReusable() const
+        {
+            return _reusable;
+        }
+
+        bool matches(const ElementAccessor& accessor, const void* data, size_t data_size) const;
+
+        // the sizes of the expanded arrays in the order of the layout, they determine all positions
+        void getArraySizes(std::vector<uint64_t>& array_sizes) const;
+
+        bool hasArraySizes(const std::vector<uint64_t>& array_sizes) const;
+
+        const std::vector<StructLayoutElement>& getElements() const
+        {
+            return _elements;
+        }
+
+        const Offsets& getBufferBitSizes() const
+        {
+            return _buffer_bit_sizes;
+        }
+
+        size_t getBitEnd(DataRepresentation rep) const
+        {
+            return rep == deserialized ? _bit_end.deserialized : _bit_end.serialized;
+        }
+
+        const std::vector<StructLayoutElement>& getNamedElements(const StructLayout& layout) const;
+
+        const ElementNameIndex& getElementIndex(const StructLayout& layout) const;
+
+    private:
+        DynamicLayout();
+
+        struct ArraySize
+        {
+            StructLayoutElement element;
+            uint64_t value;
+        };
+
+        friend class DynamicLayoutBuilder;
+        friend class DynamicLayoutNamer;
+
+    private:
+        std::vector<StructLayoutElement> _elements;
+        std::vector<ArraySize> _array_sizes;
+        Offsets _buffer_bit_sizes;
+        Offsets _bit_end;
+        bool _reusable;
+        mutable std::once_flag _names_flag;
+        mutable std::vector<StructLayoutElement> _named_elements;
+        mutable ElementNameIndex _element_index;
+};
+
+/**
+ * @internal
+ * This class is for internal use only.
+ * The most recently inserted dynamic layouts of a struct. Lookups work on an immutable
+ * snapshot of the list and do not lock, inserting replaces the snapshot.
+ */
+class DynamicLayoutCache
+{
+    public:
+        DynamicLayoutCache();
+
+        a_util::memory::shared_ptr<const DynamicLayout> find(const ElementAccessor& accessor,
+                                                             const void* data, size_t data_size) const;
+
+        void insert(const a_util::memory::shared_ptr<const DynamicLayout>& dynamic_layout);
+
+    private:
+        typedef std::vector<a_util::memory::shared_ptr<const DynamicLayout> > LayoutList;
+
+        // serializes inserts only
+        a_util::concurrency::mutex _mutex;
+        a_util::memory::shared_ptr<const LayoutList> _layouts;
+};
+
+}
+
+#endif
@@ -139,6 +139,32 @@ a_util::result::Result DeserializedAccessor::setValue(const StructLayoutElement&
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result DeserializedAccessor::getArrayValue(const StructLayoutElement& sElement, size_t nCount,
+                                             const void* pData, size_t nDataSize, void* pValues) const
+{
+    size_t nByteOffset = sElement.deserialized.bit_offset / 8;
+    size_t nByteSize = nCount * (sElement.deserialized.bit_size / 8);
+    if (nDataSize < nByteOffset || nDataSize - nByteOffset < nByteSize)
+    {
+        return ERR_INVALID_ARG;
+    }
+    a_util::memory::copy(pValues, nByteSize, static_cast<const uint8_t*>(pData) + nByteOffset, nByteSize);
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result DeserializedAccessor::setArrayValue(const StructLayoutElement& sElement, size_t nCount,
+                                             void* pData, size_t nDataSize, const void* pValues) const
+{
+    size_t nByteOffset = sElement.deserialized.bit_offset / 8;
+    size_t nByteSize = nCount * (sElement.deserialized.bit_size / 8);
+    if (nDataSize < nByteOffset || nDataSize - nByteOffset < nByteSize)
+    {
+        return ERR_INVALID_ARG;
+    }
+    a_util::memory::copy(static_cast<uint8_t*>(pData) + nByteOffset, nByteSize, pValues, nByteSize);
+    return a_util::result::SUCCESS;
+}
+
 const ElementAccessor& DeserializedAccessor::getInstance()
 {
     static DeserializedAccessor oInstance;
@@ -224,5 +250,74 @@ a_util::result::Result SerializedAccessor::setValue(const StructLayoutElement& s
     }
 }
 
+template <typename T>
+a_util::result::Result read_typed_array(const StructLayoutElement& sElement, size_t nCount,
+                         const void* pData, size_t nDataSize, void* pValues)
+{
+    a_util::memory::BitSerializer oHelper(const_cast<void*>(pData), nDataSize);
+    return oHelper.readArray<T>(sElement.serialized.bit_offset, nCount, static_cast<T*>(pValues),
+                                (a_util::memory::Endianess)sElement.byte_order);
+}
+
+#define GET_ARRAY_CASE_TYPE_SER(__variant_type, __data_type) \
+    case a_util::variant::__variant_type: \
+{ \
+    return read_typed_array<__data_type>(sElement, nCount, pData, nDataSize, pValues); \
+}
+
+a_util::result::Result SerializedAccessor::getArrayValue(const StructLayoutElement& sElement, size_t nCount,
+                                           const void* pData, size_t nDataSize, void* pValues) const
+{
+    switch(sElement.type)
+    {
+        GET_ARRAY_CASE_TYPE_SER(VT_Bool, bool)
+        GET_ARRAY_CASE_TYPE_SER(VT_Int8, int8_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_UInt8, uint8_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_Int16, int16_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_UInt16, uint16_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_Int32, int32_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_UInt32, uint32_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_Int64, int64_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_UInt64, uint64_t)
+        GET_ARRAY_CASE_TYPE_SER(VT_Float32, float)
+        GET_ARRAY_CASE_TYPE_SER(VT_Float64, double)
+        default: return ERR_NOT_SUPPORTED;
+    }
+}
+
+template <typename T>
+a_util::result::Result write_typed_array(const StructLayoutElement& sElement, size_t nCount,
+                          void* pData, size_t nDataSize, const void* pValues)
+{
+    a_util::memory::BitSerializer oHelper(pData, nDataSize);
+    return oHelper.writeArray<T>(sElement.serialized.bit_offset, nCount, static_cast<const T*>(pValues),
+                                 (a_util::memory::Endianess)sElement.byte_order);
+}
+
+#define SET_ARRAY_CASE_TYPE_SER(__variant_type, __data_type) \
+    case a_util::variant::__variant_type: \
+{ \
+    return write_typed_array<__data_type>(sElement, nCount, pData, nDataSize, pValues); \
+}
+
+a_util::result::Result SerializedAccessor::setArrayValue(const StructLayoutElement& sElement, size_t nCount,
+                                           void* pData, size_t nDataSize, const void* pValues) const
+{
+    switch(sElement.type)
+    {
+        SET_ARRAY_CASE_TYPE_SER(VT_Bool, bool)
+        SET_ARRAY_CASE_TYPE_SER(VT_Int8, int8_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_UInt8, uint8_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_Int16, int16_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_UInt16, uint16_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_Int32, int32_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_UInt32, uint32_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_Int64, int64_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_UInt64, uint64_t)
+        SET_ARRAY_CASE_TYPE_SER(VT_Float32, float)
+        SET_ARRAY_CASE_TYPE_SER(VT_Float64, double)
+        default: return ERR_NOT_SUPPORTED;
+    }
+}
 
 }
@@ -35,6 +35,13 @@ class ElementAccessor
         virtual a_util::result::Result setValue(const StructLayoutElement& element, void* data,
                                  size_t data_size, const void* element_value) const = 0;
 
+        /// Reads the values of count packed elements of the same type starting with element
+        virtual a_util::result::Result getArrayValue(const StructLayoutElement& element, size_t count,
+                                       const void* data, size_t data_size, void* values) const = 0;
+        /// Writes the values of count packed elements of the same type starting with element
+        virtual a_util::result::Result setArrayValue(const StructLayoutElement& element, size_t count,
+                                       void* data, size_t data_size, const void* values) const = 0;
+
         virtual DataRepresentation getRepresentation() const = 0;
 
         a_util::result::Result getValue(const StructLayoutElement& element, const void* data,
@@ -51,6 +58,10 @@ class DeserializedAccessor: public ElementAccessor
                                  size_t data_size, void* element_value) const;
         virtual a_util::result::Result setValue(const StructLayoutElement& element, void* data,
                                  size_t data_size, const void* element_value) const;
+        virtual a_util::result::Result getArrayValue(const StructLayoutElement& element, size_t count,
+                                       const void* data, size_t data_size, void* values) const;
+        virtual a_util::result::Result setArrayValue(const StructLayoutElement& element, size_t count,
+                                       void* data, size_t data_size, const void* values) const;
 
         virtual DataRepresentation getRepresentation() const
         {
@@ -68,6 +79,10 @@ class SerializedAccessor: public ElementAccessor
                                  size_t data_size, void* element_value) const;
         virtual a_util::result::Result setValue(const StructLayoutElement& element, void* data,
                                  size_t data_size, const void* element_value) const;
+        virtual a_util::result::Result getArrayValue(const StructLayoutElement& element, size_t count,
+                                       const void* data, size_t data_size, void* values) const;
+        virtual a_util::result::Result setArrayValue(const StructLayoutElement& element, size_t count,
+                                       void* data, size_t data_size, const void* values) const;
 
         virtual DataRepresentation getRepresentation() const
         {
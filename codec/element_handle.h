@@ -0,0 +1,201 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#ifndef DDL_ELEMENT_HANDLE_CLASS_HEADER
+#define DDL_ELEMENT_HANDLE_CLASS_HEADER
+
+#include "a_util/memory.h"
+#include "a_util/variant.h"
+
+#include "struct_element.h"
+#include "bitserializer.h"
+
+namespace ddl
+{
+
+class CodecFactory;
+
+namespace detail
+{
+
+/// For internal use only. @internal Maps a C++ type to the variant type of an element.
+template <typename T>
+struct VariantTypeOf;
+
+/// For internal use only. @internal
+#define DDL_VARIANT_TYPE_OF(__data_type, __variant_type) \
+template <> \
+struct VariantTypeOf<__data_type> \
+{ \
+    static const a_util::variant::VariantType value = a_util::variant::__variant_type; \
+};
+
+DDL_VARIANT_TYPE_OF(bool, VT_Bool)
+DDL_VARIANT_TYPE_OF(int8_t, VT_Int8)
+DDL_VARIANT_TYPE_OF(uint8_t, VT_UInt8)
+DDL_VARIANT_TYPE_OF(int16_t, VT_Int16)
+DDL_VARIANT_TYPE_OF(uint16_t, VT_UInt16)
+DDL_VARIANT_TYPE_OF(int32_t, VT_Int32)
+DDL_VARIANT_TYPE_OF(uint32_t, VT_UInt32)
+DDL_VARIANT_TYPE_OF(int64_t, VT_Int64)
+DDL_VARIANT_TYPE_OF(uint64_t, VT_UInt64)
+DDL_VARIANT_TYPE_OF(float, VT_Float32)
+DDL_VARIANT_TYPE_OF(double, VT_Float64)
+
+#undef DDL_VARIANT_TYPE_OF
+
+}
+
+/**
+ * A precompiled handle to a static element of a structure.
+ * Handles are created with @ref CodecFactory::resolve and can be used with all decoders
+ * and codecs created by the same factory (or any other factory for the same struct).
+ * Access through a handle does not perform any name lookups, type conversions or
+ * bounds checks, so make sure that the decoder or codec is valid before using it.
+ * @tparam T The C++ type of the element, this has to match the element type exactly.
+ */
+template <typename T>
+class ElementHandle
+{
+    public:
+        /// The C++ type of the element.
+        typedef T value_type;
+
+    public:
+        /**
+         * Constructs an invalid handle.
+         */
+        ElementHandle():
+            _index(static_cast<size_t>(-1)),
+            _byte_offset(0),
+            _serialized_bit_offset(0),
+            _serialized_bit_size(0),
+            _byte_order(a_util::memory::bit_little_endian),
+            _serialized_is_plain(false)
+        {
+        }
+
+        /**
+         * @return Whether or not the handle references an element.
+         */
+        bool isValid() const
+        {
+            return _index != static_cast<size_t>(-1);
+        }
+
+        /**
+         * @return The index of the referenced element.
+         */
+        size_t getIndex() const
+        {
+            return _index;
+        }
+
+        /**
+         * Reads the value of the referenced element.
+         * @param[in] data The data of the structure.
+         * @param[in] data_size The size of the data.
+         * @param[in] rep The representation of the data.
+         * @return The value of the element.
+         */
+        T read(const void* data, size_t data_size, DataRepresentation rep) const
+        {
+            T value;
+            if (rep == deserialized)
+            {
+                a_util::memory::copy(&value, sizeof(T),
+                                     static_cast<const uint8_t*>(data) + _byte_offset, sizeof(T));
+            }
+            else if (_serialized_is_plain)
+            {
+                a_util::memory::copy(&value, sizeof(T),
+                                     static_cast<const uint8_t*>(data) + _serialized_bit_offset / 8,
+                                     sizeof(T));
+            }
+            else
+            {
+                value = T();
+                a_util::memory::BitSerializer serializer(const_cast<void*>(data), data_size);
+                serializer.read<T>(_serialized_bit_offset, _serialized_bit_size, &value, _byte_order);
+            }
+            return value;
+        }
+
+        /**
+         * Writes the value of the referenced element.
+         * @param[in] data The data of the structure.
+         * @param[in] data_size The size of the data.
+         * @param[in] rep The representation of the data.
+         * @param[in] value The new value of the element.
+         */
+        void write(void* data, size_t data_size, DataRepresentation rep, T value) const
+        {
+            if (rep == deserialized)
+            {
+                a_util::memory::copy(static_cast<uint8_t*>(data) + _byte_offset, sizeof(T),
+                                     &value, sizeof(T));
+            }
+            else if (_serialized_is_plain)
+            {
+                a_util::memory::copy(static_cast<uint8_t*>(data) + _serialized_bit_offset / 8,
+                                     sizeof(T), &value, sizeof(T));
+            }
+            else
+            {
+                a_util::memory::BitSerializer serializer(data, data_size);
+                serializer.write<T>(_serialized_bit_offset, _serialized_bit_size, value, _byte_order);
+            }
+        }
+
+    private:
+        friend class CodecFactory;
+
+        /// For internal use only. @internal
+        ElementHandle(size_t index, const StructLayoutElement& element):
+            _index(index),
+            _byte_offset(element.deserialized.bit_offset / 8),
+            _serialized_bit_offset(element.serialized.bit_offset),
+            _serialized_bit_size(element.serialized.bit_size),
+            _byte_order(static_cast<a_util::memory::Endianess>(element.byte_order)),
+            _serialized_is_plain(element.serialized.bit_offset % 8 == 0 &&
+                                 element.serialized.bit_size == sizeof(T) * 8 &&
+                                 (sizeof(T) == 1 ||
+                                  _byte_order == a_util::memory::get_platform_endianess()))
+        {
+        }
+
+    private:
+        /// For internal use only. @internal
+        size_t _index;
+        /// For internal use only. @internal
+        size_t _byte_offset;
+        /// For internal use only. @internal
+        size_t _serialized_bit_offset;
+        /// For internal use only. @internal
+        size_t _serialized_bit_size;
+        /// For internal use only. @internal
+        a_util::memory::Endianess _byte_order;
+        /// For internal use only. @internal
+        bool _serialized_is_plain;
+};
+
+}
+
+#endif
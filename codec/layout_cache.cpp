@@ -0,0 +1,165 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#include "layout_cache.h"
+
+namespace ddl
+{
+
+LayoutCache& LayoutCache::getInstance()
+{
+    static LayoutCache oInstance;
+    return oInstance;
+}
+
+LayoutCache::LayoutCache():
+    _capacity(default_capacity)
+{
+}
+
+LayoutCache::Key LayoutCache::makeKey(const std::string& strStructName,
+                                      const std::string& strMediaDescription)
+{
+    Key sKey;
+    sKey.struct_name = strStructName;
+    sKey.description_hash = std::hash<std::string>()(strMediaDescription);
+    return sKey;
+}
+
+a_util::memory::shared_ptr<const StructLayout> LayoutCache::find(const std::string& strStructName,
+                                                                 const std::string& strMediaDescription)
+{
+    Key sKey = makeKey(strStructName, strMediaDescription);
+
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    EntryMap::iterator itEntry = _entries.find(sKey);
+    if (itEntry != _entries.end() && *itEntry->second.media_description == strMediaDescription)
+    {
+        _lru.splice(_lru.begin(), _lru, itEntry->second.lru_position);
+        return itEntry->second.layout;
+    }
+
+    return a_util::memory::shared_ptr<const StructLayout>();
+}
+
+void LayoutCache::insert(const std::string& strStructName,
+                         const std::string& strMediaDescription,
+                         const a_util::memory::shared_ptr<const StructLayout>& pLayout)
+{
+    Key sKey = makeKey(strStructName, strMediaDescription);
+
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    EntryMap::iterator itEntry = _entries.find(sKey);
+    if (itEntry != _entries.end())
+    {
+        // replaces the layout of the same struct or of a description with the same hash
+        erase(itEntry);
+    }
+    if (_capacity == 0)
+    {
+        return;
+    }
+    shrink(_capacity - 1);
+
+    _lru.push_front(sKey);
+    Entry& sEntry = _entries[sKey];
+    sEntry.media_description = intern(sKey.description_hash, strMediaDescription);
+    sEntry.layout = pLayout;
+    sEntry.lru_position = _lru.begin();
+}
+
+void LayoutCache::clear()
+{
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    _entries.clear();
+    _lru.clear();
+    _descriptions.clear();
+}
+
+size_t LayoutCache::getSize() const
+{
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    return _entries.size();
+}
+
+void LayoutCache::setCapacity(size_t nCapacity)
+{
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    _capacity = nCapacity;
+    shrink(_capacity);
+}
+
+size_t LayoutCache::getCapacity() const
+{
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    return _capacity;
+}
+
+a_util::memory::shared_ptr<const std::string> LayoutCache::intern(size_t nDescriptionHash,
+                                                                  const std::string& strMediaDescription)
+{
+    std::pair<DescriptionMap::iterator, DescriptionMap::iterator> oRange =
+        _descriptions.equal_range(nDescriptionHash);
+    for (DescriptionMap::iterator itDescription = oRange.first; itDescription != oRange.second; ++itDescription)
+    {
+        if (*itDescription->second == strMediaDescription)
+        {
+            return itDescription->second;
+        }
+    }
+
+    a_util::memory::shared_ptr<const std::string> pDescription(new std::string(strMediaDescription));
+    _descriptions.insert(std::make_pair(nDescriptionHash, pDescription));
+    return pDescription;
+}
+
+void LayoutCache::erase(EntryMap::iterator itEntry)
+{
+    a_util::memory::shared_ptr<const std::string> pDescription = itEntry->second.media_description;
+    size_t nDescriptionHash = itEntry->first.description_hash;
+    _lru.erase(itEntry->second.lru_position);
+    _entries.erase(itEntry);
+
+    // drop the description once no entry refers to it anymore (the description map and
+    // the local copy are the remaining owners)
+    if (pDescription.use_count() == 2)
+    {
+        std::pair<DescriptionMap::iterator, DescriptionMap::iterator> oRange =
+            _descriptions.equal_range(nDescriptionHash);
+        for (DescriptionMap::iterator itDescription = oRange.first; itDescription != oRange.second; ++itDescription)
+        {
+            if (itDescription->second == pDescription)
+            {
+                _descriptions.erase(itDescription);
+                break;
+            }
+        }
+    }
+}
+
+void LayoutCache::shrink(size_t nSize)
+{
+    while (_entries.size() > nSize)
+    {
+        erase(_entries.find(_lru.back()));
+    }
+}
+
+}
@@ -0,0 +1,121 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#ifndef DDL_LAYOUT_CACHE_CLASS_HEADER
+#define DDL_LAYOUT_CACHE_CLASS_HEADER
+
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "a_util/memory.h"
+#include "a_util/concurrency.h"
+
+#include "struct_layout.h"
+
+namespace ddl
+{
+
+/**
+ * @internal
+ * This class is for internal use only.
+ * Process wide cache of struct layouts keyed by the struct name and a hash of the
+ * media description they have been created from. Each distinct media description is
+ * stored once and shared by all layouts created from it. The cache holds at most
+ * getCapacity() layouts and evicts the least recently used ones.
+ */
+class LayoutCache
+{
+    public:
+        /// The default amount of layouts kept in the cache
+        static const size_t default_capacity = 256;
+
+        static LayoutCache& getInstance();
+
+        a_util::memory::shared_ptr<const StructLayout> find(const std::string& struct_name,
+                                                            const std::string& media_description);
+
+        void insert(const std::string& struct_name,
+                    const std::string& media_description,
+                    const a_util::memory::shared_ptr<const StructLayout>& layout);
+
+        void clear();
+
+        size_t getSize() const;
+
+        void setCapacity(size_t capacity);
+
+        size_t getCapacity() const;
+
+    private:
+        LayoutCache();
+
+        struct Key
+        {
+            std::string struct_name;
+            size_t description_hash;
+
+            bool operator==(const Key& other) const
+            {
+                return description_hash == other.description_hash &&
+                       struct_name == other.struct_name;
+            }
+        };
+
+        struct KeyHash
+        {
+            size_t operator()(const Key& key) const
+            {
+                return std::hash<std::string>()(key.struct_name) ^ (key.description_hash * 31);
+            }
+        };
+
+        typedef std::list<Key> LruList;
+
+        struct Entry
+        {
+            // kept to rule out hash collisions, shared by all entries of the same description
+            a_util::memory::shared_ptr<const std::string> media_description;
+            a_util::memory::shared_ptr<const StructLayout> layout;
+            LruList::iterator lru_position;
+        };
+
+        typedef std::unordered_map<Key, Entry, KeyHash> EntryMap;
+        typedef std::unordered_multimap<size_t, a_util::memory::shared_ptr<const std::string> > DescriptionMap;
+
+        static Key makeKey(const std::string& struct_name, const std::string& media_description);
+        a_util::memory::shared_ptr<const std::string> intern(size_t description_hash,
+                                                             const std::string& media_description);
+        void erase(EntryMap::iterator entry);
+        void shrink(size_t size);
+
+    private:
+        mutable a_util::concurrency::mutex _mutex;
+        EntryMap _entries;
+        // most recently used entry first
+        LruList _lru;
+        DescriptionMap _descriptions;
+        size_t _capacity;
+};
+
+}
+
+#endif
@@ -22,9 +22,12 @@
 #define _DDL_CODEC_PKG_HEADER_
 
 #include "struct_element.h"
+#include "element_handle.h"
 #include "static_codec.h"
 #include "codec.h"
 #include "codec_factory.h"
+#include "column_extractor.h"
+#include "precompiled_layouts.h"
 #include "access_element.h"
 #include "bitserializer.h"
 
@@ -0,0 +1,840 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
+#include "struct_layout.h"
+#include "precompiled_layouts.h"
+
+#include "ddlrepresentation/ddldescription.h"
+#include "ddlrepresentation/ddlbyteorder.h"
+
+namespace ddl
+{
+//define all needed error types and values locally
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+_MAKE_RESULT(-20, ERR_NOT_FOUND);
+_MAKE_RESULT(-27, ERR_OPEN_FAILED);
+_MAKE_RESULT(-36, ERR_UNKNOWN_FORMAT);
+_MAKE_RESULT(-37, ERR_NOT_INITIALIZED);
+
+/*
+ * File format, all values in host byte order:
+ *   FileHeader
+ *   StructEntry[struct_count], sorted by name
+ *   per struct: LayoutRecord
+ *               EnumRecord[enum_count], each followed by EnumValueRecord[value_count]
+ *               ElementRecord[static_count]
+ *               DynamicRecord[dynamic_count], each followed by its static and dynamic
+ *               elements in the same way
+ *   string pool, referenced by StringRef relative to its start
+ * All records consist of naturally aligned fields without padding. Any change of the
+ * records requires a new format version.
+ */
+static const char s_magic[4] = { 'D', 'D', 'L', 'L' };
+static const uint32_t s_format_version = 1;
+static const uint32_t s_byte_order_mark = 0x01020304;
+static const uint32_t s_no_index = static_cast<uint32_t>(-1);
+
+struct StringRef
+{
+    uint64_t offset;
+    uint64_t size;
+};
+
+struct FileHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t byte_order_mark;
+    uint32_t struct_count;
+    uint64_t string_pool_offset;
+    uint64_t string_pool_size;
+};
+
+struct StructEntry
+{
+    StringRef name;
+    uint64_t layout_offset;
+};
+
+struct LayoutRecord
+{
+    uint64_t deserialized_bits;
+    uint64_t serialized_bits;
+    uint32_t enum_count;
+    uint32_t static_count;
+    uint32_t dynamic_count;
+    uint32_t reserved;
+};
+
+struct EnumRecord
+{
+    StringRef name;
+    uint32_t value_count;
+    uint32_t reserved;
+};
+
+struct EnumValueRecord
+{
+    StringRef name;
+    StringRef value;
+};
+
+struct ElementRecord
+{
+    StringRef name;
+    uint32_t type;
+    int32_t byte_order;
+    uint32_t enum_index;
+    uint32_t constant_enum_index;
+    StringRef constant;
+    uint64_t deserialized_offset;
+    uint64_t deserialized_size;
+    uint64_t serialized_offset;
+    uint64_t serialized_size;
+};
+
+struct DynamicRecord
+{
+    StringRef name;
+    StringRef size_element_name;
+    uint64_t alignment;
+    uint64_t size_element_index;
+    uint64_t size_element_dynamic_index;
+    uint32_t static_count;
+    uint32_t dynamic_count;
+};
+
+// the records are read by copying their bytes, so their sizes are part of the format
+static_assert(sizeof(StringRef) == 16, "StringRef changed, a new format version is required");
+static_assert(sizeof(FileHeader) == 32, "FileHeader changed, a new format version is required");
+static_assert(sizeof(StructEntry) == 24, "StructEntry changed, a new format version is required");
+static_assert(sizeof(LayoutRecord) == 32, "LayoutRecord changed, a new format version is required");
+static_assert(sizeof(EnumRecord) == 24, "EnumRecord changed, a new format version is required");
+static_assert(sizeof(EnumValueRecord) == 32, "EnumValueRecord changed, a new format version is required");
+static_assert(sizeof(ElementRecord) == 80, "ElementRecord changed, a new format version is required");
+static_assert(sizeof(DynamicRecord) == 64, "DynamicRecord changed, a new format version is required");
+
+/// The enums of a layout in the order of the file, the elements refer to them by index
+typedef std::vector<const EnumType*> EnumTable;
+
+/**
+ * Appends records and collects all strings in a pool that is appended at the end.
+ */
+class LayoutWriter
+{
+    public:
+        size_t getSize() const
+        {
+            return _records.size();
+        }
+
+        template <typename T>
+        void append(const T& sRecord)
+        {
+            _records.append(reinterpret_cast<const char*>(&sRecord), sizeof(T));
+        }
+
+        template <typename T>
+        void update(size_t nOffset, const T& sRecord)
+        {
+            _records.replace(nOffset, sizeof(T), reinterpret_cast<const char*>(&sRecord), sizeof(T));
+        }
+
+        StringRef addString(const std::string& strValue)
+        {
+            // element and enum value names repeat a lot, so every string is stored only once
+            StringRef sRef;
+            sRef.size = strValue.size();
+            std::unordered_map<std::string, uint64_t>::const_iterator itString =
+                _string_offsets.find(strValue);
+            if (itString != _string_offsets.end())
+            {
+                sRef.offset = itString->second;
+            }
+            else
+            {
+                sRef.offset = _strings.size();
+                _strings.append(strValue);
+                _string_offsets.insert(std::make_pair(strValue, sRef.offset));
+            }
+            return sRef;
+        }
+
+        void finish(uint32_t nStructCount, std::string& strData)
+        {
+            FileHeader sHeader = FileHeader();
+            std::memcpy(sHeader.magic, s_magic, sizeof(s_magic));
+            sHeader.version = s_format_version;
+            sHeader.byte_order_mark = s_byte_order_mark;
+            sHeader.struct_count = nStructCount;
+            sHeader.string_pool_offset = _records.size();
+            sHeader.string_pool_size = _strings.size();
+            update(0, sHeader);
+
+            strData.swap(_records);
+            strData.append(_strings);
+            _records.clear();
+            _strings.clear();
+            _string_offsets.clear();
+        }
+
+    private:
+        std::string _records;
+        std::string _strings;
+        std::unordered_map<std::string, uint64_t> _string_offsets;
+};
+
+/**
+ * Reads records sequentially with bounds checks, the data might be corrupted.
+ */
+class LayoutReader
+{
+    public:
+        LayoutReader(const char* pData, size_t nSize, const char* pStrings, size_t nStringsSize,
+                     size_t nOffset):
+            _data(pData), _size(nSize), _strings(pStrings), _strings_size(nStringsSize),
+            _offset(nOffset)
+        {
+        }
+
+        template <typename T>
+        bool read(T& sRecord)
+        {
+            if (_offset > _size || _size - _offset < sizeof(T))
+            {
+                return false;
+            }
+            // the mapped data is not necessarily aligned for T
+            std::memcpy(&sRecord, _data + _offset, sizeof(T));
+            _offset += sizeof(T);
+            return true;
+        }
+
+        bool readString(const StringRef& sRef, std::string& strValue) const
+        {
+            if (sRef.offset > _strings_size || sRef.size > _strings_size - sRef.offset)
+            {
+                return false;
+            }
+            strValue.assign(_strings + sRef.offset, static_cast<size_t>(sRef.size));
+            return true;
+        }
+
+        template <typename T>
+        bool canContain(uint64_t nCount) const
+        {
+            return _offset <= _size && nCount <= (_size - _offset) / sizeof(T);
+        }
+
+    private:
+        const char* _data;
+        size_t _size;
+        const char* _strings;
+        size_t _strings_size;
+        size_t _offset;
+};
+
+static uint32_t findEnumIndex(const EnumTable& vecEnums, const EnumType* pEnum)
+{
+    EnumTable::const_iterator itEnum = std::find(vecEnums.begin(), vecEnums.end(), pEnum);
+    if (!pEnum || itEnum == vecEnums.end())
+    {
+        return s_no_index;
+    }
+    return static_cast<uint32_t>(itEnum - vecEnums.begin());
+}
+
+static void writeElements(LayoutWriter& oWriter, const EnumTable& vecEnums,
+                          const std::vector<StructLayoutElement>& vecElements)
+{
+    for (std::vector<StructLayoutElement>::const_iterator it = vecElements.begin();
+         it != vecElements.end(); ++it)
+    {
+        ElementRecord sRecord = ElementRecord();
+        sRecord.name = oWriter.addString(it->name);
+        sRecord.type = static_cast<uint32_t>(it->type);
+        sRecord.byte_order = it->byte_order;
+        sRecord.enum_index = findEnumIndex(vecEnums, it->p_enum);
+        sRecord.constant_enum_index = s_no_index;
+        sRecord.deserialized_offset = it->deserialized.bit_offset;
+        sRecord.deserialized_size = it->deserialized.bit_size;
+        sRecord.serialized_offset = it->serialized.bit_offset;
+        sRecord.serialized_size = it->serialized.bit_size;
+
+        // constants point to a value of one of the enums of the layout
+        for (size_t nEnum = 0; it->constant && nEnum < vecEnums.size(); ++nEnum)
+        {
+            for (EnumType::const_iterator itValue = vecEnums[nEnum]->begin();
+                 itValue != vecEnums[nEnum]->end(); ++itValue)
+            {
+                if (&itValue->second == it->constant)
+                {
+                    sRecord.constant_enum_index = static_cast<uint32_t>(nEnum);
+                    sRecord.constant = oWriter.addString(itValue->first);
+                    break;
+                }
+            }
+        }
+
+        oWriter.append(sRecord);
+    }
+}
+
+static void writeDynamicElements(LayoutWriter& oWriter, const EnumTable& vecEnums,
+                                 const std::vector<DynamicStructLayoutElement>& vecElements)
+{
+    for (std::vector<DynamicStructLayoutElement>::const_iterator it = vecElements.begin();
+         it != vecElements.end(); ++it)
+    {
+        DynamicRecord sRecord = DynamicRecord();
+        sRecord.name = oWriter.addString(it->name);
+        sRecord.size_element_name = oWriter.addString(it->size_element_name);
+        sRecord.alignment = it->alignment;
+        sRecord.size_element_index = it->size_element_index;
+        sRecord.size_element_dynamic_index = it->size_element_dynamic_index;
+        sRecord.static_count = static_cast<uint32_t>(it->static_elements.size());
+        sRecord.dynamic_count = static_cast<uint32_t>(it->dynamic_elements.size());
+        oWriter.append(sRecord);
+
+        writeElements(oWriter, vecEnums, it->static_elements);
+        writeDynamicElements(oWriter, vecEnums, it->dynamic_elements);
+    }
+}
+
+static bool compareStructNames(const DDLComplex* pFirst, const DDLComplex* pSecond)
+{
+    return pFirst->getName() < pSecond->getName();
+}
+
+/**
+ * Maps a file read-only into memory.
+ */
+class PrecompiledLayouts::MappedFile
+{
+    public:
+        MappedFile():
+            _data(NULL),
+            _size(0)
+        {
+        }
+
+        ~MappedFile()
+        {
+            if (_data)
+            {
+#ifdef WIN32
+                UnmapViewOfFile(_data);
+#else
+                munmap(const_cast<char*>(_data), _size);
+#endif
+            }
+        }
+
+        a_util::result::Result map(const a_util::filesystem::Path& oFile)
+        {
+#ifdef WIN32
+            HANDLE hFile = CreateFileA(oFile.toString().c_str(), GENERIC_READ, FILE_SHARE_READ,
+                                       NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (hFile == INVALID_HANDLE_VALUE)
+            {
+                return ERR_OPEN_FAILED;
+            }
+
+            LARGE_INTEGER nFileSize;
+            if (!GetFileSizeEx(hFile, &nFileSize))
+            {
+                CloseHandle(hFile);
+                return ERR_OPEN_FAILED;
+            }
+            _size = static_cast<size_t>(nFileSize.QuadPart);
+
+            if (_size > 0)
+            {
+                HANDLE hMapping = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+                if (hMapping)
+                {
+                    _data = static_cast<const char*>(MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0));
+                    // the view keeps the mapping alive
+                    CloseHandle(hMapping);
+                }
+            }
+            CloseHandle(hFile);
+#else
+            int nFile = open(oFile.toString().c_str(), O_RDONLY);
+            if (nFile < 0)
+            {
+                return ERR_OPEN_FAILED;
+            }
+
+            struct stat sStat;
+            if (fstat(nFile, &sStat) != 0)
+            {
+                close(nFile);
+                return ERR_OPEN_FAILED;
+            }
+            _size = static_cast<size_t>(sStat.st_size);
+
+            if (_size > 0)
+            {
+                void* pData = mmap(NULL, _size, PROT_READ, MAP_PRIVATE, nFile, 0);
+                if (pData != MAP_FAILED)
+                {
+                    _data = static_cast<const char*>(pData);
+                }
+            }
+            // the mapping stays valid after closing the file
+            close(nFile);
+#endif
+
+            if (_size > 0 && !_data)
+            {
+                _size = 0;
+                return ERR_OPEN_FAILED;
+            }
+
+            return a_util::result::SUCCESS;
+        }
+
+        const char* getData() const
+        {
+            return _data;
+        }
+
+        size_t getSize() const
+        {
+            return _size;
+        }
+
+    private:
+        const char* _data;
+        size_t _size;
+};
+
+PrecompiledLayouts::PrecompiledLayouts():
+    _data(NULL),
+    _data_size(0),
+    _struct_count(0),
+    _strings(NULL),
+    _strings_size(0)
+{
+}
+
+PrecompiledLayouts::~PrecompiledLayouts()
+{
+}
+
+a_util::result::Result PrecompiledLayouts::writeFile(const DDLDescription& oDescription,
+                                                     const a_util::filesystem::Path& oFile)
+{
+    std::string strData;
+    RETURN_IF_FAILED(write(oDescription, strData));
+
+    std::ofstream oStream(oFile.toString().c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!oStream.is_open())
+    {
+        return ERR_OPEN_FAILED;
+    }
+    oStream.write(strData.data(), strData.size());
+    oStream.close();
+    if (oStream.fail())
+    {
+        return ERR_OPEN_FAILED;
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result PrecompiledLayouts::write(const DDLDescription& oDescription, std::string& strData)
+{
+    const DDLComplexVec& vecStructs = oDescription.getStructs();
+    std::vector<const DDLComplex*> vecSorted(vecStructs.begin(), vecStructs.end());
+    std::sort(vecSorted.begin(), vecSorted.end(), compareStructNames);
+
+    LayoutWriter oWriter;
+    oWriter.append(FileHeader());
+    size_t nEntriesOffset = oWriter.getSize();
+    for (size_t nStruct = 0; nStruct < vecSorted.size(); ++nStruct)
+    {
+        oWriter.append(StructEntry());
+    }
+
+    for (size_t nStruct = 0; nStruct < vecSorted.size(); ++nStruct)
+    {
+        StructLayout oLayout(vecSorted[nStruct]);
+        if (a_util::result::isFailed(oLayout.isValid()))
+        {
+            return ERR_INVALID_ARG;
+        }
+
+        StructEntry sEntry = StructEntry();
+        sEntry.name = oWriter.addString(vecSorted[nStruct]->getName());
+        sEntry.layout_offset = oWriter.getSize();
+        oWriter.update(nEntriesOffset + nStruct * sizeof(StructEntry), sEntry);
+
+        LayoutRecord sRecord = LayoutRecord();
+        sRecord.deserialized_bits = oLayout._static_buffer_sizes.deserialized;
+        sRecord.serialized_bits = oLayout._static_buffer_sizes.serialized;
+        sRecord.enum_count = static_cast<uint32_t>(oLayout._enums.size());
+        sRecord.static_count = static_cast<uint32_t>(oLayout._static_elements.size());
+        sRecord.dynamic_count = static_cast<uint32_t>(oLayout._dynamic_elements.size());
+        oWriter.append(sRecord);
+
+        EnumTable vecEnums;
+        for (std::map<std::string, EnumType>::const_iterator itEnum = oLayout._enums.begin();
+             itEnum != oLayout._enums.end(); ++itEnum)
+        {
+            vecEnums.push_back(&itEnum->second);
+
+            EnumRecord sEnum = EnumRecord();
+            sEnum.name = oWriter.addString(itEnum->first);
+            sEnum.value_count = static_cast<uint32_t>(itEnum->second.size());
+            oWriter.append(sEnum);
+
+            for (EnumType::const_iterator itValue = itEnum->second.begin();
+                 itValue != itEnum->second.end(); ++itValue)
+            {
+                EnumValueRecord sValue;
+                sValue.name = oWriter.addString(itValue->first);
+                sValue.value = oWriter.addString(itValue->second.asString());
+                oWriter.append(sValue);
+            }
+        }
+
+        writeElements(oWriter, vecEnums, oLayout._static_elements);
+        writeDynamicElements(oWriter, vecEnums, oLayout._dynamic_elements);
+    }
+
+    oWriter.finish(static_cast<uint32_t>(vecSorted.size()), strData);
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result PrecompiledLayouts::load(const a_util::filesystem::Path& oFile)
+{
+    a_util::memory::unique_ptr<MappedFile> pFile(new MappedFile());
+    RETURN_IF_FAILED(pFile->map(oFile));
+    RETURN_IF_FAILED(load(pFile->getData(), pFile->getSize()));
+    _file.reset(pFile.release());
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result PrecompiledLayouts::load(const void* pData, size_t nDataSize)
+{
+    FileHeader sHeader;
+    LayoutReader oReader(static_cast<const char*>(pData), nDataSize, NULL, 0, 0);
+    if (!pData || !oReader.read(sHeader) ||
+        std::memcmp(sHeader.magic, s_magic, sizeof(s_magic)) != 0 ||
+        sHeader.version != s_format_version ||
+        sHeader.byte_order_mark != s_byte_order_mark ||
+        !oReader.canContain<StructEntry>(sHeader.struct_count) ||
+        sHeader.string_pool_offset > nDataSize ||
+        sHeader.string_pool_size > nDataSize - sHeader.string_pool_offset)
+    {
+        return ERR_UNKNOWN_FORMAT;
+    }
+
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    _file.reset();
+    _layouts.clear();
+    _data = static_cast<const char*>(pData);
+    _data_size = nDataSize;
+    _struct_count = sHeader.struct_count;
+    _strings = _data + sHeader.string_pool_offset;
+    _strings_size = static_cast<size_t>(sHeader.string_pool_size);
+
+    return a_util::result::SUCCESS;
+}
+
+size_t PrecompiledLayouts::getStructCount() const
+{
+    return _struct_count;
+}
+
+std::string PrecompiledLayouts::getStructName(size_t nIndex) const
+{
+    std::string strName;
+    StructEntry sEntry;
+    LayoutReader oReader(_data, _data_size, _strings, _strings_size,
+                         sizeof(FileHeader) + nIndex * sizeof(StructEntry));
+    if (nIndex < _struct_count && oReader.read(sEntry))
+    {
+        oReader.readString(sEntry.name, strName);
+    }
+    return strName;
+}
+
+CodecFactory PrecompiledLayouts::createFactory(const std::string& strStructName) const
+{
+    {
+        std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+        std::unordered_map<std::string, a_util::memory::shared_ptr<const StructLayout> >::const_iterator
+            itLayout = _layouts.find(strStructName);
+        if (itLayout != _layouts.end())
+        {
+            return CodecFactory(itLayout->second, a_util::result::SUCCESS);
+        }
+    }
+
+    a_util::memory::shared_ptr<const StructLayout> pInvalid(new StructLayout());
+    if (!_data)
+    {
+        return CodecFactory(pInvalid, ERR_NOT_INITIALIZED);
+    }
+
+    size_t nIndex = 0;
+    if (!findStruct(strStructName, nIndex))
+    {
+        return CodecFactory(pInvalid, ERR_NOT_FOUND);
+    }
+
+    a_util::memory::shared_ptr<StructLayout> pLayout(new StructLayout());
+    a_util::result::Result nResult = readLayout(nIndex, *pLayout);
+    if (a_util::result::isFailed(nResult))
+    {
+        return CodecFactory(pInvalid, nResult);
+    }
+
+    // another thread might have read the same layout in the meantime, the first one wins
+    std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+    a_util::memory::shared_ptr<const StructLayout>& pCached = _layouts[strStructName];
+    if (!pCached)
+    {
+        pCached = pLayout;
+    }
+    return CodecFactory(pCached, a_util::result::SUCCESS);
+}
+
+bool PrecompiledLayouts::findStruct(const std::string& strStructName, size_t& nIndex) const
+{
+    // the entries are sorted by name
+    size_t nFirst = 0;
+    size_t nLast = _struct_count;
+    std::string strName;
+    while (nFirst < nLast)
+    {
+        size_t nMiddle = nFirst + (nLast - nFirst) / 2;
+        StructEntry sEntry;
+        LayoutReader oReader(_data, _data_size, _strings, _strings_size,
+                             sizeof(FileHeader) + nMiddle * sizeof(StructEntry));
+        if (!oReader.read(sEntry) || !oReader.readString(sEntry.name, strName))
+        {
+            return false;
+        }
+
+        int nCompare = strStructName.compare(strName);
+        if (nCompare == 0)
+        {
+            nIndex = nMiddle;
+            return true;
+        }
+        if (nCompare < 0)
+        {
+            nLast = nMiddle;
+        }
+        else
+        {
+            nFirst = nMiddle + 1;
+        }
+    }
+
+    return false;
+}
+
+/// Checks that a bit range lies within a buffer of the given amount of bits
+static bool isWithin(uint64_t nOffset, uint64_t nSize, uint64_t nBufferBits)
+{
+    return nSize <= nBufferBits && nOffset <= nBufferBits - nSize;
+}
+
+/**
+ * Reads the element records, the elements of the static part of a layout (@p pLayout not NULL)
+ * have to lie within its static buffers.
+ */
+static a_util::result::Result readElements(LayoutReader& oReader, const EnumTable& vecEnums,
+                                           uint32_t nCount, const LayoutRecord* pLayout,
+                                           std::vector<StructLayoutElement>& vecElements)
+{
+    if (!oReader.canContain<ElementRecord>(nCount))
+    {
+        return ERR_UNKNOWN_FORMAT;
+    }
+
+    vecElements.resize(nCount);
+    for (uint32_t nElement = 0; nElement < nCount; ++nElement)
+    {
+        ElementRecord sRecord;
+        StructLayoutElement& sElement = vecElements[nElement];
+        if (!oReader.read(sRecord) || !oReader.readString(sRecord.name, sElement.name) ||
+            (sRecord.enum_index != s_no_index && sRecord.enum_index >= vecEnums.size()) ||
+            (sRecord.constant_enum_index != s_no_index && sRecord.constant_enum_index >= vecEnums.size()))
+        {
+            return ERR_UNKNOWN_FORMAT;
+        }
+
+        // the values are used to index type tables and to swap bytes, they must be valid
+        if (sRecord.type < a_util::variant::VT_Bool || sRecord.type > a_util::variant::VT_Float64 ||
+            sRecord.byte_order < DDLByteorder::platform_not_supported ||
+            sRecord.byte_order > DDLByteorder::platform_big_endian_8 ||
+            sRecord.deserialized_size > 64 || sRecord.serialized_size > 64)
+        {
+            return ERR_UNKNOWN_FORMAT;
+        }
+        if (pLayout &&
+            (!isWithin(sRecord.deserialized_offset, sRecord.deserialized_size, pLayout->deserialized_bits) ||
+             !isWithin(sRecord.serialized_offset, sRecord.serialized_size, pLayout->serialized_bits)))
+        {
+            return ERR_UNKNOWN_FORMAT;
+        }
+
+        sElement.type = static_cast<a_util::variant::VariantType>(sRecord.type);
+        sElement.byte_order = sRecord.byte_order;
+        sElement.p_enum = sRecord.enum_index != s_no_index ? vecEnums[sRecord.enum_index] : NULL;
+        sElement.deserialized.bit_offset = static_cast<size_t>(sRecord.deserialized_offset);
+        sElement.deserialized.bit_size = static_cast<size_t>(sRecord.deserialized_size);
+        sElement.serialized.bit_offset = static_cast<size_t>(sRecord.serialized_offset);
+        sElement.serialized.bit_size = static_cast<size_t>(sRecord.serialized_size);
+        sElement.constant = NULL;
+
+        if (sRecord.constant_enum_index != s_no_index)
+        {
+            std::string strConstant;
+            if (!oReader.readString(sRecord.constant, strConstant))
+            {
+                return ERR_UNKNOWN_FORMAT;
+            }
+            const EnumType& oEnum = *vecEnums[sRecord.constant_enum_index];
+            EnumType::const_iterator itValue = oEnum.find(strConstant);
+            if (itValue == oEnum.end())
+            {
+                return ERR_UNKNOWN_FORMAT;
+            }
+            sElement.constant = &itValue->second;
+        }
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+static a_util::result::Result readDynamicElements(LayoutReader& oReader, const EnumTable& vecEnums,
+                                                  uint32_t nCount,
+                                                  std::vector<DynamicStructLayoutElement>& vecElements)
+{
+    if (!oReader.canContain<DynamicRecord>(nCount))
+    {
+        return ERR_UNKNOWN_FORMAT;
+    }
+
+    vecElements.resize(nCount);
+    for (uint32_t nElement = 0; nElement < nCount; ++nElement)
+    {
+        DynamicRecord sRecord;
+        DynamicStructLayoutElement& sElement = vecElements[nElement];
+        if (!oReader.read(sRecord) || !oReader.readString(sRecord.name, sElement.name) ||
+            !oReader.readString(sRecord.size_element_name, sElement.size_element_name))
+        {
+            return ERR_UNKNOWN_FORMAT;
+        }
+
+        sElement.alignment = static_cast<size_t>(sRecord.alignment);
+        sElement.size_element_index = static_cast<size_t>(sRecord.size_element_index);
+        sElement.size_element_dynamic_index = static_cast<size_t>(sRecord.size_element_dynamic_index);
+        RETURN_IF_FAILED(readElements(oReader, vecEnums, sRecord.static_count, NULL,
+                                      sElement.static_elements));
+        RETURN_IF_FAILED(readDynamicElements(oReader, vecEnums, sRecord.dynamic_count,
+                                             sElement.dynamic_elements));
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result PrecompiledLayouts::readLayout(size_t nIndex, StructLayout& oLayout) const
+{
+    StructEntry sEntry;
+    LayoutReader oEntryReader(_data, _data_size, _strings, _strings_size,
+                              sizeof(FileHeader) + nIndex * sizeof(StructEntry));
+    if (!oEntryReader.read(sEntry) || sEntry.layout_offset > _data_size)
+    {
+        return ERR_UNKNOWN_FORMAT;
+    }
+
+    LayoutReader oReader(_data, _data_size, _strings, _strings_size,
+                         static_cast<size_t>(sEntry.layout_offset));
+    LayoutRecord sRecord;
+    if (!oReader.read(sRecord) || !oReader.canContain<EnumRecord>(sRecord.enum_count))
+    {
+        return ERR_UNKNOWN_FORMAT;
+    }
+
+    EnumTable vecEnums;
+    for (uint32_t nEnum = 0; nEnum < sRecord.enum_count; ++nEnum)
+    {
+        EnumRecord sEnum;
+        std::string strEnumName;
+        if (!oReader.read(sEnum) || !oReader.readString(sEnum.name, strEnumName) ||
+            !oReader.canContain<EnumValueRecord>(sEnum.value_count))
+        {
+            return ERR_UNKNOWN_FORMAT;
+        }
+
+        EnumType& oEnum = oLayout._enums[strEnumName];
+        for (uint32_t nValue = 0; nValue < sEnum.value_count; ++nValue)
+        {
+            EnumValueRecord sValue;
+            std::string strName;
+            std::string strValue;
+            if (!oReader.read(sValue) || !oReader.readString(sValue.name, strName) ||
+                !oReader.readString(sValue.value, strValue))
+            {
+                return ERR_UNKNOWN_FORMAT;
+            }
+            oEnum.insert(std::make_pair(strName, a_util::variant::Variant(strValue.c_str())));
+        }
+        vecEnums.push_back(&oEnum);
+    }
+
+    RETURN_IF_FAILED(readElements(oReader, vecEnums, sRecord.static_count, &sRecord,
+                                  oLayout._static_elements));
+    RETURN_IF_FAILED(readDynamicElements(oReader, vecEnums, sRecord.dynamic_count,
+                                         oLayout._dynamic_elements));
+
+    oLayout._static_buffer_sizes.deserialized = static_cast<size_t>(sRecord.deserialized_bits);
+    oLayout._static_buffer_sizes.serialized = static_cast<size_t>(sRecord.serialized_bits);
+    oLayout.indexStaticElements();
+    oLayout._calculations_result = a_util::result::SUCCESS;
+
+    return a_util::result::SUCCESS;
+}
+
+}
@@ -0,0 +1,142 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+ */
+
+#ifndef DDL_PRECOMPILED_LAYOUTS_CLASS_HEADER
+#define DDL_PRECOMPILED_LAYOUTS_CLASS_HEADER
+
+#include <string>
+#include <unordered_map>
+
+#include "a_util/memory.h"
+#include "a_util/concurrency.h"
+#include "a_util/filesystem.h"
+#include "a_util/result.h"
+
+#include "codec_factory.h"
+
+namespace ddl
+{
+
+class DDLDescription;
+class StructLayout;
+
+/**
+ * Versioned binary file of the precalculated struct layouts of all structs of a DDL
+ * description.
+ * Such a file is written once, e.g. with the --layoutfile option of ddl2header, and later
+ * mapped into memory to create codec factories without importing the DDL description and
+ * calculating the layouts again.
+ * The file starts with a fixed header followed by a table of all structs sorted by name,
+ * so looking up a struct is a binary search within the mapped file. The layout of a struct
+ * is only read when the first factory for it is created.
+ * The file is written in the byte order of the writing host and is rejected on hosts with a
+ * different byte order.
+ */
+class PrecompiledLayouts
+{
+    public:
+        /**
+         * Empty constructor, use @ref load to read precompiled layouts.
+         */
+        PrecompiledLayouts();
+
+        /**
+         * DTOR, unmaps the file. Factories created before stay valid.
+         */
+        ~PrecompiledLayouts();
+
+        /**
+         * Writes the layouts of all structs of a description to a file.
+         * @param[in] description The DDL description.
+         * @param[in] file The file to write.
+         * @retval ERR_INVALID_ARG The layout of a struct could not be calculated.
+         * @retval ERR_OPEN_FAILED The file could not be written.
+         */
+        static a_util::result::Result writeFile(const DDLDescription& description,
+                                                const a_util::filesystem::Path& file);
+
+        /**
+         * Writes the layouts of all structs of a description to a buffer.
+         * @param[in] description The DDL description.
+         * @param[out] data The precompiled layouts.
+         * @retval ERR_INVALID_ARG The layout of a struct could not be calculated.
+         */
+        static a_util::result::Result write(const DDLDescription& description, std::string& data);
+
+        /**
+         * Maps a file that has been written with @ref writeFile.
+         * @param[in] file The file to map.
+         * @retval ERR_OPEN_FAILED The file could not be mapped.
+         * @retval ERR_UNKNOWN_FORMAT The file is no precompiled layouts file of this version.
+         */
+        a_util::result::Result load(const a_util::filesystem::Path& file);
+
+        /**
+         * Uses precompiled layouts that are already in memory, e.g. linked into the binary.
+         * The data is not copied and has to stay valid as long as this object exists.
+         * @param[in] data The precompiled layouts as written by @ref write.
+         * @param[in] data_size The size of the data.
+         * @retval ERR_UNKNOWN_FORMAT The data is no precompiled layouts of this version.
+         */
+        a_util::result::Result load(const void* data, size_t data_size);
+
+        /**
+         * @return The amount of structs with a precompiled layout.
+         */
+        size_t getStructCount() const;
+
+        /**
+         * @param[in] index The index of the struct, the structs are sorted by name.
+         * @return The name of the struct, empty for an invalid index.
+         */
+        std::string getStructName(size_t index) const;
+
+        /**
+         * Creates a codec factory from a precompiled layout.
+         * @param[in] struct_name The name of the struct.
+         * @return The factory, @ref CodecFactory::isValid returns ERR_NOT_FOUND if there
+         *         is no layout for the struct and ERR_UNKNOWN_FORMAT if it is corrupted.
+         */
+        CodecFactory createFactory(const std::string& struct_name) const;
+
+    private:
+        /// @cond nodoc
+        class MappedFile;
+
+        bool findStruct(const std::string& struct_name, size_t& index) const;
+        a_util::result::Result readLayout(size_t index, StructLayout& layout) const;
+
+        a_util::memory::unique_ptr<MappedFile> _file;
+        const char* _data;
+        size_t _data_size;
+        size_t _struct_count;
+        const char* _strings;
+        size_t _strings_size;
+        mutable a_util::concurrency::mutex _mutex;
+        mutable std::unordered_map<std::string, a_util::memory::shared_ptr<const StructLayout> > _layouts;
+
+        PrecompiledLayouts(const PrecompiledLayouts&); // = delete;
+        PrecompiledLayouts& operator=(const PrecompiledLayouts&); // = delete;
+        /// @endcond
+};
+
+}
+
+#endif
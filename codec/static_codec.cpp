@@ -30,6 +30,8 @@ namespace ddl
 //define all needed error types and values locally
 _MAKE_RESULT(-5, ERR_INVALID_ARG);
 _MAKE_RESULT(-10, ERR_INVALID_INDEX);
+_MAKE_RESULT(-19, ERR_NOT_SUPPORTED);
+_MAKE_RESULT(-20, ERR_NOT_FOUND);
 
 StaticDecoder::StaticDecoder(a_util::memory::shared_ptr<const StructLayout> pLayout,
                                const void* pData, size_t nDataSize,
@@ -39,7 +41,8 @@ StaticDecoder::StaticDecoder(a_util::memory::shared_ptr<const StructLayout> pLay
     _data_size(nDataSize),
     _element_accessor(eRep == deserialized ?
                        &DeserializedAccessor::getInstance() :
-                       &SerializedAccessor::getInstance())
+                       &SerializedAccessor::getInstance()),
+    _representation(eRep)
 {
 }
 
@@ -60,7 +63,7 @@ size_t StaticDecoder::getElementCount() const
 
 a_util::result::Result StaticDecoder::getElement(size_t nIndex, const StructElement*& pElement) const
 {
-    pElement = getLayoutElement(nIndex);
+    pElement = getNamedLayoutElement(nIndex);
     if (!pElement)
     {
         return ERR_INVALID_INDEX;
@@ -69,6 +72,19 @@ a_util::result::Result StaticDecoder::getElement(size_t nIndex, const StructElem
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result StaticDecoder::findElementIndex(const std::string& strName, size_t& nIndex) const
+{
+    const ElementNameIndex& oIndex = _layout->getStaticElementIndex();
+    ElementNameIndex::const_iterator itElement = oIndex.find(strName);
+    if (itElement == oIndex.end())
+    {
+        return ERR_NOT_FOUND;
+    }
+
+    nIndex = itElement->second;
+    return a_util::result::SUCCESS;
+}
+
 a_util::result::Result StaticDecoder::getElementValue(size_t nIndex, void* pValue) const
 {
     const StructLayoutElement* pElement = getLayoutElement(nIndex);
@@ -89,6 +105,85 @@ a_util::result::Result StaticDecoder::getElementValue(size_t nIndex, a_util::var
     return _element_accessor->getValue(*pElement, _data, _data_size, oValue);
 }
 
+a_util::result::Result StaticDecoder::getArrayValues(size_t nIndex, size_t nCount, void* pValues) const
+{
+    const StructLayoutElement* pFirst = NULL;
+    RETURN_IF_FAILED(findPackedArray(nIndex, nCount, pFirst));
+    if (pFirst)
+    {
+        return _element_accessor->getArrayValue(*pFirst, nCount, _data, _data_size, pValues);
+    }
+
+    uint8_t* pValue = static_cast<uint8_t*>(pValues);
+    for (size_t nElement = nIndex; nElement < nIndex + nCount; ++nElement)
+    {
+        const StructLayoutElement* pElement = getLayoutElement(nElement);
+        RETURN_IF_FAILED(_element_accessor->getValue(*pElement, _data, _data_size, pValue));
+        pValue += pElement->deserialized.bit_size / 8;
+    }
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result StaticDecoder::findPackedArray(size_t nIndex, size_t nCount,
+                                                      const StructLayoutElement*& pFirst) const
+{
+    pFirst = NULL;
+    if (nCount == 0)
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    const StructLayoutElement* pElement = getLayoutElement(nIndex);
+    if (!pElement || !getLayoutElement(nIndex + nCount - 1))
+    {
+        return ERR_INVALID_INDEX;
+    }
+
+    // every value has to occupy its full size in both representations
+    if (pElement->serialized.bit_size != pElement->deserialized.bit_size ||
+        pElement->deserialized.bit_offset % 8 != 0)
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    for (size_t nElement = 1; nElement < nCount; ++nElement)
+    {
+        const StructLayoutElement* pNext = getLayoutElement(nIndex + nElement);
+        if (pNext->type != pElement->type ||
+            pNext->byte_order != pElement->byte_order ||
+            pNext->serialized.bit_size != pElement->serialized.bit_size ||
+            pNext->deserialized.bit_size != pElement->deserialized.bit_size ||
+            pNext->serialized.bit_offset != pElement->serialized.bit_offset + nElement * pElement->serialized.bit_size ||
+            pNext->deserialized.bit_offset != pElement->deserialized.bit_offset + nElement * pElement->deserialized.bit_size)
+        {
+            return a_util::result::SUCCESS;
+        }
+    }
+
+    pFirst = pElement;
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result StaticDecoder::writeArrayValues(void* pData, size_t nIndex, size_t nCount,
+                                                       const void* pValues) const
+{
+    const StructLayoutElement* pFirst = NULL;
+    RETURN_IF_FAILED(findPackedArray(nIndex, nCount, pFirst));
+    if (pFirst)
+    {
+        return _element_accessor->setArrayValue(*pFirst, nCount, pData, _data_size, pValues);
+    }
+
+    const uint8_t* pValue = static_cast<const uint8_t*>(pValues);
+    for (size_t nElement = nIndex; nElement < nIndex + nCount; ++nElement)
+    {
+        const StructLayoutElement* pElement = getLayoutElement(nElement);
+        RETURN_IF_FAILED(_element_accessor->setValue(*pElement, pData, _data_size, pValue));
+        pValue += pElement->deserialized.bit_size / 8;
+    }
+    return a_util::result::SUCCESS;
+}
+
 const void* StaticDecoder::getElementAddress(size_t nIndex) const
 {
     const StructLayoutElement* pElement = getLayoutElement(nIndex);
@@ -119,6 +214,11 @@ const void* StaticDecoder::getElementAddress(size_t nIndex) const
     return static_cast<const uint8_t*>(_data) + (nBitPos / 8);
 }
 
+const DynamicLayout* StaticDecoder::getDynamicLayout() const
+{
+    return NULL;
+}
+
 const StructLayoutElement* StaticDecoder::getLayoutElement(size_t nIndex) const
 {
     const StructLayoutElement* pElement = NULL;
@@ -130,6 +230,11 @@ const StructLayoutElement* StaticDecoder::getLayoutElement(size_t nIndex) const
     return pElement;
 }
 
+const StructLayoutElement* StaticDecoder::getNamedLayoutElement(size_t nIndex) const
+{
+    return getLayoutElement(nIndex);
+}
+
 size_t StaticDecoder::getStaticBufferSize(DataRepresentation eRep) const
 {
     return _layout->getStaticBufferSize(eRep);
@@ -137,7 +242,14 @@ size_t StaticDecoder::getStaticBufferSize(DataRepresentation eRep) const
 
 DataRepresentation StaticDecoder::getRepresentation() const
 {
-    return _element_accessor->getRepresentation();
+    return _representation;
+}
+
+a_util::result::Result StaticDecoder::rebind(const void* pData, size_t nDataSize)
+{
+    _data = pData;
+    _data_size = nDataSize;
+    return a_util::result::SUCCESS;
 }
 
 StaticCodec::StaticCodec(a_util::memory::shared_ptr<const StructLayout> pLayout,
@@ -170,6 +282,11 @@ a_util::result::Result StaticCodec::setElementValue(size_t nIndex, const a_util:
                                         _data_size, oValue);
 }
 
+a_util::result::Result StaticCodec::setArrayValues(size_t nIndex, size_t nCount, const void* pValues)
+{
+    return writeArrayValues(const_cast<void*>(_data), nIndex, nCount, pValues);
+}
+
 void* StaticCodec::getElementAddress(size_t nIndex)
 {
     return const_cast<void*>(StaticDecoder::getElementAddress(nIndex));
@@ -194,5 +311,14 @@ a_util::result::Result StaticCodec::setConstants()
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result StaticCodec::rebind(void* pData, size_t nDataSize)
+{
+    return StaticDecoder::rebind(pData, nDataSize);
+}
+
+a_util::result::Result StaticCodec::rebind(const void* /*pData*/, size_t /*nDataSize*/)
+{
+    return ERR_NOT_SUPPORTED;
+}
 
 }
@@ -26,13 +26,20 @@
 #include "a_util/memory.h"
 
 #include "struct_element.h"
+#include "element_handle.h"
 
 namespace ddl
 {
 
 class StructLayout;
+class DynamicLayout;
 class ElementAccessor;
 
+namespace serialization
+{
+class TransformPlan;
+}
+
 /**
  * Decoder for static structures defined by a DDL definition.
  */
@@ -78,6 +85,14 @@ class StaticDecoder
          */
         a_util::result::Result getElement(size_t index, const StructElement*& element) const;
 
+        /**
+         * Find the index of an element by name.
+         * @param[in] name The full name of the element.
+         * @param[out] index The index of the element.
+         * @retval ERR_NOT_FOUND No element with the requested name was found.
+         */
+        virtual a_util::result::Result findElementIndex(const std::string& name, size_t& index) const;
+
         /**
          * Returns the current value of the given element by copying its data
          * to the passed-in location.
@@ -95,6 +110,30 @@ class StaticDecoder
          */
         a_util::result::Result getElementValue(size_t index, a_util::variant::Variant& value) const;
 
+        /**
+         * Copies the current values of consecutive elements, e.g. of an array, to the
+         * passed-in location. Elements of the same type and byte order that follow each
+         * other without gaps are converted at once, with vectorized byte swapping
+         * for big endian data.
+         * @param[in] index The index of the first element.
+         * @param[in] count The amount of elements.
+         * @param[out] values The location where the values should be copied to, one after
+         *                    another in their deserialized size.
+         * @retval ERR_INVALID_INDEX Invalid element index.
+         */
+        a_util::result::Result getArrayValues(size_t index, size_t count, void* values) const;
+
+        /**
+         * Returns the current value of the element referenced by the given handle.
+         * @param[in] handle The handle of the element, see @ref CodecFactory::resolve.
+         * @return The value of the element.
+         */
+        template <typename T>
+        T getValue(const ElementHandle<T>& handle) const
+        {
+            return handle.read(_data, _data_size, _representation);
+        }
+
         /**
          * @param[in] index The index of the element.
          * @return A pointer to the element or NULL in case of an error.
@@ -107,6 +146,16 @@ class StaticDecoder
          */
         size_t getStaticBufferSize(DataRepresentation rep = deserialized) const;
 
+        /**
+         * Binds the decoder to new data with the same layout and representation.
+         * All other state is kept, so no memory is allocated.
+         * @param[in] data The pointer to the new raw data.
+         * @param[in] data_size The size of the new raw data.
+         * @return Standard result. Use @ref isValid to check whether the data is large enough.
+         * @retval ERR_NOT_SUPPORTED The decoder is a codec, those can not be bound to read-only data.
+         */
+        virtual a_util::result::Result rebind(const void* data, size_t data_size);
+
         /**
          * @return The data representation which this decoder handles.
          */
@@ -114,6 +163,7 @@ class StaticDecoder
 
     protected:
         friend class CodecFactory;
+        friend class serialization::TransformPlan;
 
         /// For internal use only. @internal
         StaticDecoder(a_util::memory::shared_ptr<const StructLayout> layout,
@@ -121,6 +171,16 @@ class StaticDecoder
                        DataRepresentation rep);
         /// For internal use only. @internal
         virtual const StructLayoutElement* getLayoutElement(size_t index) const;
+        /// For internal use only. @internal Same as getLayoutElement but with the element name set.
+        virtual const StructLayoutElement* getNamedLayoutElement(size_t index) const;
+        /// For internal use only. @internal NULL for static structures.
+        virtual const DynamicLayout* getDynamicLayout() const;
+        /// For internal use only. @internal Sets first to NULL if the elements are not packed.
+        a_util::result::Result findPackedArray(size_t index, size_t count,
+                                               const StructLayoutElement*& first) const;
+        /// For internal use only. @internal
+        a_util::result::Result writeArrayValues(void* data, size_t index, size_t count,
+                                                const void* values) const;
 
     protected:
         /// For internal use only. @internal
@@ -131,6 +191,8 @@ class StaticDecoder
         size_t _data_size;
         /// For internal use only. @internal
         const ElementAccessor* _element_accessor;
+        /// For internal use only. @internal
+        DataRepresentation _representation;
 };
 
 /**
@@ -156,6 +218,28 @@ class StaticCodec: public StaticDecoder
          */
         a_util::result::Result setElementValue(size_t index, const a_util::variant::Variant& value);
 
+        /**
+         * Sets the current values of consecutive elements, e.g. of an array, by copying
+         * them from the passed-in location.
+         * @param[in] index The index of the first element.
+         * @param[in] count The amount of elements.
+         * @param[in] values The location where the values should be copied from, one after
+         *                   another in their deserialized size.
+         * @retval ERR_INVALID_INDEX Invalid element index.
+         */
+        a_util::result::Result setArrayValues(size_t index, size_t count, const void* values);
+
+        /**
+         * Sets the current value of the element referenced by the given handle.
+         * @param[in] handle The handle of the element, see @ref CodecFactory::resolve.
+         * @param[in] value The new value.
+         */
+        template <typename T>
+        void setValue(const ElementHandle<T>& handle, typename ElementHandle<T>::value_type value)
+        {
+            handle.write(const_cast<void*>(_data), _data_size, _representation, value);
+        }
+
         /**
          * @param[in] index The index of the element.
          * @return A pointer to the element or NULL in case of an error.
@@ -169,6 +253,18 @@ class StaticCodec: public StaticDecoder
          */
         a_util::result::Result setConstants();
 
+        /**
+         * Binds the codec to new data with the same layout and representation.
+         * @param[in] data The pointer to the new raw data.
+         * @param[in] data_size The size of the new raw data.
+         * @return Standard result. Use @ref isValid to check whether the data is large enough.
+         */
+        a_util::result::Result rebind(void* data, size_t data_size);
+
+    private:
+        /// A codec can not be bound to read-only data, fails when called through a decoder.
+        virtual a_util::result::Result rebind(const void* data, size_t data_size);
+
     private:
         friend class CodecFactory;
         /// For internal use only. @internal
@@ -23,6 +23,8 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <vector>
 #include "a_util/variant.h"
 #include "a_util/result.h"
 
@@ -80,11 +82,22 @@ struct DynamicStructLayoutElement
         std::string size_element_name;
         std::vector<StructLayoutElement> static_elements;
         std::vector<DynamicStructLayoutElement> dynamic_elements;
-
-        DynamicStructLayoutElement() = default;
+        // the size element is either the static element size_element_index of the enclosing
+        // struct or, if size_element_dynamic_index is set, the static element
+        // size_element_index of the preceding dynamic element size_element_dynamic_index
+        size_t size_element_index;
+        size_t size_element_dynamic_index;
+
+        DynamicStructLayoutElement():
+            size_element_index(static_cast<size_t>(-1)),
+            size_element_dynamic_index(static_cast<size_t>(-1))
+        {
+        }
 
         DynamicStructLayoutElement(size_t alignment):
-            alignment(alignment)
+            alignment(alignment),
+            size_element_index(static_cast<size_t>(-1)),
+            size_element_dynamic_index(static_cast<size_t>(-1))
         {
         }
 
@@ -105,6 +118,8 @@ struct Offsets
     size_t serialized;
 };
 
+typedef std::unordered_map<std::string, size_t> ElementNameIndex;
+
 /**
  * \endcond INTERNAL
  */
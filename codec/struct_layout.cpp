@@ -22,6 +22,7 @@
 #include "legacy_error_macros.h"
 
 #include "struct_layout.h"
+#include "dynamic_layout.h"
 
 #include <ddl.h>
 
@@ -32,7 +33,8 @@ _MAKE_RESULT(-5, ERR_INVALID_ARG);
 _MAKE_RESULT(-19, ERR_NOT_SUPPORTED);
 _MAKE_RESULT(-37, ERR_NOT_INITIALIZED);
 
-StructLayout::StructLayout(const DDLComplex* pStruct)
+StructLayout::StructLayout(const DDLComplex* pStruct):
+    _dynamic_layout_cache(new DynamicLayoutCache())
 {
     _static_buffer_sizes.deserialized = 0;
     _static_buffer_sizes.serialized = 0;
@@ -40,7 +42,8 @@ StructLayout::StructLayout(const DDLComplex* pStruct)
 }
 
 StructLayout::StructLayout():
-    _calculations_result(ERR_NOT_INITIALIZED)
+    _calculations_result(ERR_NOT_INITIALIZED),
+    _dynamic_layout_cache(new DynamicLayoutCache())
 {
     _static_buffer_sizes.deserialized = 0;
     _static_buffer_sizes.serialized = 0;
@@ -318,6 +321,66 @@ class cConverter
         std::map<std::string, EnumType>& _enums;
 };
 
+static bool isSizeElement(const DynamicStructLayoutElement& sDynamicElement,
+                          const StructLayoutElement& sStaticElement,
+                          const std::string& strSizeElementName)
+{
+    if (sStaticElement.name.empty())
+    {
+        return sDynamicElement.name == strSizeElementName;
+    }
+    return sDynamicElement.name + "." + sStaticElement.name == strSizeElementName;
+}
+
+/**
+ * Resolves the size elements of all dynamic arrays so that they can be found without
+ * name lookups when the dynamic elements are expanded.
+ */
+static void resolveSizeElements(const std::vector<StructLayoutElement>& vecStaticElements,
+                                std::vector<DynamicStructLayoutElement>& vecDynamicElements)
+{
+    for (size_t nDynamicElement = 0; nDynamicElement < vecDynamicElements.size(); ++nDynamicElement)
+    {
+        DynamicStructLayoutElement& sDynamicElement = vecDynamicElements[nDynamicElement];
+        if (sDynamicElement.isDynamicArray())
+        {
+            for (size_t nElement = 0; nElement < vecStaticElements.size(); ++nElement)
+            {
+                if (vecStaticElements[nElement].name == sDynamicElement.size_element_name)
+                {
+                    sDynamicElement.size_element_index = nElement;
+                    break;
+                }
+            }
+
+            // the size element might also follow another dynamic array
+            for (size_t nSibling = 0;
+                 sDynamicElement.size_element_index == static_cast<size_t>(-1) && nSibling < nDynamicElement;
+                 ++nSibling)
+            {
+                const DynamicStructLayoutElement& sSibling = vecDynamicElements[nSibling];
+                if (sSibling.isAlignmentElement() || sSibling.isDynamicArray())
+                {
+                    continue;
+                }
+
+                for (size_t nElement = 0; nElement < sSibling.static_elements.size(); ++nElement)
+                {
+                    if (isSizeElement(sSibling, sSibling.static_elements[nElement],
+                                      sDynamicElement.size_element_name))
+                    {
+                        sDynamicElement.size_element_index = nElement;
+                        sDynamicElement.size_element_dynamic_index = nSibling;
+                        break;
+                    }
+                }
+            }
+        }
+
+        resolveSizeElements(sDynamicElement.static_elements, sDynamicElement.dynamic_elements);
+    }
+}
+
 a_util::result::Result StructLayout::calculate(const DDLComplex* pStruct)
 {
     cConverter oConverter(_static_elements,
@@ -325,10 +388,23 @@ a_util::result::Result StructLayout::calculate(const DDLComplex* pStruct)
                           _enums);
     RETURN_IF_FAILED(oConverter.Convert(const_cast<DDLComplex*>(pStruct)));
     _static_buffer_sizes = oConverter.getStaticBufferBitSizes();
+    resolveSizeElements(_static_elements, _dynamic_elements);
+    indexStaticElements();
 
     return a_util::result::SUCCESS;
 }
 
+void StructLayout::indexStaticElements()
+{
+    // the first element with a given name wins, just like a linear search would
+    _static_element_index.clear();
+    _static_element_index.reserve(_static_elements.size());
+    for (size_t nElement = 0; nElement < _static_elements.size(); ++nElement)
+    {
+        _static_element_index.insert(std::make_pair(_static_elements[nElement].name, nElement));
+    }
+}
+
 size_t StructLayout::getStaticBufferSize(DataRepresentation eRep) const
 {
     size_t nResult = eRep == deserialized ?
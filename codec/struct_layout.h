@@ -21,12 +21,16 @@
 #ifndef DDL_STRUCT_LAYOUT_CLASS_HEADER
 #define DDL_STRUCT_LAYOUT_CLASS_HEADER
 
+#include "a_util/memory.h"
+
 #include "struct_element.h"
 
 namespace ddl
 {
 
 class DDLComplex;
+class DynamicLayoutCache;
+class PrecompiledLayouts;
 
 /**
  * @internal
@@ -48,6 +52,11 @@ class StructLayout
             return _static_elements;
         }
 
+        const ElementNameIndex& getStaticElementIndex() const
+        {
+            return _static_element_index;
+        }
+
         const std::vector<DynamicStructLayoutElement>& getDynamicElements() const
         {
             return _dynamic_elements;
@@ -68,17 +77,26 @@ class StructLayout
             return _static_buffer_sizes;
         }
 
-        size_t getStaticBufferSize(DataRepresentation rep) const;        
+        size_t getStaticBufferSize(DataRepresentation rep) const;
+
+        DynamicLayoutCache& getDynamicLayoutCache() const
+        {
+            return *_dynamic_layout_cache;
+        }
 
     private:
+        friend class PrecompiledLayouts;
         a_util::result::Result calculate(const DDLComplex* ddl_struct);
+        void indexStaticElements();
 
     private:
         std::vector<StructLayoutElement> _static_elements;
+        ElementNameIndex _static_element_index;
         std::vector<DynamicStructLayoutElement> _dynamic_elements;
         std::map<std::string, EnumType> _enums;
         Offsets _static_buffer_sizes;
         a_util::result::Result _calculations_result;
+        a_util::memory::shared_ptr<DynamicLayoutCache> _dynamic_layout_cache;
 };
 
 }
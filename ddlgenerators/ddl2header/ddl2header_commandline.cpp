@@ -36,6 +36,7 @@ namespace ddl
     {
         _cli |= getNamespaceOpt();
         _cli |= getDisplaceableStringOpt();
+        _cli |= getLayoutFileOpt();
     }
 
     std::string DDL2HeaderCommandLine::getNamespace()
@@ -48,6 +49,27 @@ namespace ddl
         return _opt_displaceable_string;
     }
 
+    std::string DDL2HeaderCommandLine::getLayoutFile()
+    {
+        return _opt_layout_file;
+    }
+
+    a_util::result::Result DDL2HeaderCommandLine::checkMandatoryArguments()
+    {
+        // the header file may be omitted if only the layouts are requested
+        if (!_opt_layout_file.empty() && _opt_header_file.empty())
+        {
+            if (_opt_description_file.empty())
+            {
+                std::cerr << "Error: No option 'descriptionfile' is set. " <<
+                    "Please use option '--help' for further information." << std::endl;
+                return ERR_INVALID_ARG;
+            }
+            return ERR_NOERROR;
+        }
+        return CommandLine::checkMandatoryArguments();
+    }
+
     void DDL2HeaderCommandLine::printExamples()
     {
         std::cout << std::endl << "If the target header file exists already the descriptions will be merged." << std::endl;
@@ -59,6 +81,9 @@ namespace ddl
         std::cout << "  --headerfile=c:/myHeaderFile.h " <<
             "--descriptionfile=c:/myDescriptionFile.description ";
         std::cout << "-struct=tMyStruct" << std::endl;
+        std::cout << "  or" << std::endl;
+        std::cout << "  --descriptionfile=c:/myDescriptionFile.description " <<
+            "--layoutfile=c:/myDescriptionFile.layouts" << std::endl;
     }
 
     clara::Opt DDL2HeaderCommandLine::getNamespaceOpt()
@@ -76,4 +101,12 @@ namespace ddl
 
     }
 
+    clara::Opt DDL2HeaderCommandLine::getLayoutFileOpt()
+    {
+        return clara::Opt(_opt_layout_file, "path")
+            ["--layoutfile"]
+            ("[Optional] Additionally write the precompiled struct layouts of the description to this file. "
+             "The headerfile may be omitted then.");
+    }
+
 }
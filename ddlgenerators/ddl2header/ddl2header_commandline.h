@@ -31,15 +31,19 @@ namespace ddl
 
         std::string getNamespace();
         std::string getDisplaceableString();
+        std::string getLayoutFile();
+        a_util::result::Result checkMandatoryArguments();
 
     protected:
         void printExamples();
 
         clara::Opt getNamespaceOpt();
         clara::Opt getDisplaceableStringOpt();
+        clara::Opt getLayoutFileOpt();
 
         std::string _opt_namespace;
         std::string _opt_displaceable_string;
+        std::string _opt_layout_file;
        
     };
 }
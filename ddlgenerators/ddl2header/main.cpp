@@ -54,12 +54,24 @@ int main(int argc, char* argv[])
     }
 
     DDLUtilsCore core;
-    a_util::result::Result res = core.generateHeaderFile(cmdLine.getDescriptionFile(), 
-        cmdLine.getHeaderFile(), cmdLine.getStruct(), cmdLine.getNamespace(), 
-        cmdLine.getDisplaceableString());
-    if (a_util::result::isFailed(res))
+    a_util::result::Result res = ERR_NOERROR;
+    if (!cmdLine.getHeaderFile().empty())
     {
-        LOG_ERROR("Error: An error occured during generating the header file.");
+        res = core.generateHeaderFile(cmdLine.getDescriptionFile(), 
+            cmdLine.getHeaderFile(), cmdLine.getStruct(), cmdLine.getNamespace(), 
+            cmdLine.getDisplaceableString());
+        if (a_util::result::isFailed(res))
+        {
+            LOG_ERROR("Error: An error occured during generating the header file.");
+        }
+    }
+    if (a_util::result::isOk(res) && !cmdLine.getLayoutFile().empty())
+    {
+        res = core.generateLayoutFile(cmdLine.getDescriptionFile(), cmdLine.getLayoutFile());
+        if (a_util::result::isFailed(res))
+        {
+            LOG_ERROR("Error: An error occured during generating the layout file.");
+        }
     }
     return res.getErrorCode();
 }
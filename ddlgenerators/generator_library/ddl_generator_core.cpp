@@ -138,6 +138,37 @@ a_util::result::Result DDLUtilsCore::generateHeaderFile(const a_util::filesystem
     return ERR_NOERROR;
 }
 
+a_util::result::Result DDLUtilsCore::generateLayoutFile(const a_util::filesystem::Path& description_path,
+    const a_util::filesystem::Path& layout_path)
+{
+    if (a_util::result::isFailed(checkIfFileExists(description_path)))
+    {
+        LOG_INFO(a_util::strings::format("Error: Description file '%s' not found.",
+            description_path.toString().c_str()).c_str());
+        return ERR_PATH_NOT_FOUND;
+    }
+
+    ddl::DDLImporter ddl_importer;
+    if (a_util::result::isFailed(ddl_importer.setFile(description_path)) ||
+        a_util::result::isFailed(ddl_importer.createNew()))
+    {
+        LOG_INFO(ddl_importer.getErrorDesc().c_str());
+        return ERR_INVALID_FILE;
+    }
+
+    ddl::DDLDescription* description = ddl_importer.getDDL();
+    a_util::result::Result res = ddl::PrecompiledLayouts::writeFile(*description, layout_path);
+    ddl::DDLImporter::destroyDDL(description);
+    if (a_util::result::isFailed(res))
+    {
+        LOG_INFO("Error: Could not create layout file.");
+        return ERR_FAILED;
+    }
+
+    LOG_INFO("Success: Layout file created.");
+    return ERR_NOERROR;
+}
+
 a_util::result::Result DDLUtilsCore::setDescription(const a_util::filesystem::Path& description_path,
     std::string& error_msg, const std::string struct_name)
 {
@@ -62,6 +62,14 @@ public:
     */
     a_util::result::Result generateHeaderFile(const a_util::filesystem::Path& description_path, 
         const a_util::filesystem::Path& header_path, const std::string struct_name = "", const std::string name_space = "", const std::string displace = "");
+    /**
+    * Create precompiled struct layouts from ddl file
+    * @param[in] description_path    - path to the ddl file
+    * @param[in] layout_path         - path to the layout file
+    * @retval ERR_NOERROR Everything went as expected.
+    */
+    a_util::result::Result generateLayoutFile(const a_util::filesystem::Path& description_path,
+        const a_util::filesystem::Path& layout_path);
 
 private:
     /**
@@ -59,9 +59,13 @@ DDLContainerNoClone<T>::DDLContainerNoClone(bool sorted): _sorted(sorted)
 template <typename T>
 void DDLContainerNoClone<T>::insert(T* elem, int pos)
 {
+    size_t insert_pos = _pointers.size();
     if (_sorted)
     {
-        _pointers.insert(std::lower_bound(_pointers.begin(), _pointers.end(), elem, LessCompare<T>()), elem);
+        typename std::vector<T*>::iterator it =
+            std::lower_bound(_pointers.begin(), _pointers.end(), elem, LessCompare<T>());
+        insert_pos = it - _pointers.begin();
+        _pointers.insert(it, elem);
     }
     else
     {
@@ -69,6 +73,7 @@ void DDLContainerNoClone<T>::insert(T* elem, int pos)
             static_cast<typename std::vector<T*>::size_type>(pos);
         if (0 <= sz_pos && sz_pos < _pointers.size())
         {
+            insert_pos = sz_pos;
             _pointers.insert(_pointers.begin() + sz_pos, elem);
         }
         else
@@ -76,107 +81,137 @@ void DDLContainerNoClone<T>::insert(T* elem, int pos)
             _pointers.push_back(elem);
         }
     }
+
+    addEntry(elem, insert_pos);
 }
 
 template <typename T>
 typename DDLContainerNoClone<T>::iterator DDLContainerNoClone<T>::findIt(const std::string& name)
 {
-  if (_sorted)
-  {
-      iterator it = std::lower_bound(this->begin(), this->end(), name, LessCompare<T>());
-      if (this->end() == it || name != (*it)->getName())
-      {
-          // not found
-          return this->end();
-      }
-      return it;
-  }
-  else
-  {
-      iterator it = std::find_if(this->begin(), this->end(), DDLCompareFunctor<>(name));
-      if (this->end() == it)
-      {
-          // not found
-          return this->end();
-      }
-      return it;
-  }
-}
+    typename std::unordered_map<std::string, IndexEntry>::const_iterator it_entry = _index.find(name);
+    if (_index.end() == it_entry)
+    {
+        // not found
+        return this->end();
+    }
 
-template <typename T>
-const T* DDLContainerNoClone<T>::find(const std::string& name) const
-{
+    T* elem = it_entry->second.first;
     if (_sorted)
     {
-        return find_sorted(name);
+        iterator it = std::lower_bound(this->begin(), this->end(), name, LessCompare<T>());
+        if (this->end() != it && *it == elem)
+        {
+            return it;
+        }
     }
-    return find_unsorted(name);
+    // positions are not indexed, they change with every insertion and removal
+    return std::find(this->begin(), this->end(), elem);
 }
 
 template <typename T>
-T* DDLContainerNoClone<T>::find(const std::string& name)
+const T* DDLContainerNoClone<T>::find(const std::string& name) const
 {
-    if (_sorted)
+    typename std::unordered_map<std::string, IndexEntry>::const_iterator it_entry = _index.find(name);
+    if (_index.end() == it_entry)
     {
-        return find_sorted(name);
+        // not found
+        return NULL;
     }
-    return find_unsorted(name);
+    return it_entry->second.first;
 }
 
 template <typename T>
-const T* DDLContainerNoClone<T>::find_unsorted(const std::string& name) const
+T* DDLContainerNoClone<T>::find(const std::string& name)
 {
-
-    const_iterator it = std::find_if(this->begin(), this->end(), DDLCompareFunctor<>(name));
-    if (this->end() == it)
+    typename std::unordered_map<std::string, IndexEntry>::const_iterator it_entry = _index.find(name);
+    if (_index.end() == it_entry)
     {
         // not found
         return NULL;
     }
-    return *it;
+    return it_entry->second.first;
 }
 
 template <typename T>
-const T* DDLContainerNoClone<T>::find_sorted(const std::string& name) const
+void DDLContainerNoClone<T>::addEntry(T* elem, size_t pos)
 {
+    if (NULL == elem)
+    {
+        return;
+    }
 
-    const_iterator it = std::lower_bound(this->begin(), this->end(), name, LessCompare<T>());
-    if (this->end() == it || name != (*it)->getName())
+    std::pair<typename std::unordered_map<std::string, IndexEntry>::iterator, bool> entry =
+        _index.insert(std::make_pair(elem->getName(), IndexEntry()));
+    IndexEntry& index_entry = entry.first->second;
+    // the first one of several elements with the same name wins,
+    // only elements with duplicate names need to compare positions
+    if (0 == index_entry.count ||
+        _pointers.begin() + pos == std::find(_pointers.begin(), _pointers.begin() + pos, index_entry.first))
     {
-        // not found
-        return find_unsorted(name);
+        index_entry.first = elem;
+    }
+    ++index_entry.count;
+
+    ElementEntry& element_entry = _elements[elem];
+    if (0 == element_entry.count++)
+    {
+        element_entry.name = entry.first->first;
     }
-    return *it;
 }
 
 template <typename T>
-T* DDLContainerNoClone<T>::find_unsorted(const std::string& name)
+void DDLContainerNoClone<T>::removeEntry(const T* elem)
 {
+    typename std::unordered_map<const T*, ElementEntry>::iterator it_element = _elements.find(elem);
+    if (_elements.end() == it_element)
+    {
+        // NULL or not indexed
+        return;
+    }
 
-    iterator it = std::find_if(this->begin(), this->end(), DDLCompareFunctor<>(name));
-    if (end() == it)
+    typename std::unordered_map<std::string, IndexEntry>::iterator it_entry =
+        _index.find(it_element->second.name);
+    if (0 == --it_element->second.count)
     {
-        // not found
-        return NULL;
+        _elements.erase(it_element);
+    }
+    if (_index.end() == it_entry)
+    {
+        return;
+    }
+
+    IndexEntry& index_entry = it_entry->second;
+    if (0 == --index_entry.count)
+    {
+        _index.erase(it_entry);
+    }
+    else if (index_entry.first == elem)
+    {
+        // the next element with the same name, found by the names of the index,
+        // because the remaining elements might have been deleted already as well
+        for (typename std::vector<T*>::const_iterator it = _pointers.begin(); it != _pointers.end(); ++it)
+        {
+            typename std::unordered_map<const T*, ElementEntry>::const_iterator it_other = _elements.find(*it);
+            if (_elements.end() != it_other && it_other->second.name == it_entry->first)
+            {
+                index_entry.first = *it;
+                break;
+            }
+        }
     }
-    return *it;
 }
 
 template <typename T>
-T* DDLContainerNoClone<T>::find_sorted(const std::string& name)
+void DDLContainerNoClone<T>::rebuildIndex()
 {
-    iterator it = std::lower_bound(this->begin(), this->end(), name, LessCompare<T>());
-    if (end() == it || name != (*it)->getName())
+    _index.clear();
+    _elements.clear();
+    _index.reserve(_pointers.size());
+    _elements.reserve(_pointers.size());
+    for (size_t pos = 0; pos < _pointers.size(); ++pos)
     {
-        // not found
-        auto obj = find_unsorted(name);
-        if (obj != nullptr)
-        {
-            sort();
-        }
-        return obj;
+        addEntry(_pointers[pos], pos);
     }
-    return *it;
 }
 
 template <typename T>
@@ -184,6 +219,8 @@ void DDLContainerNoClone<T>::copyFromRef(DDLContainerNoClone& other)
 {
   _pointers.resize(other.size());
   std::copy(other.begin(), other.end(), _pointers.begin());
+  _index = other._index;
+  _elements = other._elements;
   if (_sorted && !other._sorted)
   {
       sort();
@@ -206,6 +243,40 @@ void DDLContainerNoClone<T>::deleteAll()
 void DDLContainerNoClone<T>::sort()
 {
   std::sort(_pointers.begin(), _pointers.end(), LessCompare<T>());
+  if (_index.size() < _pointers.size())
+  {
+      // the first one of several elements with the same name might have changed
+      rebuildIndex();
+  }
+}
+
+template <typename T>
+void DDLContainerNoClone<T>::reindex()
+{
+    if (_sorted)
+    {
+        sort();
+    }
+    else
+    {
+        rebuildIndex();
+    }
+}
+
+template <typename T>
+void DDLContainerNoClone<T>::reindex(T* elem)
+{
+    iterator it = std::find(begin(), end(), elem);
+    if (end() == it)
+    {
+        return;
+    }
+
+    // insert it again, sorted containers look up its new position by its new name
+    size_t pos = it - begin();
+    _pointers.erase(_pointers.begin() + pos);
+    removeEntry(elem);
+    insert(elem, static_cast<int>(pos));
 }
 
 template <typename T>
@@ -301,12 +372,19 @@ template <typename T>
 void DDLContainerNoClone<T>::clear()
 {
     _pointers.clear();
+    _index.clear();
+    _elements.clear();
 }
 
 template <typename T>
 typename DDLContainerNoClone<T>::iterator DDLContainerNoClone<T>::erase(iterator it)
 {
-    typename std::vector<T*>::iterator it_helper = _pointers.erase(_pointers.begin() + (it - begin()));
+    // The erased element is not accessed, it might have been deleted already.
+    size_t pos = it - begin();
+    T* elem = *it;
+    _pointers.erase(_pointers.begin() + pos);
+    removeEntry(elem);
+    typename std::vector<T*>::iterator it_helper = _pointers.begin() + pos;
 #if defined(WIN32) && ((_MSC_VER < 1600) || defined(_DEBUG))
     // have a look at http://www.open-std.org/jtc1/sc22/wg21/docs/lwg-defects.html#464 and
     // http://stackoverflow.com/questions/3829788/using-operator-on-empty-stdvector
@@ -339,11 +417,18 @@ typename DDLContainerNoClone<T>::iterator DDLContainerNoClone<T>::erase(iterator
 
     // another bug in MSVS Debug http://connect.microsoft.com/VisualStudio/feedback/details/557029/visual-c-iterator-debugging-incorrectly-raises-assertion-on-correct-use-of-return-value-of-std-vector-erase
     // prevents us from using the erase(start, end) version.
-    typename std::vector<T*>::iterator it_helper = _pointers.begin() + (pos_first - begin());
+    size_t pos = pos_first - begin();
+    std::vector<T*> erased(pos_first, pos_last);
     for (uint64_t nCount = pos_last - pos_first; nCount > 0; --nCount)
     {
-        it_helper = _pointers.erase(it_helper);
+        _pointers.erase(_pointers.begin() + pos);
+    }
+    // like erase(iterator), the erased elements are not accessed
+    for (typename std::vector<T*>::const_iterator it = erased.begin(); it != erased.end(); ++it)
+    {
+        removeEntry(*it);
     }
+    typename std::vector<T*>::iterator it_helper = _pointers.begin() + pos;
 
     if (it_helper == _pointers.end())
     {
@@ -354,9 +439,15 @@ typename DDLContainerNoClone<T>::iterator DDLContainerNoClone<T>::erase(iterator
         return &*it_helper;
     }
 #else
-    typename std::vector<T*>::iterator it_helper = _pointers.erase(_pointers.begin() + (pos_first - begin()),
-                                                                      _pointers.begin() + (pos_last - begin()));
-    return &*it_helper;
+    size_t pos = pos_first - begin();
+    std::vector<T*> erased(pos_first, pos_last);
+    _pointers.erase(_pointers.begin() + pos, _pointers.begin() + (pos_last - begin()));
+    // like erase(iterator), the erased elements are not accessed
+    for (typename std::vector<T*>::const_iterator it = erased.begin(); it != erased.end(); ++it)
+    {
+        removeEntry(*it);
+    }
+    return &*(_pointers.begin() + pos);
 #endif
 }
 
@@ -20,6 +20,8 @@
 #ifndef DDL_CONTAINER_H_INCLUDED
 #define DDL_CONTAINER_H_INCLUDED
 
+#include <unordered_map>
+
 #include "ddl_common.h"
 #include "ddl_intf.h"
 
@@ -41,7 +43,25 @@ template <typename T>
 class DDLContainerNoClone
 {
     private:
+        /// Index entry of a name
+        struct IndexEntry
+        {
+            T* first;       ///< the first element with the name
+            size_t count;   ///< the amount of elements with the name
+        };
+
+        /// Index entry of an element
+        struct ElementEntry
+        {
+            std::string name;   ///< the name the element has been indexed with
+            size_t count;       ///< how often the element is stored
+        };
+
         std::vector<T*> _pointers;
+        /// name -> first element with that name, unaffected by the positions of the elements
+        std::unordered_map<std::string, IndexEntry> _index;
+        /// element -> its name, so removing an element does not need to access it
+        std::unordered_map<const T*, ElementEntry> _elements;
         bool _sorted;
 
         #if defined(WIN32) && ((_MSC_VER < 1600) || defined(_DEBUG))
@@ -60,7 +80,7 @@ class DDLContainerNoClone
 
         /**
          * Constructor
-         * @param [in] sorted whether the items should be sorted by name (this improves access times)
+         * @param [in] sorted whether the items should be sorted by name
          */
         DDLContainerNoClone(bool sorted = true);
 
@@ -73,21 +93,27 @@ class DDLContainerNoClone
         void insert(T* elem, int pos = -1);
 
         /**
-         * Finds an element by name
+         * Finds an element by name.
+         * The container keeps a hash index from the names to the elements, so hits and misses
+         * do not depend on the amount of elements. Elements that are renamed or replaced through
+         * an iterator while they are stored in the container are only found by their new name
+         * after a call to @ref reindex.
          * @param [in] name
          * @return pointer to the element or NULL
          */
         T* find(const std::string& name);
 
         /**
-         * Finds an element by name
+         * Finds an element by name. Unlike @ref find, this has to determine the position
+         * of the element, a binary search for sorted containers and a search for the element
+         * for unsorted ones.
          * @param [in] name
          * @return iterator to the element or end()
          */
         iterator findIt(const std::string& name);
 
         /**
-         * Finds an element by name
+         * Finds an element by name, see @ref find.
          * @param [in] name
          * @return pointer to the element or NULL
          */
@@ -110,6 +136,19 @@ class DDLContainerNoClone
          */
         void sort();
 
+        /**
+         * Updates the name index and, for sorted containers, the order of the items.
+         * This has to be called after elements have been renamed or replaced through iterators.
+         */
+        void reindex();
+
+        /**
+         * Updates the index entry and, for sorted containers, the position of a single
+         * element that has been renamed.
+         * @param [in] elem The renamed element.
+         */
+        void reindex(T* elem);
+
         /**
          * Returns Whether or not the container is sorted by name or not.
          * @return whether or not the container is sorted by name or not.
@@ -146,7 +185,8 @@ class DDLContainerNoClone
         void clear();
 
         /**
-         * removes an element from the container
+         * removes an element from the container. The element is not accessed, so it may
+         * have been deleted already.
          * @param [in] pos The element which should be removed.
          * @return iterator to the element after the erased element.
          */
@@ -154,6 +194,7 @@ class DDLContainerNoClone
 
         /**
          * @brief removes a sequence of elements from the container
+         * Like @ref erase(iterator), the elements are not accessed.
          * @param pos_first the first element to erase.
          * @param pos_last the first one that should not be erased.
          * @return iterator to the element after the erased elements.
@@ -202,33 +243,22 @@ class DDLContainerNoClone
 
     private:
         /**
-        * Finds an sorted element by name
-        * @param [in] name
-        * @return pointer to the element or NULL
-        */
-        T* find_sorted(const std::string& name);
-
-        /**
-        * Finds an sorted element by name
-        * @param [in] name
-        * @return pointer to the element or NULL
+        * Adds the index entries of an element
+        * @param [in] elem The element, already stored in the container
+        * @param [in] pos The position of the element
         */
-        const T* find_sorted(const std::string& name) const;
-
+        void addEntry(T* elem, size_t pos);
 
         /**
-        * Finds an unsorted element by name
-        * @param [in] name
-        * @return pointer to the element or NULL
+        * Removes the index entries of an element without accessing it
+        * @param [in] elem The element, already removed from the container
         */
-        T* find_unsorted(const std::string& name);
+        void removeEntry(const T* elem);
 
         /**
-        * Finds an unsorted element by name
-        * @param [in] name
-        * @return pointer to the element or NULL
+        * Rebuilds the name index from scratch
         */
-        const T* find_unsorted(const std::string& name) const;
+        void rebuildIndex();
 };
 
 /**
@@ -482,6 +482,10 @@ namespace ddl
         _structs.deleteAll();
         _streams.deleteAll();
         _enums.deleteAll();
+        // after the structs, they may refer to placeholders of the source
+        delete _struct_source;
+        _struct_source = NULL;
+        _structs_pending = false;
     }
 
     a_util::result::Result DDLDescription::accept(IDDLVisitor *poVisitor) const
@@ -786,6 +790,7 @@ namespace ddl
     {
         _structs.deleteAll();
         _structs.clear();
+        setStructSource(NULL);
         //initdefault ...
         mergeStructs(vecStructs, IDDL::ddl_merge_force_overwrite, NULL);
     }
@@ -795,12 +800,14 @@ namespace ddl
     {
         _structs.deleteAll();
         _structs.clear();
+        setStructSource(NULL);
         //initdefault ...
         mergePart(_structs, vecStructs, IDDL::ddl_merge_force_overwrite, NULL, NULL, true, true);
     }
 
     void DDLDescription::mergeStructs(DDLComplexVec vecStructs, uint32_t ui32JoinFlags, DDLVec* pvecDeleteData)
     {
+        buildPendingStructs();
         mergePart(_structs, vecStructs, ui32JoinFlags, pvecDeleteData, this, false, false);
     }
 
@@ -814,6 +821,7 @@ namespace ddl
 
     bool DDLDescription::hasDynamicStructs()
     {
+        buildPendingStructs();
         bool _dynamic_structs = false;
         for (DDLComplexIt itEl = _structs.begin(); itEl != _structs.end(); itEl++)
         {
@@ -828,26 +836,118 @@ namespace ddl
 
     DDLComplexVec& DDLDescription::getStructs()
     {
+        buildPendingStructs();
         return _structs;
     }
 
     const DDLComplexVec& DDLDescription::getStructs() const
     {
+        // building pending structs does not change the content of the description,
+        // concurrent callers are serialized by the lock of the struct source
+        const_cast<DDLDescription*>(this)->buildPendingStructs();
         return _structs;
     }
 
     const DDLComplex * DDLDescription::getStructByName(const std::string& name) const
     {
-        return _structs.find(name);
+        // the const find does not correct the index, so concurrent callers only read it
+        if (!_struct_source_mutex)
+        {
+            return _structs.find(name);
+        }
+
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        const DDLComplex* poStruct = _structs.find(name);
+        if (NULL == poStruct && _structs_pending)
+        {
+            // building pending structs does not change the content of the description
+            const_cast<DDLDescription*>(this)->buildPendingStruct(name);
+            poStruct = _structs.find(name);
+        }
+        return poStruct;
     }
 
     DDLComplex* DDLDescription::getStructByName(const std::string& name)
     {
-        return _structs.find(name);
+        if (!_struct_source_mutex)
+        {
+            return _structs.find(name);
+        }
+
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        DDLComplex* poStruct = _structs.find(name);
+        if (NULL == poStruct && _structs_pending)
+        {
+            buildPendingStruct(name);
+            poStruct = _structs.find(name);
+        }
+        return poStruct;
+    }
+
+    void DDLDescription::setStructSource(IDDLStructSource* poSource)
+    {
+        if (!_struct_source_mutex)
+        {
+            _struct_source_mutex.reset(new a_util::concurrency::recursive_mutex());
+        }
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        delete _struct_source;
+        _struct_source = poSource;
+        _structs_pending = NULL != poSource;
+    }
+
+    a_util::result::Result DDLDescription::getStructSourceResult() const
+    {
+        if (!_struct_source_mutex)
+        {
+            return a_util::result::SUCCESS;
+        }
+
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        return NULL != _struct_source ? _struct_source->getResult() : a_util::result::SUCCESS;
+    }
+
+    void DDLDescription::buildPendingStruct(const std::string& name)
+    {
+        if (!_struct_source_mutex)
+        {
+            return;
+        }
+
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        if (_structs_pending && NULL != _struct_source)
+        {
+            // detach the source while it builds, its own lookups must not recurse into it
+            IDDLStructSource* poSource = _struct_source;
+            _struct_source = NULL;
+            poSource->buildStruct(*this, name);
+            _struct_source = poSource;
+        }
+    }
+
+    void DDLDescription::buildPendingStructs()
+    {
+        if (!_struct_source_mutex)
+        {
+            return;
+        }
+
+        std::lock_guard<a_util::concurrency::recursive_mutex> oLock(*_struct_source_mutex);
+        if (_structs_pending && NULL != _struct_source)
+        {
+            // the source is kept, the structs may refer to placeholders it owns
+            IDDLStructSource* poSource = _struct_source;
+            _struct_source = NULL;
+            poSource->buildAll(*this);
+            _struct_source = poSource;
+            // nothing is left to build, lookups of unknown structs leave the description untouched
+            _structs_pending = false;
+        }
     }
 
     a_util::result::Result DDLDescription::removeType(const std::string& name)
     {
+        buildPendingStruct(name);
         DDLDTIt itDTFound = _data_types.findIt(name);
         if (_data_types.end() == itDTFound)
         {
@@ -884,6 +984,7 @@ namespace ddl
 
     a_util::result::Result DDLDescription::removeComplexDataType(const std::string& name)
     {
+        buildPendingStruct(name);
         DDLComplexIt itStructFound = _structs.findIt(name);
         if (_structs.end() == itStructFound)
         {
@@ -993,6 +1094,7 @@ namespace ddl
         const int nTo
         )
     {
+        buildPendingStructs();
         return DDLDescription::moveChild(&_structs, nFrom, nTo);
     }
 
@@ -1003,6 +1105,7 @@ namespace ddl
         const std::string& strParent
         )
     {
+        buildPendingStruct(strParent);
         DDLComplexIt itStructFound = _structs.findIt(strParent);
         if (_structs.end() == itStructFound)
         {
@@ -1093,6 +1196,7 @@ namespace ddl
             return ERR_NOT_FOUND;
         }
         poStream->setName(strNewName);
+        _streams.reindex(poStream);
         return a_util::result::SUCCESS;
     }
 
@@ -1162,6 +1266,8 @@ namespace ddl
 
         DDLVec vecDeletionVector; //(this is the vector for all vector items that can be deleted after merge)
 
+        buildPendingStructs();
+
         mergeBaseunits(oDDL.getBaseunits(), ui32JoinFlags, &vecDeletionVector);
         mergePrefixes(oDDL.getPrefixes(), ui32JoinFlags,  &vecDeletionVector);
         mergeUnits(oDDL.getUnits(), ui32JoinFlags, &vecDeletionVector);
@@ -1183,99 +1289,37 @@ namespace ddl
         return _init_flag;
     }
 
-    a_util::result::Result DDLDescription::restoreLevel(int nLevel)
+    /**
+     * Deletes the elements of a container that have been created at the given level or above,
+     * predefined elements are kept.
+     */
+    template<typename T>
+    static void restoreContainerLevel(DDLContainer<T>& vecData, int nLevel)
     {
-        for (DDLStreamIt itStream = _streams.begin();
-            _streams.end() != itStream; ++itStream)
-        {
-            if ((*itStream)->getCreationLevel() >= nLevel)
-            {
-                *itStream = deleteChild(*itStream);
-            }
-        }
-        DDLStreamIt itRemStream = std::remove_if(_streams.begin(),
-            _streams.end(), std::bind1st(std::equal_to<DDLStream*>(),
-            static_cast<DDLStream*>(NULL)));
-        _streams.erase(itRemStream, _streams.end());
-
-        for (DDLComplexIt itStruct = _structs.begin();
-            _structs.end() != itStruct; ++itStruct)
+        for (typename DDLContainer<T>::iterator itData = vecData.begin(); vecData.end() != itData;)
         {
-            if ((*itStruct)->getCreationLevel() >= nLevel)
+            if ((*itData)->getCreationLevel() >= nLevel && NULL == DDL::deleteChild(*itData))
             {
-                *itStruct = deleteChild(*itStruct);
+                // erasing keeps the name index of the container up to date
+                itData = vecData.erase(itData);
             }
-        }
-        DDLComplexIt itRemStruct = std::remove_if(_structs.begin(),
-            _structs.end(), std::bind1st(std::equal_to<DDLComplex*>(),
-            static_cast<DDLComplex*>(NULL)));
-        _structs.erase(itRemStruct, _structs.end());
-
-        for (DDLDTIt itDT = _data_types.begin(); _data_types.end() != itDT;
-            ++itDT)
-        {
-            if ((*itDT)->getCreationLevel() >= nLevel)
+            else
             {
-                *itDT = deleteChild(*itDT);
+                ++itData;
             }
         }
-        DDLDTIt itRemDT = std::remove_if(_data_types.begin(),
-            _data_types.end(), std::bind1st(std::equal_to<DDLDataType*>(),
-            static_cast<DDLDataType*>(NULL)));
-        _data_types.erase(itRemDT, _data_types.end());
-
-        for (DDLUnitIt itUnit = _units.begin(); _units.end() != itUnit;
-            ++itUnit)
-        {
-            if ((*itUnit)->getCreationLevel() >= nLevel)
-            {
-                *itUnit = deleteChild(*itUnit);
-            }
-        }
-        DDLUnitIt itRemUnit = std::remove_if(_units.begin(),
-            _units.end(), std::bind1st(std::equal_to<DDLUnit*>(),
-            static_cast<DDLUnit*>(NULL)));
-        _units.erase(itRemUnit, _units.end());
-
-        for (DDLPrefixIt itPrefix = _prefixes.begin();
-            _prefixes.end() != itPrefix; ++itPrefix)
-        {
-            if ((*itPrefix)->getCreationLevel() >= nLevel)
-            {
-                *itPrefix = deleteChild(*itPrefix);
-            }
-        }
-        DDLPrefixIt itRemPrefix = std::remove_if(_prefixes.begin(),
-            _prefixes.end(), std::bind1st(std::equal_to<DDLPrefix*>(),
-            static_cast<DDLPrefix*>(NULL)));
-        _prefixes.erase(itRemPrefix, _prefixes.end());
-
-        for (DDLBaseunitIt itBU = _baseunits.begin();
-            _baseunits.end() != itBU; ++itBU)
-        {
-            if ((*itBU)->getCreationLevel() >= nLevel)
-            {
-                *itBU = deleteChild(*itBU);
-            }
-        }
-        DDLBaseunitIt itRemBU = std::remove_if(_baseunits.begin(),
-            _baseunits.end(), std::bind1st(std::equal_to<DDLBaseunit*>(),
-            static_cast<DDLBaseunit*>(NULL)));
-        _baseunits.erase(itRemBU, _baseunits.end());
-
+    }
 
-        for (DDLEnumIt itEnum = _enums.begin();
-            _enums.end() != itEnum; ++itEnum)
-        {
-            if ((*itEnum)->getCreationLevel() >= nLevel)
-            {
-                *itEnum = deleteChild(*itEnum);
-            }
-        }
-        DDLEnumIt itRemEnum = std::remove_if(_enums.begin(),
-            _enums.end(), std::bind1st(std::equal_to<DDLEnum*>(),
-            static_cast<DDLEnum*>(NULL)));
-        _enums.erase(itRemEnum, _enums.end());
+    a_util::result::Result DDLDescription::restoreLevel(int nLevel)
+    {
+        buildPendingStructs();
+        restoreContainerLevel(_streams, nLevel);
+        restoreContainerLevel(_structs, nLevel);
+        restoreContainerLevel(_data_types, nLevel);
+        restoreContainerLevel(_units, nLevel);
+        restoreContainerLevel(_prefixes, nLevel);
+        restoreContainerLevel(_baseunits, nLevel);
+        restoreContainerLevel(_enums, nLevel);
 
         DDLInspector oInspector;
         return oInspector.visitDDL(this);
@@ -1389,7 +1433,10 @@ namespace ddl
                             }
                             else
                             {
-                                *itFound = clone<T>(*itRefOther);
+                                // replace it at the same position, so the name index stays valid
+                                int nPos = static_cast<int>(itFound - vecMemberData.begin());
+                                vecMemberData.erase(itFound);
+                                vecMemberData.insert(clone<T>(*itRefOther), nPos);
                             }
                             if (pvecDeleteData)
                             {
@@ -1580,6 +1627,7 @@ namespace ddl
             return ERR_NOT_FOUND;
         }
         poStreamMetaType->setName(strNewName);
+        _stream_meta_types.reindex(poStreamMetaType);
         return a_util::result::SUCCESS;
     }
 
@@ -1609,5 +1657,8 @@ namespace ddl
         swap(lhs._stream_meta_types, rhs._stream_meta_types);
         swap(lhs._init_flag, rhs._init_flag);
         swap(lhs._merge_defaults, rhs._merge_defaults);
+        swap(lhs._struct_source, rhs._struct_source);
+        swap(lhs._structs_pending, rhs._structs_pending);
+        swap(lhs._struct_source_mutex, rhs._struct_source_mutex);
     }
 }   // namespace ddl
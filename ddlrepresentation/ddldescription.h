@@ -25,6 +25,7 @@
 #include "ddlvisitor_intf.h"
 #include "ddlcontainer.h"
 #include "ddlversion.h"
+#include "ddlstructsource_intf.h"
 
 
 namespace ddl
@@ -477,6 +478,26 @@ namespace ddl
          */
         DDLComplex* getStructByName(const std::string& name);
 
+        /**
+         * Setter for a source of structs that are built on first access.
+         * A lookup of a struct that is not part of the description yet asks
+         * the source to build it, accessors of all structs build the
+         * remaining ones first.
+         * @param[in] source - The source, the description takes the ownership
+         * @return void
+         */
+        void setStructSource(IDDLStructSource* source);
+
+        /**
+         * Getter for the result of building the structs of the struct source.
+         * A struct whose definition fails to build is not part of the
+         * description, its lookup returns \c NULL.
+         * @retval a_util::result::SUCCESS No struct source or all structs built so far are valid
+         * @retval ERR_UNKNOWN Not all referenced structs have been resolved
+         * @retval ERR_UNKNOWN_FORMAT A definition of a struct could not be built
+         */
+        a_util::result::Result getStructSourceResult() const;
+
         /**
          * Removes the specified primitive or complex data-type.
          * @param[in] name - Name of the type to remove
@@ -890,6 +911,19 @@ namespace ddl
                                const bool& delete_non_overwritten = false);
         static void copyMinMaxValues(DDLDataType* dest_container, DDLDataType* src_container);
 
+        /**
+         * Helper method to build a struct of the struct source, if any.
+         * @param[in] name - Name of the struct to build
+         * @return void
+         */
+        void buildPendingStruct(const std::string& name);
+
+        /**
+         * Helper method to build all remaining structs of the struct source, if any.
+         * @return void
+         */
+        void buildPendingStructs();
+
     private:    // members
         DDLHeader * _header;
         DDLUnitVec _units;
@@ -902,6 +936,10 @@ namespace ddl
         DDLStreamMetaTypeVec _stream_meta_types;
         bool _init_flag;
         bool _merge_defaults;
+        IDDLStructSource* _struct_source = NULL;
+        bool _structs_pending = false;
+        // serializes the lookups of structs while there is a struct source
+        a_util::memory::unique_ptr<a_util::concurrency::recursive_mutex> _struct_source_mutex;
     };
 
         /**
@@ -19,6 +19,10 @@
 
 #include "ddlimporter.h"
 #include <sstream>
+#include <fstream>
+#include <cctype>
+#include <cstring>
+#include <unordered_map>
 #include "a_util/result/error_def.h"
 #include "legacy_error_macros.h"
 
@@ -38,6 +42,7 @@
 #include "ddlstreamstruct.h"
 
 #include "ddlversion.h"
+#include "ddlstreamscanner.h"
 
 namespace ddl
 {
@@ -247,6 +252,741 @@ namespace ddl
         return a_util::result::SUCCESS;
     }
 
+    /**
+     * Kinds of top-level definitions of a streamed import in the order they
+     * have to appear in the document
+     */
+    enum StreamedKind
+    {
+        sk_baseunit = 0,
+        sk_prefix,
+        sk_unit,
+        sk_datatype,
+        sk_enum,
+        sk_struct,
+        sk_stream,
+        sk_stream_meta_type,
+        sk_count
+    };
+
+    /**
+     * Maps a scanned item to the kind of its definition.
+     * @param[in] strSection - Name of the section
+     * @param[in] strElement - Name of the definition, empty for the start of the section
+     * @return The kind or -1 if the item is not part of a description
+     */
+    static int getStreamedKind(const std::string& strSection, const std::string& strElement)
+    {
+        if (strSection == "units")
+        {
+            if (strElement.empty() || strElement == "baseunit")
+            {
+                return sk_baseunit;
+            }
+            if (strElement == "prefixes")
+            {
+                return sk_prefix;
+            }
+            return strElement == "unit" ? sk_unit : -1;
+        }
+        if (strSection == "datatypes" && (strElement.empty() || strElement == "datatype"))
+        {
+            return sk_datatype;
+        }
+        if (strSection == "enums" && (strElement.empty() || strElement == "enum"))
+        {
+            return sk_enum;
+        }
+        if (strSection == "structs" && (strElement.empty() || strElement == "struct"))
+        {
+            return sk_struct;
+        }
+        if (strSection == "streams" && (strElement.empty() || strElement == "stream"))
+        {
+            return sk_stream;
+        }
+        if (strSection == "streammetatypes" && (strElement.empty() || strElement == "streammetatype"))
+        {
+            return sk_stream_meta_type;
+        }
+        return -1;
+    }
+
+    struct DDLImporter::StreamedImport
+    {
+        StreamedImport(bool bSorted) :
+            baseunits(bSorted),
+            prefixes(bSorted),
+            datatypes(bSorted),
+            enums(bSorted),
+            streams(bSorted),
+            stream_meta_types(bSorted),
+            lazy_structs(NULL),
+            committed(sk_baseunit)
+        {
+            std::fill(sections, sections + sk_count, false);
+        }
+
+        ~StreamedImport()
+        {
+            // only definitions that have not been handed over to the description
+            baseunits.deleteAll();
+            prefixes.deleteAll();
+            datatypes.deleteAll();
+            enums.deleteAll();
+            streams.deleteAll();
+            stream_meta_types.deleteAll();
+        }
+
+        DDLBaseunitVec baseunits;
+        DDLPrefixVec prefixes;
+        DDLDTVec datatypes;
+        DDLEnumVec enums;
+        DDLStreamVec streams;
+        DDLStreamMetaTypeVec stream_meta_types;
+        // the source of the structs of a lazy import, NULL if they are built right away
+        LazyStructSource* lazy_structs;
+        // all kinds below have been handed over to the description
+        int committed;
+        // the sections that have been found, indexed by the kind of their first definition
+        bool sections[sk_count];
+    };
+
+    /**
+     * Extracts an attribute of the start tag of a raw definition without parsing it.
+     * @param[in] strXML - The raw definition
+     * @param[in] strAttribute - Name of the attribute
+     * @param[out] strValue - Value of the attribute
+     * @return false if the attribute is missing or contains escaped characters
+     */
+    static bool getStartTagAttribute(const std::string& strXML, const char* strAttribute,
+                                     std::string& strValue)
+    {
+        size_t nLength = std::strlen(strAttribute);
+        char cQuote = 0;
+        size_t nValueStart = std::string::npos;
+        for (size_t nPos = 1; nPos < strXML.size(); ++nPos)
+        {
+            char cCurrent = strXML[nPos];
+            if (cQuote != 0)
+            {
+                if (cCurrent == cQuote)
+                {
+                    if (std::string::npos != nValueStart)
+                    {
+                        strValue = strXML.substr(nValueStart, nPos - nValueStart);
+                        return strValue.find('&') == std::string::npos;
+                    }
+                    cQuote = 0;
+                }
+                continue;
+            }
+            if (cCurrent == '>')
+            {
+                return false;
+            }
+            if (cCurrent == '"' || cCurrent == '\'')
+            {
+                cQuote = cCurrent;
+                continue;
+            }
+            if (std::isspace(static_cast<unsigned char>(strXML[nPos - 1])) &&
+                strXML.compare(nPos, nLength, strAttribute) == 0)
+            {
+                size_t nEquals = strXML.find_first_not_of(" \t\r\n", nPos + nLength);
+                if (std::string::npos != nEquals && strXML[nEquals] == '=')
+                {
+                    size_t nQuote = strXML.find_first_not_of(" \t\r\n", nEquals + 1);
+                    if (std::string::npos != nQuote && (strXML[nQuote] == '"' || strXML[nQuote] == '\''))
+                    {
+                        cQuote = strXML[nQuote];
+                        nValueStart = nQuote + 1;
+                        nPos = nQuote;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Source of the structs of a lazy import, holds the raw definitions of
+     * all structs that have not been built yet.
+     */
+    class DDLImporter::LazyStructSource : public IDDLStructSource
+    {
+    public:
+        LazyStructSource(const DDLImporter& oImporter) :
+            _importer(oImporter._basic_check, oImporter._sorted),
+            _dom(),
+            _definitions(),
+            _result(a_util::result::SUCCESS)
+        {
+            _importer._creation_level = oImporter._creation_level;
+            _importer._merge_defaults = oImporter._merge_defaults;
+            _importer._prefere_reference = oImporter._prefere_reference;
+        }
+
+        void addDefinition(const std::string& strName, std::string& strXML)
+        {
+            // like the lookup of the DOM based import, the first definition of a name wins
+            if (_definitions.end() == _definitions.find(strName))
+            {
+                _definitions[strName].swap(strXML);
+            }
+        }
+
+        DDLComplex* buildStruct(DDLDescription& oDescription, const std::string& strName)
+        {
+            if (_definitions.end() == _definitions.find(strName))
+            {
+                return NULL;
+            }
+
+            _importer._ddl_desc = &oDescription;
+            DDLComplex* poRequested = NULL;
+            std::vector<std::string> vecPending(1, strName);
+            while (!vecPending.empty())
+            {
+                std::string strCurrent = vecPending.back();
+                vecPending.pop_back();
+                DefinitionMap::iterator itDefinition = _definitions.find(strCurrent);
+                if (_definitions.end() == itDefinition)
+                {
+                    // built in the meantime
+                    continue;
+                }
+                std::string strXML;
+                strXML.swap(itDefinition->second);
+                _definitions.erase(itDefinition);
+
+                DDLComplex* poStruct = NULL;
+                if (!_dom.fromString(strXML))
+                {
+                    LOG_ERROR(_dom.getLastError().c_str());
+                    setFailed(ERR_UNKNOWN_FORMAT);
+                    continue;
+                }
+                a_util::result::Result nRes = _importer.buildSingleStruct(&poStruct, _dom.getRoot());
+                if (isFailed(nRes))
+                {
+                    LOG_ERROR(_importer.getLastErrorDesc().c_str());
+                    setFailed(nRes);
+                    continue;
+                }
+                oDescription.addStruct(poStruct);
+                if (strCurrent == strName)
+                {
+                    poRequested = poStruct;
+                }
+
+                // the placeholders are the structs referred to that have not been built yet
+                for (DDLComplexIt itUnknown = _importer._unknown_structs.begin();
+                    _importer._unknown_structs.end() != itUnknown; ++itUnknown)
+                {
+                    if (_definitions.end() != _definitions.find((*itUnknown)->getName()))
+                    {
+                        vecPending.push_back((*itUnknown)->getName());
+                    }
+                }
+            }
+            _importer._ddl_desc = NULL;
+            return poRequested;
+        }
+
+        a_util::result::Result buildAll(DDLDescription& oDescription)
+        {
+            while (!_definitions.empty())
+            {
+                std::string strName = _definitions.begin()->first;
+                buildStruct(oDescription, strName);
+            }
+            for (DDLComplexIt itUnknown = _importer._unknown_structs.begin();
+                _importer._unknown_structs.end() != itUnknown; ++itUnknown)
+            {
+                LOG_ERROR(a_util::strings::format("The struct '%s' was referenced but not defined.",
+                    (*itUnknown)->getName().c_str()).c_str());
+            }
+            if (!_importer._unknown_structs.empty())
+            {
+                setFailed(ERR_UNKNOWN);
+            }
+            return _result;
+        }
+
+        a_util::result::Result getResult() const
+        {
+            return _result;
+        }
+
+    private:
+        void setFailed(const a_util::result::Result& nResult)
+        {
+            // the first failure is kept, the later ones are often caused by it
+            if (isOk(_result))
+            {
+                _result = nResult;
+            }
+        }
+
+        typedef std::unordered_map<std::string, std::string> DefinitionMap;
+
+        // builds the structs, owns the placeholders of unresolved structs
+        DDLImporter _importer;
+        a_util::xml::DOM _dom;
+        DefinitionMap _definitions;
+        a_util::result::Result _result;
+    };
+
+    a_util::result::Result DDLImporter::createNewStreamed(const a_util::filesystem::Path& strFile,
+                                                          const DDLVersion& version /* = 0 */)
+    {
+        std::ifstream oFile(strFile.toString().c_str(), std::ios::in | std::ios::binary);
+        if (!oFile.is_open())
+        {
+            pushMessage(a_util::strings::format("Could not open file '%s'.", strFile.toString().c_str()),
+                importer_error);
+            return ERR_OPEN_FAILED;
+        }
+        return createNewStreamed(oFile, version);
+    }
+
+    a_util::result::Result DDLImporter::createNewStreamed(std::istream& oStream,
+                                                          const DDLVersion& version /* = 0 */)
+    {
+        return importStreamed(oStream, version, NULL);
+    }
+
+    a_util::result::Result DDLImporter::createNewLazy(const a_util::filesystem::Path& strFile,
+                                                      const DDLVersion& version /* = 0 */)
+    {
+        std::ifstream oFile(strFile.toString().c_str(), std::ios::in | std::ios::binary);
+        if (!oFile.is_open())
+        {
+            pushMessage(a_util::strings::format("Could not open file '%s'.", strFile.toString().c_str()),
+                importer_error);
+            return ERR_OPEN_FAILED;
+        }
+        return createNewLazy(oFile, version);
+    }
+
+    a_util::result::Result DDLImporter::createNewLazy(std::istream& oStream,
+                                                      const DDLVersion& version /* = 0 */)
+    {
+        a_util::memory::unique_ptr<LazyStructSource> pSource(new LazyStructSource(*this));
+        a_util::result::Result nResult = importStreamed(oStream, version, pSource.get());
+        if (NULL != _ddl_desc)
+        {
+            // also on failure, the structs built so far may refer to placeholders of the source
+            _ddl_desc->setStructSource(pSource.release());
+        }
+        return nResult;
+    }
+
+    a_util::result::Result DDLImporter::importStreamed(std::istream& oStream,
+                                                       const DDLVersion& requestedVersion,
+                                                       LazyStructSource* pLazyStructs)
+    {
+        DDLVersion version = requestedVersion;
+        if (version == DDLVersion::ddl_version_invalid)
+        {
+            version = DDLVersion::ddl_version_current;
+        }
+        // The DDL object does not get deleted because the caller/user of this
+        // object is responsible for it.
+        _ddl_desc = NULL;
+        _current_ref_ddl = NULL;
+
+        DDLStreamScanner oScanner(oStream);
+        DDLStreamScanner::Item sItem;
+        StreamedImport sImport(_sorted);
+        sImport.lazy_structs = pLazyStructs;
+        a_util::xml::DOM oItemDOM;
+        a_util::result::Result nResult = a_util::result::SUCCESS;
+        for (;;)
+        {
+            a_util::result::Result nRes = oScanner.next(sItem);
+            if (isFailed(nRes))
+            {
+                pushMessage(std::string("The DDL is not well-formed."), importer_error);
+                return nRes;
+            }
+            if (sItem.section.empty() && sItem.element.empty())
+            {
+                // end of document
+                break;
+            }
+
+            if (sItem.element == "header")
+            {
+                if (NULL != _ddl_desc)
+                {
+                    // like the DOM based import, only the first header is used
+                    continue;
+                }
+                // the header is built by the DOM based implementation, it is tiny
+                _init_flag = _dom.fromString(sItem.xml);
+                nRes = _init_flag ? buildHeader() : ERR_UNKNOWN_FORMAT;
+                _init_flag = false;
+                if (isFailed(nRes))
+                {
+                    nResult = nRes;
+                    if (false == _full_check)
+                    {
+                        return nResult;
+                    }
+                }
+                continue;
+            }
+
+            if (NULL == _ddl_desc)
+            {
+                pushMessage(std::string("DDL does not contain a header."), importer_error);
+                if (false == _full_check)
+                {
+                    return ERR_OPEN_FAILED;
+                }
+                nResult = ERR_OPEN_FAILED;
+                _ddl_desc = new DDLDescription(new DDLHeader(),
+                                              DDLUnitVec(_sorted),
+                                              DDLBaseunitVec(_sorted),
+                                              DDLPrefixVec(_sorted),
+                                              DDLDTVec(_sorted),
+                                              DDLComplexVec(_sorted),
+                                              DDLStreamVec(_sorted),
+                                              DDLEnumVec(_sorted),
+                                              _merge_defaults);
+            }
+
+            int nKind = getStreamedKind(sItem.section, sItem.element);
+            if (nKind < 0 ||
+                (nKind == sk_stream_meta_type && version < DDLVersion::ddl_version_40))
+            {
+                continue;
+            }
+            if (nKind < sImport.committed)
+            {
+                pushMessage(a_util::strings::format("The section '%s' has to precede all sections that refer to it.",
+                    sItem.section.c_str()), importer_error);
+                nResult = ERR_UNKNOWN_FORMAT;
+                if (false == _full_check)
+                {
+                    return nResult;
+                }
+                continue;
+            }
+            commitStreamed(sImport, nKind);
+
+            if (sItem.element.empty())
+            {
+                sImport.sections[nKind] = true;
+                continue;
+            }
+
+            if (nKind == sk_struct && NULL != sImport.lazy_structs)
+            {
+                // only the raw definition is kept until the struct is asked for
+                std::string strName;
+                if (!getStartTagAttribute(sItem.xml, "name", strName) &&
+                    !getStartTagAttribute(sItem.xml, "type", strName))
+                {
+                    // escaped or missing name, leave it to the DOM
+                    if (oItemDOM.fromString(sItem.xml))
+                    {
+                        strName = oItemDOM.getRoot().hasAttribute("name") ?
+                            oItemDOM.getRoot().getAttribute("name") :
+                            oItemDOM.getRoot().getAttribute("type");
+                    }
+                }
+                sImport.lazy_structs->addDefinition(strName, sItem.xml);
+                continue;
+            }
+
+            // only the current definition is held in a DOM
+            if (!oItemDOM.fromString(sItem.xml))
+            {
+                pushMessage(oItemDOM.getLastError(), importer_error);
+                nRes = ERR_UNKNOWN_FORMAT;
+            }
+            else
+            {
+                nRes = buildStreamed(sImport, nKind, oItemDOM.getRoot());
+            }
+            if (isFailed(nRes))
+            {
+                nResult = nRes;
+                if (false == _full_check)
+                {
+                    return nResult;
+                }
+            }
+        }
+
+        if (NULL == _ddl_desc)
+        {
+            pushMessage(std::string("DDL does not contain a header."), importer_error);
+            return ERR_OPEN_FAILED;
+        }
+        commitStreamed(sImport, sk_count);
+
+        a_util::result::Result nRes = finishStreamed(sImport);
+        if (isFailed(nRes))
+        {
+            nResult = nRes;
+        }
+        if (_full_check)
+        {
+            // check if any error occurred during build up new DDL
+            for (ImporterMsgList::const_iterator itMsg = _errors.begin();
+                _errors.end() != itMsg; ++itMsg)
+            {
+                if (itMsg->severity == importer_error)
+                {
+                    return ERR_UNKNOWN_FORMAT;
+                }
+            }
+        }
+        return nResult;
+    }
+
+    void DDLImporter::commitStreamed(StreamedImport& sImport, int nKind)
+    {
+        for (; sImport.committed < nKind; ++sImport.committed)
+        {
+            // the containers are cleared as the description takes over the objects
+            switch (sImport.committed)
+            {
+                case sk_baseunit:
+                    if (!sImport.baseunits.empty())
+                    {
+                        _ddl_desc->refBaseunits(sImport.baseunits);
+                        sImport.baseunits.clear();
+                    }
+                    break;
+                case sk_prefix:
+                    if (!sImport.prefixes.empty())
+                    {
+                        _ddl_desc->refPrefixes(sImport.prefixes);
+                        sImport.prefixes.clear();
+                    }
+                    break;
+                case sk_datatype:
+                    if (sImport.sections[sk_datatype])
+                    {
+                        _ddl_desc->refDatatypes(sImport.datatypes);
+                        sImport.datatypes.clear();
+                    }
+                    break;
+                case sk_enum:
+                    if (!sImport.enums.empty())
+                    {
+                        _ddl_desc->refEnums(sImport.enums);
+                        sImport.enums.clear();
+                    }
+                    break;
+                case sk_stream:
+                    if (!sImport.streams.empty())
+                    {
+                        _ddl_desc->refStreams(sImport.streams);
+                        sImport.streams.clear();
+                    }
+                    break;
+                case sk_stream_meta_type:
+                    if (!sImport.stream_meta_types.empty())
+                    {
+                        _ddl_desc->refStreamMetaTypes(sImport.stream_meta_types);
+                        sImport.stream_meta_types.clear();
+                    }
+                    break;
+                default:
+                    // units and structs are added to the description right away
+                    break;
+            }
+        }
+    }
+
+    a_util::result::Result DDLImporter::buildStreamed(StreamedImport& sImport, int nKind,
+                                                      const a_util::xml::DOMElement& oElement)
+    {
+        std::string strDuplicate;
+        switch (nKind)
+        {
+            case sk_baseunit:
+            {
+                DDLBaseunit * poBUTmp = NULL;
+                RETURN_IF_FAILED(buildSingleBaseunit(&poBUTmp, oElement));
+                if (_basic_check && sImport.baseunits.find(poBUTmp->getName()))
+                {
+                    strDuplicate = a_util::strings::format("The baseunit '%s' is specified more than once.",
+                        poBUTmp->getName().c_str());
+                }
+                sImport.baseunits.insert(poBUTmp);
+                break;
+            }
+            case sk_prefix:
+            {
+                DDLPrefix * poPrefixTmp = NULL;
+                RETURN_IF_FAILED(buildSinglePrefix(&poPrefixTmp, oElement));
+                if (_basic_check && sImport.prefixes.find(poPrefixTmp->getName()))
+                {
+                    strDuplicate = a_util::strings::format("The prefix '%s' is specified more than once.",
+                        poPrefixTmp->getName().c_str());
+                }
+                sImport.prefixes.insert(poPrefixTmp);
+                break;
+            }
+            case sk_unit:
+            {
+                DDLUnit * poUnitTmp = NULL;
+                RETURN_IF_FAILED(buildSingleUnit(&poUnitTmp, oElement));
+                if (_basic_check && _ddl_desc->getUnitByName(poUnitTmp->getName()))
+                {
+                    strDuplicate = a_util::strings::format("The unit '%s' is specified more than once.",
+                        poUnitTmp->getName().c_str());
+                }
+                _ddl_desc->addUnit(poUnitTmp);
+                break;
+            }
+            case sk_datatype:
+            {
+                DDLDataType * poDTTmp = NULL;
+                RETURN_IF_FAILED(buildSingleDatatype(&poDTTmp, oElement));
+                if (_basic_check && sImport.datatypes.find(poDTTmp->getName()))
+                {
+                    strDuplicate = a_util::strings::format("The datatype '%s' is specified more than once.",
+                        poDTTmp->getName().c_str());
+                }
+                sImport.datatypes.insert(poDTTmp);
+                break;
+            }
+            case sk_enum:
+            {
+                DDLEnum * poEnumTmp = NULL;
+                RETURN_IF_FAILED(buildSingleEnum(&poEnumTmp, oElement));
+                sImport.enums.insert(poEnumTmp);
+                break;
+            }
+            case sk_struct:
+            {
+                // references to structs further down are resolved by the placeholders in _unknown_structs
+                DDLComplex * poStructTmp = NULL;
+                RETURN_IF_FAILED(buildSingleStruct(&poStructTmp, oElement));
+                _ddl_desc->addStruct(poStructTmp);
+                break;
+            }
+            case sk_stream:
+            {
+                if (NULL != sImport.lazy_structs)
+                {
+                    // the structs of the stream have to be built before
+                    sImport.lazy_structs->buildStruct(*_ddl_desc, oElement.getAttribute("type"));
+                    a_util::xml::DOMElementList oStructs;
+                    oElement.findNodes("struct", oStructs);
+                    for (tDOMElemIt itStruct = oStructs.begin(); oStructs.end() != itStruct; ++itStruct)
+                    {
+                        sImport.lazy_structs->buildStruct(*_ddl_desc, itStruct->getAttribute("type"));
+                    }
+                }
+                DDLStream * poStreamTmp = NULL;
+                RETURN_IF_FAILED(buildSingleStream(&poStreamTmp, oElement));
+                if (_basic_check && sImport.streams.find(poStreamTmp->getName()))
+                {
+                    strDuplicate = a_util::strings::format("The stream '%s' is specified more than once.",
+                        poStreamTmp->getName().c_str());
+                }
+                sImport.streams.insert(poStreamTmp);
+                break;
+            }
+            case sk_stream_meta_type:
+            {
+                RETURN_IF_FAILED(buildSingleStreamMetaType(oElement, sImport.stream_meta_types));
+                break;
+            }
+            default:
+                return ERR_INVALID_ARG;
+        }
+
+        if (!strDuplicate.empty())
+        {
+            pushMessage(strDuplicate, importer_error);
+            return ERR_RESOURCE_IN_USE;
+        }
+        return a_util::result::SUCCESS;
+    }
+
+    a_util::result::Result DDLImporter::finishStreamed(StreamedImport& sImport)
+    {
+        a_util::result::Result nResult = a_util::result::SUCCESS;
+        if (!sImport.sections[sk_baseunit])
+        {
+            // as units are not supported in ADTF => no error
+            pushMessage(std::string("DDL does not contain the 'units' element."),
+                importer_warning);
+        }
+        if (!sImport.sections[sk_datatype])
+        {
+            pushMessage(std::string("DDL does not contain the 'datatypes' element"),
+                importer_error);
+            nResult = ERR_NOT_FOUND;
+        }
+        if (!sImport.sections[sk_enum] &&
+            _ddl_desc->getHeader()->getLanguageVersion() >= DDLVersion::ddl_version_20)
+        {
+            pushMessage(std::string("DDL does not contain the 'enums' element."),
+                importer_warning);
+        }
+        if (!sImport.sections[sk_struct])
+        {
+            pushMessage(std::string("DDL does not contain the 'structs' element"),
+                importer_error);
+            nResult = ERR_NOT_FOUND;
+        }
+        if (!sImport.sections[sk_stream])
+        {
+            pushMessage(std::string("DDL does not contain the 'streams' element"),
+                importer_error);
+            // like buildStreams, a missing streams section only fails a full check
+            if (_full_check)
+            {
+                nResult = ERR_UNKNOWN_FORMAT;
+            }
+        }
+
+        // fixup pass: all placeholders of forward references must have been replaced by now
+        for (DDLUnitIt itUnknown = _unknown_units.begin();
+            _unknown_units.end() != itUnknown; ++itUnknown)
+        {
+            pushMessage(a_util::strings::format("The unit '%s' was referenced but not specified.",
+                (*itUnknown)->getName().c_str()), importer_error);
+            nResult = ERR_UNKNOWN;
+        }
+        for (DDLComplexIt itUnknown = _unknown_structs.begin();
+            _unknown_structs.end() != itUnknown; ++itUnknown)
+        {
+            pushMessage(a_util::strings::format("The struct '%s' was referenced but not defined.",
+                (*itUnknown)->getName().c_str()), importer_error);
+        }
+        if (!_unknown_structs.empty())
+        {
+            pushMessage(std::string("There are undefined types/structs in this description."),
+                importer_error);
+            nResult = ERR_UNKNOWN;
+        }
+        for (DDLStreamMetaTypeVec::iterator itUnknown = _unknown_stream_meta_types.begin();
+            _unknown_stream_meta_types.end() != itUnknown; ++itUnknown)
+        {
+            pushMessage(a_util::strings::format("The struct '%s' was referenced but not defined.",
+                (*itUnknown)->getName().c_str()), importer_error);
+        }
+        if (!_unknown_stream_meta_types.empty())
+        {
+            pushMessage(std::string("There are undefined streammetatypes in this description."),
+                importer_error);
+            nResult = ERR_UNKNOWN;
+        }
+        return nResult;
+    }
+
     void DDLImporter::setCreationLevel(int const nLevel)
     {
         _creation_level = nLevel;
@@ -1503,10 +2243,10 @@ a_util::result::Result DDLImporter::buildSingleDatatype(DDLDataType ** ppoNewDat
         if (!ppoNewStruct) { return ERR_POINTER; }
         *ppoNewStruct = NULL;
 
-        // get already defined types
-        DDLDTVec vecDTs = _ddl_desc->getDatatypes();
-        DDLComplexVec vecStructs = _ddl_desc->getStructs();
-        DDLEnumVec vecEnums = _ddl_desc->getEnums();
+        // get already defined types, referenced instead of copied as this runs once per struct
+        DDLDTVec& vecDTs = _ddl_desc->getDatatypes();
+        DDLComplexVec& vecStructs = _ddl_desc->getStructs();
+        DDLEnumVec& vecEnums = _ddl_desc->getEnums();
 
         // get already defined types
         DDLDTVec vecDTRefs;
@@ -1795,7 +2535,7 @@ a_util::result::Result DDLImporter::buildSingleDatatype(DDLDataType ** ppoNewDat
 
             if (itElem->hasAttribute("unit"))
             {
-                DDLUnitVec vecDDLUnits = _ddl_desc->getUnits();
+                DDLUnitVec& vecDDLUnits = _ddl_desc->getUnits();
                 DDLUnitVec vecDDLUnitRefs;
                 if (_current_ref_ddl != NULL)
                 {
@@ -20,6 +20,8 @@
 #ifndef DDL_IMPORTER_H_INCLUDED
 #define DDL_IMPORTER_H_INCLUDED
 
+#include <iosfwd>
+
 #include "ddl_common.h"
 #include "ddlfactorymethod_intf.h"
 #include "ddlvisitor_intf.h"
@@ -226,6 +228,78 @@ namespace ddl
          */
         a_util::result::Result setXML(const std::string& xml);
 
+        /**
+         * Method to create a new DDL from a file without loading the whole
+         * document into a DOM.
+         * @param[in] file - Path to file to use
+         * @param[in] version - The version the newly created description will have.
+         *                      Set 0 for newest version.
+         * @retval ERR_OPEN_FAILED Reading process failed
+         * @see createNewStreamed(std::istream&, const DDLVersion&)
+         */
+        a_util::result::Result createNewStreamed(const a_util::filesystem::Path& file,
+            const DDLVersion& version = DDLVersion::ddl_version_invalid);
+
+        /**
+         * Method to create a new DDL in one pass over the given stream
+         * without building a DOM of the whole document. Every top-level
+         * definition is parsed and converted on its own and released right
+         * after, so the memory needed for parsing is bound by the largest
+         * definition instead of the whole document. References to structs
+         * and units that are defined further down are resolved at the end
+         * of the stream.
+         * @param[in] stream - The stream containing the DDL
+         * @param[in] version - The version the newly created description will have.
+         *                      Set 0 for newest version.
+         * @remarks The sections have to be in the order of the DDL schema
+         * (header, units, datatypes, enums, structs, streams, streammetatypes),
+         * use \c setFile() and \c createNew() for other documents.
+         * @retval ERR_UNKNOWN_FORMAT Document not well-formed or sections out of order
+         * @retval ERR_OPEN_FAILED Header not found
+         * @retval ERR_NOT_FOUND Mandatory section not found
+         * @retval ERR_NO_CLASS Cross reference not resolvable (e.g. refUnit)
+         * @retval ERR_UNKNOWN Cross reference has not been resolved
+         */
+        a_util::result::Result createNewStreamed(std::istream& stream,
+            const DDLVersion& version = DDLVersion::ddl_version_invalid);
+
+        /**
+         * Method to create a new DDL from a file, building the structs on
+         * first access only.
+         * @param[in] file - Path to file to use
+         * @param[in] version - The version the newly created description will have.
+         *                      Set 0 for newest version.
+         * @retval ERR_OPEN_FAILED Reading process failed
+         * @see createNewLazy(std::istream&, const DDLVersion&)
+         */
+        a_util::result::Result createNewLazy(const a_util::filesystem::Path& file,
+            const DDLVersion& version = DDLVersion::ddl_version_invalid);
+
+        /**
+         * Method to create a new DDL in one pass over the given stream,
+         * building the structs on first access only. Like
+         * \c createNewStreamed(), but the definitions of the structs are only
+         * indexed by their name. \c DDLDescription::getStructByName() builds
+         * a struct together with all structs it depends on, accessors of all
+         * structs (e.g. \c DDLDescription::getStructs()) build the remaining
+         * ones. Structs used by streams are built right away.
+         * @param[in] stream - The stream containing the DDL
+         * @param[in] version - The version the newly created description will have.
+         *                      Set 0 for newest version.
+         * @remarks Errors in the definitions of structs are detected when they
+         * are built and logged, they are not part of the messages of the
+         * importer. \c DDLDescription::getStructSourceResult() returns the
+         * first of them. Lookups of structs of a lazy description may be
+         * called concurrently, they are serialized while structs are built.
+         * @retval ERR_UNKNOWN_FORMAT Document not well-formed or sections out of order
+         * @retval ERR_OPEN_FAILED Header not found
+         * @retval ERR_NOT_FOUND Mandatory section not found
+         * @retval ERR_NO_CLASS Cross reference not resolvable (e.g. refUnit)
+         * @retval ERR_UNKNOWN Cross reference has not been resolved
+         */
+        a_util::result::Result createNewLazy(std::istream& stream,
+            const DDLVersion& version = DDLVersion::ddl_version_invalid);
+
         /**
          * Getter for the description of the last error.
          * @return the error description
@@ -370,6 +444,57 @@ namespace ddl
                      DDLContainer<T>& first_data,
                      DDLContainer<T>& second_data);
 
+        /// Definitions of a streamed import that are not yet part of the description
+        struct StreamedImport;
+
+        /// Source of the structs of a lazy import
+        class LazyStructSource;
+
+        /**
+         * Creates a new DDL in one pass over the given stream.
+         * @param[in] stream - The stream containing the DDL
+         * @param[in] version - The version the newly created description will have
+         * @param[in] lazy_structs - The source to keep the structs in until first
+         * access, \c NULL to build them right away
+         * @retval ERR_UNKNOWN_FORMAT Document not well-formed or sections out of order
+         * @retval ERR_OPEN_FAILED Header not found
+         * @retval ERR_NOT_FOUND Mandatory section not found
+         * @retval ERR_NO_CLASS Cross reference not resolvable (e.g. refUnit)
+         * @retval ERR_UNKNOWN Cross reference has not been resolved
+         */
+        a_util::result::Result importStreamed(std::istream& stream, const DDLVersion& version,
+                                              LazyStructSource* lazy_structs);
+
+        /**
+         * Hands all pending definitions of a streamed import that precede
+         * the given kind of definition over to the description.
+         * @param[in] import - The streamed import
+         * @param[in] kind - The kind of definition that is about to be built
+         * @return void
+         */
+        void commitStreamed(StreamedImport& import, int kind);
+
+        /**
+         * Creates a single definition of a streamed import.
+         * @param[in] import - The streamed import
+         * @param[in] kind - The kind of definition
+         * @param[in] element - The DOMElement with the information
+         * @retval ERR_UNKNOWN_FORMAT Expected XML hierarchy not found
+         * @retval ERR_NO_CLASS Cross reference not resolvable
+         * @retval ERR_RESOURCE_IN_USE Definition is specified more than once
+         */
+        a_util::result::Result buildStreamed(StreamedImport& import, int kind,
+                                             const a_util::xml::DOMElement& element);
+
+        /**
+         * Checks the sections and references of a streamed import after all
+         * definitions have been built.
+         * @param[in] import - The streamed import
+         * @retval ERR_NOT_FOUND Mandatory section not found
+         * @retval ERR_UNKNOWN Cross reference has not been resolved
+         */
+        a_util::result::Result finishStreamed(StreamedImport& import);
+
     private:    // members
         a_util::xml::DOM _dom;
         DDLDescription *_ddl_desc;
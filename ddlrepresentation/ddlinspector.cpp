@@ -20,6 +20,7 @@
 #include "ddlinspector.h"
 #include <algorithm>
 #include <limits>
+#include <typeinfo>
 #include "a_util/result/error_def.h"
 #include "legacy_error_macros.h"
 
@@ -68,7 +69,8 @@ namespace ddl
         _suggestions{},
         _unit_names{},
         _version(0, 0),
-        _warning_level{WarningLevel::moderate}
+        _warning_level{WarningLevel::moderate},
+        _thread_count{1}
     {
         InitNewCheck();
     }
@@ -145,31 +147,45 @@ namespace ddl
         // validate complex data types
         DDLComplexVec vecStructs = poDescription->getStructs();
         _complex_names.clear();
-        for (DDLComplexIt itStruct = vecStructs.begin(); itStruct != vecStructs.end(); ++itStruct)
+        if (_thread_count > 1 && !_auto_correct && vecStructs.size() > 1 &&
+            typeid(*this) == typeid(DDLInspector))
         {
-            if (_has_struct_dynamic_arrays && !_has_dynamic_arrays)
+            // auto-correction writes the elements back, other workers might read them,
+            // and the workers are copies that would lose the overrides of derived classes
+            nRes = checkStructsConcurrently(vecStructs);
+            if (isFailed(nRes))
             {
-                _has_dynamic_arrays = true;
+                nResult = nRes;
             }
+        }
+        else
+        {
+            for (DDLComplexIt itStruct = vecStructs.begin(); itStruct != vecStructs.end(); ++itStruct)
+            {
+                if (_has_struct_dynamic_arrays && !_has_dynamic_arrays)
+                {
+                    _has_dynamic_arrays = true;
+                }
 
-            _has_struct_dynamic_arrays = false;
+                _has_struct_dynamic_arrays = false;
 
-            if (_complex_names.end() != _complex_names.find((*itStruct)->getName()))
-            {
-                addSuggestion(a_util::strings::format("The Name '%s' is duplicate",
-                    (*itStruct)->getName().c_str()), importer_error);
-                nResult = ERR_INVALID_ARG;
-            }
-            else
-            {
-                _complex_names.insert((*itStruct)->getName());
-            }
+                if (_complex_names.end() != _complex_names.find((*itStruct)->getName()))
+                {
+                    addSuggestion(a_util::strings::format("The Name '%s' is duplicate",
+                        (*itStruct)->getName().c_str()), importer_error);
+                    nResult = ERR_INVALID_ARG;
+                }
+                else
+                {
+                    _complex_names.insert((*itStruct)->getName());
+                }
 
-            nRes = (*itStruct)->accept(this);
-            if (isFailed(nRes))
-            {
-                // store error but continue with the remaining structs
-                nResult = nRes;
+                nRes = (*itStruct)->accept(this);
+                if (isFailed(nRes))
+                {
+                    // store error but continue with the remaining structs
+                    nResult = nRes;
+                }
             }
         }
 
@@ -196,6 +212,85 @@ namespace ddl
         return a_util::result::SUCCESS;
     }
 
+    a_util::result::Result DDLInspector::checkStructsConcurrently(const DDLComplexVec& vecStructs)
+    {
+        std::vector<DDLComplex*> vecToCheck(vecStructs.begin(), vecStructs.end());
+
+        std::vector<StructCheck> vecChecks(vecToCheck.size());
+        std::atomic<size_t> nNext(0);
+        std::vector<DDLInspector> vecWorkers(std::min(_thread_count, vecToCheck.size()), *this);
+        std::vector<a_util::concurrency::thread> vecThreads;
+        for (std::vector<DDLInspector>::iterator itWorker = vecWorkers.begin();
+            itWorker != vecWorkers.end(); ++itWorker)
+        {
+            vecThreads.push_back(a_util::concurrency::thread(&DDLInspector::checkStructs, &(*itWorker),
+                std::cref(vecToCheck), std::ref(vecChecks), std::ref(nNext)));
+        }
+        for (std::vector<a_util::concurrency::thread>::iterator itThread = vecThreads.begin();
+            itThread != vecThreads.end(); ++itThread)
+        {
+            itThread->join();
+        }
+
+        // merge in the order of the structs, exactly like the serial check does
+        a_util::result::Result nResult = a_util::result::SUCCESS;
+        for (size_t nStruct = 0; nStruct < vecToCheck.size(); ++nStruct)
+        {
+            if (_has_struct_dynamic_arrays && !_has_dynamic_arrays)
+            {
+                _has_dynamic_arrays = true;
+            }
+
+            const std::string& strName = vecToCheck[nStruct]->getName();
+            if (_complex_names.end() != _complex_names.find(strName))
+            {
+                addSuggestion(a_util::strings::format("The Name '%s' is duplicate",
+                    strName.c_str()), importer_error);
+                nResult = ERR_INVALID_ARG;
+            }
+            else
+            {
+                _complex_names.insert(strName);
+            }
+
+            StructCheck& sCheck = vecChecks[nStruct];
+            _suggestions.splice(_suggestions.end(), sCheck.suggestions);
+            if (isFailed(sCheck.result))
+            {
+                nResult = sCheck.result;
+            }
+            _has_struct_dynamic_arrays = sCheck.has_dynamic_arrays;
+        }
+
+        for (std::vector<DDLInspector>::const_iterator itWorker = vecWorkers.begin();
+            itWorker != vecWorkers.end(); ++itWorker)
+        {
+            for (std::map<const DDLComplex*, StructInfo>::const_iterator itInfo = itWorker->_struct_infos.begin();
+                itInfo != itWorker->_struct_infos.end(); ++itInfo)
+            {
+                _struct_infos[itInfo->first] = itInfo->second;
+            }
+        }
+
+        return nResult;
+    }
+
+    void DDLInspector::checkStructs(const std::vector<DDLComplex*>& vecStructs,
+        std::vector<StructCheck>& vecChecks,
+        std::atomic<size_t>& nNext)
+    {
+        for (size_t nStruct = nNext++; nStruct < vecStructs.size(); nStruct = nNext++)
+        {
+            _suggestions.clear();
+            _has_struct_dynamic_arrays = false;
+
+            StructCheck& sCheck = vecChecks[nStruct];
+            sCheck.result = vecStructs[nStruct]->accept(this);
+            sCheck.suggestions.swap(_suggestions);
+            sCheck.has_dynamic_arrays = _has_struct_dynamic_arrays;
+        }
+    }
+
     a_util::result::Result DDLInspector::visit(DDLHeader* poHeader)
     {
         if (NULL == poHeader)
@@ -520,6 +615,10 @@ namespace ddl
     {
         if (!poComplex) { return ERR_POINTER; }
 
+        // the const lookups do not correct the index of the description,
+        // so the workers of a concurrent check only read it
+        const DDLDescription* poDescription = _ddl_desc;
+
         StructInfo& sStructInfo = _struct_infos[poComplex];
         sStructInfo.valid = false;
         sStructInfo.size = 0;
@@ -559,14 +658,14 @@ namespace ddl
         for (DDLElementIt itElem = vecElements.begin();
             vecElements.end() != itElem; ++itElem)
         {
-            const IDDLDataType * poDT = _ddl_desc->getDataTypeByName((*itElem)->getType());
+            const IDDLDataType * poDT = poDescription->getDataTypeByName((*itElem)->getType());
             if (NULL == poDT)
             {
                 // no primitive data type
-                poDT = _ddl_desc->getStructByName((*itElem)->getType());
+                poDT = poDescription->getStructByName((*itElem)->getType());
                 if (NULL == poDT)
                 {
-                    poDT = _ddl_desc->getEnumByName((*itElem)->getType());
+                    poDT = poDescription->getEnumByName((*itElem)->getType());
                     if (NULL == poDT)
                     {
                         addSuggestion(a_util::strings::format("Type '%s' not found.",
@@ -592,7 +691,7 @@ namespace ddl
 
         // validate of nested structs
         std::string strLog = poComplex->getName();
-        if (false == checkValidyOfNestedStructs(_ddl_desc, poComplex->getName(), poComplex->getName(), strLog))
+        if (false == checkValidyOfNestedStructs(poDescription, poComplex->getName(), poComplex->getName(), strLog))
         {
             addSuggestion(a_util::strings::format("A complex data type is recursive defined: %s",
                 strLog.c_str()), importer_error);
@@ -653,14 +752,14 @@ namespace ddl
             }
 
             std::string strType = (*itElem)->getType();
-            const DDLDataType *poDT = _ddl_desc->getDataTypeByName(strType);
+            const DDLDataType *poDT = poDescription->getDataTypeByName(strType);
             if (NULL == poDT)
             {
-                const DDLEnum *poEnum = _ddl_desc->getEnumByName(strType);
+                const DDLEnum *poEnum = poDescription->getEnumByName(strType);
                 if (NULL == poEnum)
                 {
                     // complex data type
-                    DDLComplex* pSubStruct = _ddl_desc->getStructByName(strType);
+                    DDLComplex* pSubStruct = const_cast<DDLComplex*>(poDescription->getStructByName(strType));
                     if (!pSubStruct)
                     {
                         addSuggestion(a_util::strings::format("Element (Complex_Datatypes Element Name) '%s.%s' has an unkown type '%s'.",
@@ -682,7 +781,7 @@ namespace ddl
                 else
                 {
                     // enum type => treat like primitive data type
-                    poDT = _ddl_desc->getDataTypeByName(poEnum->getType());
+                    poDT = poDescription->getDataTypeByName(poEnum->getType());
                     uiElementSize = poDT->getNumBits() / 8;
                 }
             }
@@ -1010,6 +1109,16 @@ namespace ddl
         return _warning_level;
     }
 
+    void DDLInspector::setThreadCount(size_t nThreadCount)
+    {
+        _thread_count = nThreadCount;
+    }
+
+    size_t DDLInspector::getThreadCount() const
+    {
+        return _thread_count;
+    }
+
     uint64_t boolToInt(const std::string& bVar)
     {
         if ((bVar) == "true" || (bVar) == "on" || (bVar) == "1" || (bVar) == "tTrue")
@@ -20,6 +20,8 @@
 #ifndef DDL_INSPECTOR_H_INCLUDED
 #define DDL_INSPECTOR_H_INCLUDED
 
+#include <atomic>
+
 #include "ddl_common.h"
 #include "ddlvisitor_intf.h"
 #include "ddlimporter.h"
@@ -101,6 +103,24 @@ namespace ddl
         */
         WarningLevel getWarningLevel() const;
 
+        /**
+        * Setter for the amount of threads that check the structs of a description.
+        * With more than one thread the structs are checked concurrently, the
+        * suggestions are merged in the order of the structs, so the result is the
+        * same as with a serial check. Auto-correction always checks serially.
+        * The workers are copies of this inspector, so instances of derived classes
+        * always check serially as well.
+        * @param[in] thread_count - Amount of threads, 0 and 1 check serially (default)
+        * @return void
+        */
+        void setThreadCount(size_t thread_count);
+
+        /**
+        * Getter for the amount of threads that check the structs of a description.
+        * @returns the amount of threads
+        */
+        size_t getThreadCount() const;
+
         /**
          * Getter for the list of suggestions.
          * @returns the list of suggestions
@@ -201,6 +221,32 @@ namespace ddl
             const std::string& nested_struct_type_name, 
             std::string& log, 
             int struct_depth = 1);
+
+        /// Outcome of the check of a single struct on a worker thread
+        struct StructCheck
+        {
+            a_util::result::Result result;
+            ImporterMsgList suggestions;
+            bool has_dynamic_arrays;
+        };
+
+        /**
+        * Checks the structs of the description on worker threads and merges
+        * the outcomes in the order of the structs.
+        *  @param[in] structs - The structs to check
+        *  @return The result of the most recent struct that failed, SUCCESS otherwise
+        */
+        a_util::result::Result checkStructsConcurrently(const DDLComplexVec& structs);
+
+        /**
+        * Thread function of a worker, checks structs until none is left.
+        *  @param[in] structs - The structs to check
+        *  @param[out] checks - The outcomes, one per struct
+        *  @param[in,out] next - Index of the next struct to check
+        */
+        void checkStructs(const std::vector<DDLComplex*>& structs,
+            std::vector<StructCheck>& checks,
+            std::atomic<size_t>& next);
        
     private:    // members
         DDLDescription*               _ddl_desc;
@@ -263,6 +309,8 @@ namespace ddl
 
         WarningLevel                  _warning_level;
 
+        size_t                        _thread_count;
+
         /*
         * Boolean to know if a file contains a dynamic array
         */
@@ -123,14 +123,12 @@ namespace ddl
             return nResult;
         }
 
-        DDLComplexVec vecStructs = poDescription->getStructs();
-        DDLComplexIt itStructFound = std::find_if(vecStructs.begin(),
-                                                   vecStructs.end(), DDLCompareFunctor<>(_target));
-
-        if (itStructFound != vecStructs.end())
+        // looked up by name, so structs of a lazy description are built on demand only
+        const DDLComplex* poStructFound = poDescription->getStructByName(_target);
+        if (NULL != poStructFound)
         {
             // complex data type
-            nResult = (*itStructFound)->accept(this);
+            nResult = poStructFound->accept(this);
             return nResult;
         }
 
@@ -0,0 +1,280 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "ddlstreamscanner.h"
+
+#include <cstring>
+#include "a_util/result/error_def.h"
+
+namespace ddl
+{
+    //define all needed error types and values locally
+    _MAKE_RESULT(-36, ERR_UNKNOWN_FORMAT);
+
+    /// Amount of bytes read from the stream at once
+    static const size_t s_chunk_size = 64 * 1024;
+
+    DDLStreamScanner::DDLStreamScanner(std::istream& oStream) :
+        _stream(oStream),
+        _buffer(),
+        _pos(0),
+        _depth(0),
+        _section()
+    {
+    }
+
+    a_util::result::Result DDLStreamScanner::next(Item& sItem)
+    {
+        sItem.section.clear();
+        sItem.element.clear();
+        sItem.xml.clear();
+
+        // drop everything in front of the current position, no item refers to it anymore
+        if (_pos >= s_chunk_size)
+        {
+            _buffer.erase(0, _pos);
+            _pos = 0;
+        }
+
+        size_t nItemStart = std::string::npos;
+        int nItemDepth = 0;
+        for (;;)
+        {
+            size_t nTag = find("<");
+            if (std::string::npos == nTag)
+            {
+                if (std::string::npos != nItemStart || _depth != 0)
+                {
+                    return ERR_UNKNOWN_FORMAT;
+                }
+                // end of document
+                _pos = _buffer.size();
+                return a_util::result::SUCCESS;
+            }
+            _pos = nTag;
+            ensure(9);
+
+            if (_buffer.compare(_pos, 2, "<?") == 0)
+            {
+                if (!skipPast("?>")) { return ERR_UNKNOWN_FORMAT; }
+                continue;
+            }
+            if (_buffer.compare(_pos, 4, "<!--") == 0)
+            {
+                if (!skipPast("-->")) { return ERR_UNKNOWN_FORMAT; }
+                continue;
+            }
+            if (_buffer.compare(_pos, 9, "<![CDATA[") == 0)
+            {
+                if (!skipPast("]]>")) { return ERR_UNKNOWN_FORMAT; }
+                continue;
+            }
+            if (_buffer.compare(_pos, 2, "<!") == 0)
+            {
+                if (!skipPast(">")) { return ERR_UNKNOWN_FORMAT; }
+                continue;
+            }
+
+            size_t nTagStart = _pos;
+            std::string strName;
+            bool bEndTag = false;
+            bool bEmptyTag = false;
+            if (!readTag(strName, bEndTag, bEmptyTag))
+            {
+                return ERR_UNKNOWN_FORMAT;
+            }
+
+            if (bEndTag)
+            {
+                if (--_depth < 0)
+                {
+                    return ERR_UNKNOWN_FORMAT;
+                }
+                if (std::string::npos != nItemStart && _depth == nItemDepth)
+                {
+                    sItem.xml = _buffer.substr(nItemStart, _pos - nItemStart);
+                    return a_util::result::SUCCESS;
+                }
+                if (_depth == 1)
+                {
+                    _section.clear();
+                }
+                continue;
+            }
+
+            if (std::string::npos == nItemStart)
+            {
+                if (_depth == 1)
+                {
+                    if (strName != "header")
+                    {
+                        // start of a section
+                        _section = strName;
+                        sItem.section = strName;
+                        if (!bEmptyTag)
+                        {
+                            ++_depth;
+                        }
+                        return a_util::result::SUCCESS;
+                    }
+                    sItem.element = strName;
+                    nItemStart = nTagStart;
+                    nItemDepth = _depth;
+                }
+                else if (_depth == 2)
+                {
+                    sItem.section = _section;
+                    sItem.element = strName;
+                    nItemStart = nTagStart;
+                    nItemDepth = _depth;
+                }
+            }
+
+            if (bEmptyTag)
+            {
+                if (nItemStart == nTagStart)
+                {
+                    sItem.xml = _buffer.substr(nItemStart, _pos - nItemStart);
+                    return a_util::result::SUCCESS;
+                }
+                continue;
+            }
+            ++_depth;
+        }
+    }
+
+    bool DDLStreamScanner::fill()
+    {
+        if (!_stream.good())
+        {
+            return false;
+        }
+        size_t nOldSize = _buffer.size();
+        _buffer.resize(nOldSize + s_chunk_size);
+        _stream.read(&_buffer[nOldSize], s_chunk_size);
+        size_t nRead = static_cast<size_t>(_stream.gcount());
+        _buffer.resize(nOldSize + nRead);
+        return nRead > 0;
+    }
+
+    bool DDLStreamScanner::ensure(size_t nCount)
+    {
+        while (_buffer.size() - _pos < nCount)
+        {
+            if (!fill())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t DDLStreamScanner::find(const char* strToken)
+    {
+        size_t nLength = std::strlen(strToken);
+        size_t nFrom = _pos;
+        for (;;)
+        {
+            size_t nFound = _buffer.find(strToken, nFrom);
+            if (std::string::npos != nFound)
+            {
+                return nFound;
+            }
+            // the token may start within the last bytes and continue in the next chunk
+            if (_buffer.size() >= nLength && _buffer.size() - nLength + 1 > nFrom)
+            {
+                nFrom = _buffer.size() - nLength + 1;
+            }
+            if (!fill())
+            {
+                return std::string::npos;
+            }
+        }
+    }
+
+    bool DDLStreamScanner::skipPast(const char* strToken)
+    {
+        size_t nFound = find(strToken);
+        if (std::string::npos == nFound)
+        {
+            return false;
+        }
+        _pos = nFound + std::strlen(strToken);
+        return true;
+    }
+
+    bool DDLStreamScanner::readTag(std::string& strName, bool& bEndTag, bool& bEmptyTag)
+    {
+        size_t nCurrent = _pos + 1;
+        if (!ensure(2))
+        {
+            return false;
+        }
+        bEndTag = _buffer[nCurrent] == '/';
+        if (bEndTag)
+        {
+            ++nCurrent;
+        }
+
+        size_t nNameStart = nCurrent;
+        size_t nNameEnd = std::string::npos;
+        char cQuote = 0;
+        for (;; ++nCurrent)
+        {
+            if (nCurrent >= _buffer.size() && !fill())
+            {
+                return false;
+            }
+            char cCurrent = _buffer[nCurrent];
+            if (cQuote != 0)
+            {
+                // '>' is allowed within attribute values
+                if (cCurrent == cQuote)
+                {
+                    cQuote = 0;
+                }
+                continue;
+            }
+            if (std::string::npos == nNameEnd &&
+                (cCurrent == ' ' || cCurrent == '\t' || cCurrent == '\r' || cCurrent == '\n' ||
+                 cCurrent == '/' || cCurrent == '>'))
+            {
+                nNameEnd = nCurrent;
+            }
+            if (cCurrent == '"' || cCurrent == '\'')
+            {
+                cQuote = cCurrent;
+            }
+            else if (cCurrent == '>')
+            {
+                break;
+            }
+        }
+
+        if (nNameEnd == nNameStart)
+        {
+            return false;
+        }
+        strName = _buffer.substr(nNameStart, nNameEnd - nNameStart);
+        bEmptyTag = !bEndTag && _buffer[nCurrent - 1] == '/';
+        _pos = nCurrent + 1;
+        return true;
+    }
+
+}   // namespace ddl
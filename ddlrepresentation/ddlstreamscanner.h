@@ -0,0 +1,83 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef DDL_STREAM_SCANNER_H_INCLUDED
+#define DDL_STREAM_SCANNER_H_INCLUDED
+
+#include <istream>
+
+#include "ddl_common.h"
+
+namespace ddl
+{
+    /**
+     * Pull scanner splitting a DDL document into its top-level definitions
+     * (header, baseunits, prefixes, units, datatypes, enums, structs, streams
+     * and streammetatypes) without building a DOM of the whole document.
+     * The input is read in chunks and only the raw text of the current
+     * definition is kept in memory.
+     */
+    class DDLStreamScanner
+    {
+    public:
+        /**
+         * A single top-level definition or the start of a section.
+         */
+        struct Item
+        {
+            /// Name of the enclosing section (e.g. "structs"), empty for the header
+            std::string section;
+            /// Name of the definition (e.g. "struct"), empty at the start of a section
+            std::string element;
+            /// Raw XML of the definition
+            std::string xml;
+        };
+
+    public:
+        /**
+         * CTOR
+         * @param[in] stream - The stream to read the document from
+         */
+        DDLStreamScanner(std::istream& stream);
+
+        /**
+         * Reads the next item of the document.
+         * @param[out] item - The item, section and element are empty at the end of the document
+         * @retval ERR_UNKNOWN_FORMAT The document is not well-formed
+         */
+        a_util::result::Result next(Item& item);
+
+    private:    // methods
+        bool fill();
+        bool ensure(size_t count);
+        size_t find(const char* token);
+        bool skipPast(const char* token);
+        bool readTag(std::string& name, bool& end_tag, bool& empty_tag);
+
+    private:    // members
+        std::istream& _stream;
+        std::string _buffer;
+        size_t _pos;
+        int _depth;
+        std::string _section;
+    };
+
+}   // namespace ddl
+
+#endif  // DDL_STREAM_SCANNER_H_INCLUDED
@@ -0,0 +1,71 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef DDL_STRUCT_SOURCE_H_INCLUDED
+#define DDL_STRUCT_SOURCE_H_INCLUDED
+
+#include "ddl_common.h"
+
+namespace ddl
+{
+    class DDLDescription;
+    class DDLComplex;
+
+    /**
+     * Abstract base class/interface for sources of structs that are built
+     * on first access (see \c DDLImporter::createNewLazy()).
+     */
+    class IDDLStructSource
+    {
+    public:
+        /**
+         * DTOR
+         */
+        virtual ~IDDLStructSource() {}
+
+        /**
+         * Method to build a struct and all structs it depends on and to add
+         * them to the description.
+         * @param[in] description - The description to add the structs to
+         * @param[in] name - Name of the struct to build
+         * @return the struct or \c NULL if the source does not contain it
+         */
+        virtual DDLComplex* buildStruct(DDLDescription& description,
+                                        const std::string& name) = 0;
+
+        /**
+         * Method to build all structs that have not been built yet and to
+         * add them to the description.
+         * @param[in] description - The description to add the structs to
+         * @retval ERR_UNKNOWN Not all referenced structs have been resolved
+         * @retval ERR_UNKNOWN_FORMAT A definition of a struct could not be built
+         */
+        virtual a_util::result::Result buildAll(DDLDescription& description) = 0;
+
+        /**
+         * Getter for the first failure of building a struct.
+         * @retval a_util::result::SUCCESS All structs built so far are valid
+         * @retval ERR_UNKNOWN Not all referenced structs have been resolved
+         * @retval ERR_UNKNOWN_FORMAT A definition of a struct could not be built
+         */
+        virtual a_util::result::Result getResult() const = 0;
+    };
+}   // namespace ddl
+
+#endif  // DDL_STRUCT_SOURCE_H_INCLUDED
@@ -78,6 +78,7 @@ namespace ddl {
     #include "ddldatatype_intf.h"
     #include "ddlvisitor_intf.h"
     #include "ddlfactorymethod_intf.h"
+    #include "ddlstructsource_intf.h"
 
     // DDL object representation (OO-DDL)
     #include "ddlbyteorder.h"
@@ -156,6 +156,14 @@ bool MapTransformationBase::isValid() const
     return _is_valid;
 }
 
+void MapTransformationBase::evaluate(const double* pValues, double* pResults, size_t szCount) const
+{
+    for (size_t i = 0; i < szCount; ++i)
+    {
+        pResults[i] = evaluate(pValues[i]);
+    }
+}
+
 MapPolynomTransformation::MapPolynomTransformation(MapConfiguration* pConfig, const std::string& name)
     : MapTransformationBase(pConfig, name), _a(0), _b(0), _c(0), _d(0), _e(0)
 {
@@ -285,14 +293,25 @@ a_util::result::Result MapPolynomTransformation::writeToDOM(a_util::xml::DOMElem
 
 double MapPolynomTransformation::evaluate(double value) const
 {
-    double f64Pow2 = value*value;
-    double f64Pow3 = f64Pow2*value;
-    return (_a + _b*value + _c*f64Pow2 + _d*f64Pow3 + _e*f64Pow3*value);
+    // Horner's method
+    return (((_e*value + _d)*value + _c)*value + _b)*value + _a;
+}
+
+void MapPolynomTransformation::evaluate(const double* pValues, double* pResults, size_t szCount) const
+{
+    // the coefficients are copied so the compiler does not need to reload them
+    // after each store and can vectorize the loop across the elements
+    const double a = _a, b = _b, c = _c, d = _d, e = _e;
+    for (size_t i = 0; i < szCount; ++i)
+    {
+        const double value = pValues[i];
+        pResults[i] = (((e*value + d)*value + c)*value + b)*value + a;
+    }
 }
 
 
 MapEnumTableTransformation::MapEnumTableTransformation(MapConfiguration* pConfig, const std::string& name)
-    : MapTransformationBase(pConfig, name), _default_int(0), _default_value("0")
+    : MapTransformationBase(pConfig, name), _default_int(0), _default_value("0"), _table_offset(0)
 {
 }
 
@@ -485,7 +504,28 @@ a_util::result::Result MapEnumTableTransformation::removeConversion(const std::s
 
 double MapEnumTableTransformation::evaluate(double f64Value) const
 {
-    std::map<int64_t, int64_t>::const_iterator it = _conversions_int.find((int64_t)f64Value);
+    return lookUp(f64Value);
+}
+
+void MapEnumTableTransformation::evaluate(const double* pValues, double* pResults, size_t szCount) const
+{
+    for (size_t i = 0; i < szCount; ++i)
+    {
+        pResults[i] = lookUp(pValues[i]);
+    }
+}
+
+double MapEnumTableTransformation::lookUp(double f64Value) const
+{
+    int64_t nKey = (int64_t)f64Value;
+    if (!_table.empty())
+    {
+        // unsigned arithmetic checks both bounds at once without overflowing
+        uint64_t nIndex = (uint64_t)nKey - (uint64_t)_table_offset;
+        return nIndex < _table.size() ? _table[nIndex] : (double)_default_int;
+    }
+
+    std::map<int64_t, int64_t>::const_iterator it = _conversions_int.find(nKey);
     if(it != _conversions_int.end())
     {
         return (double)it->second;
@@ -493,6 +533,35 @@ double MapEnumTableTransformation::evaluate(double f64Value) const
     return (double)_default_int;
 }
 
+void MapEnumTableTransformation::createTable()
+{
+    // enumerations usually have small and consecutive values, a table covering at most
+    // 1024 keys replaces the tree lookup by an indexed load
+    static const uint64_t nMaxTableSize = 1024;
+
+    _table.clear();
+    _table_offset = 0;
+    if (_conversions_int.empty())
+    {
+        return;
+    }
+
+    int64_t nMin = _conversions_int.begin()->first;
+    int64_t nMax = _conversions_int.rbegin()->first;
+    if ((uint64_t)nMax - (uint64_t)nMin >= nMaxTableSize)
+    {
+        return;
+    }
+
+    _table_offset = nMin;
+    _table.resize((size_t)(nMax - nMin) + 1, (double)_default_int);
+    for (std::map<int64_t, int64_t>::const_iterator it = _conversions_int.begin();
+        it != _conversions_int.end(); ++it)
+    {
+        _table[(size_t)(it->first - nMin)] = (double)it->second;
+    }
+}
+
 a_util::result::Result MapEnumTableTransformation::setEnumsStr(const std::string& strEnumFrom, const std::string& strEnumTo)
 {
     _enum_from = strEnumFrom;
@@ -501,6 +570,7 @@ a_util::result::Result MapEnumTableTransformation::setEnumsStr(const std::string
     _conversions_int.clear();
     _conversions.clear();
     _default_value.clear();
+    createTable();
     return a_util::result::SUCCESS;
 }
 
@@ -596,5 +666,6 @@ a_util::result::Result MapEnumTableTransformation::convertValuesWithDDL()
             _conversions_int[a_util::strings::toInt64(strFromVal)] = a_util::strings::toInt64(strToVal);
         }
     }
+    createTable();
     return res;
 }
@@ -22,6 +22,8 @@
 #ifndef HEADER_MAP_TRANSFORMATION_H
 #define HEADER_MAP_TRANSFORMATION_H
 
+#include <vector>
+
 #include "a_util/result.h"
 #include "a_util/xml.h"
 #include "a_util/strings.h"
@@ -77,6 +79,15 @@ public:
     */
     virtual double evaluate(double value) const = 0;
 
+    /**
+    * Polymorphic evaluation method for arrays of values.
+    * The base implementation evaluates the values one by one.
+    * @param [in] values The values to evaluate
+    * @param [out] results The results, may be the same buffer as values
+    * @param [in] count The amount of values
+    */
+    virtual void evaluate(const double* values, double* results, size_t count) const;
+
 private:
     /**
     * creates a polymorphic transformation instance from a dom element
@@ -184,6 +195,11 @@ public:
     */
     double evaluate(double value) const;
 
+    /**
+    * @overload
+    */
+    void evaluate(const double* values, double* results, size_t count) const;
+
     /// nodoc
     MapTransformationBase* clone() const;
 
@@ -298,6 +314,11 @@ public:
     */
     double evaluate(double value) const;
 
+    /**
+    * @overload
+    */
+    void evaluate(const double* values, double* results, size_t count) const;
+
     /// nodoc
     MapTransformationBase* clone() const;
 
@@ -353,6 +374,18 @@ private:
     **/
     a_util::result::Result addConversionStr(const std::string& from, const std::string& to);
 
+    /**
+    * Builds the dense lookup table if the keys of the conversions lie in a small range
+    */
+    void createTable();
+
+    /**
+    * Looks up a single value in the conversions
+    * @param [in] value The value to look up
+    * @return the converted value or the default value
+    */
+    double lookUp(double value) const;
+
 private:
     /// @cond nodoc
     friend class MapTransformationBase;
@@ -363,6 +396,9 @@ private:
     MapStrConversionList _conversions;
     int64_t _default_int;
     std::map<int64_t, int64_t> _conversions_int;
+    // dense lookup table of the conversions starting at _table_offset, empty for sparse keys
+    std::vector<double> _table;
+    int64_t _table_offset;
     /// @endcond
 };
 
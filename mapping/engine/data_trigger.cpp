@@ -19,15 +19,91 @@
 
 #include "data_trigger.h"
 
+#include <cstring>
+#include "a_util/result/error_def.h"
+
+namespace mapping
+{
+namespace rt
+{
+    //define all needed error types and values locally
+    _MAKE_RESULT(-5, ERR_INVALID_ARG);
+    _MAKE_RESULT(-42, ERR_INVALID_TYPE);
+}
+}
+
+using namespace mapping;
 using namespace mapping::rt;
 
+/// Comparison of a source value of type T, the operator is resolved at compile time
+template <typename T, Operator OP>
+static bool CompareValue(const void* pData, double f64Value)
+{
+    T xValue;
+    std::memcpy(&xValue, pData, sizeof(T));
+    double f64Val = static_cast<double>(xValue);
+
+    switch(OP)
+    {
+    case e_equal:
+        return f64Val == f64Value;
+    case e_not_equal:
+        return f64Val != f64Value;
+    case e_less_than:
+        return f64Val < f64Value;
+    case e_greater_than:
+        return f64Val > f64Value;
+    case e_less_than_equal:
+        return f64Val <= f64Value;
+    case e_greater_than_equal:
+        return f64Val >= f64Value;
+    }
+
+    return false;
+}
+
+/// Helper method that selects the comparison instance for a source type
+template <Operator OP>
+static DataComparison SelectComparison(uint32_t type32)
+{
+    switch (type32)
+    {
+    case e_uint8:
+        return &CompareValue<uint8_t, OP>;
+    case e_uint16:
+        return &CompareValue<uint16_t, OP>;
+    case e_uint32:
+        return &CompareValue<uint32_t, OP>;
+    case e_uint64:
+        return &CompareValue<uint64_t, OP>;
+    case e_int8:
+        return &CompareValue<int8_t, OP>;
+    case e_int16:
+        return &CompareValue<int16_t, OP>;
+    case e_int32:
+        return &CompareValue<int32_t, OP>;
+    case e_int64:
+        return &CompareValue<int64_t, OP>;
+    case e_float32:
+        return &CompareValue<float, OP>;
+    case e_float64:
+        return &CompareValue<double, OP>;
+    case e_bool:
+        return &CompareValue<bool, OP>;
+    case e_char:
+        return &CompareValue<char, OP>;
+    default:
+        return NULL;
+    }
+}
+
 DataTrigger::DataTrigger(IMappingEnvironment& oEnv,
         const std::string& strTriggerName, 
         const std::string& strVariableName, 
         const std::string& strOperator, 
         const double& f64Value) : _env(oEnv), 
         _name(strTriggerName), _variable_name(strVariableName), 
-        _value(f64Value), _is_running(false)
+        _operator(static_cast<Operator>(0)), _value(f64Value), _is_running(false)
 {
     if(strOperator == "equal")
     {
@@ -99,23 +175,50 @@ a_util::result::Result DataTrigger::transmit()
 {
     if(_is_running)
     {
+        recordFire();
         for(TargetSet::iterator it = _targets.begin(); it != _targets.end(); ++it)
         {
-            const void* pBuffer = NULL;
-            size_t szBuffer = 0;
-            (*it)->aquireReadLock();
-            (*it)->updateTriggerFunctionValues();
-            if (isOk((*it)->getBufferRef(pBuffer, szBuffer)))
-            {
-                _env.sendTarget((handle_t)*it, pBuffer, szBuffer, 0);
-            }
-            (*it)->releaseReadLock();
+            (*it)->send(0);
         }
     }
 
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result DataTrigger::compileComparison(uint32_t type32, DataComparison& fnComparison) const
+{
+    switch(_operator)
+    {
+    case e_equal:
+        fnComparison = SelectComparison<e_equal>(type32);
+        break;
+    case e_not_equal:
+        fnComparison = SelectComparison<e_not_equal>(type32);
+        break;
+    case e_less_than:
+        fnComparison = SelectComparison<e_less_than>(type32);
+        break;
+    case e_greater_than:
+        fnComparison = SelectComparison<e_greater_than>(type32);
+        break;
+    case e_less_than_equal:
+        fnComparison = SelectComparison<e_less_than_equal>(type32);
+        break;
+    case e_greater_than_equal:
+        fnComparison = SelectComparison<e_greater_than_equal>(type32);
+        break;
+    default:
+        return ERR_INVALID_ARG;
+    }
+
+    return fnComparison ? a_util::result::SUCCESS : ERR_INVALID_TYPE;
+}
+
+double DataTrigger::getValue() const
+{
+    return _value;
+}
+
 const std::string& DataTrigger::getVariable() const
 {
     return _variable_name;
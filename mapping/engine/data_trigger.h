@@ -87,6 +87,21 @@ public:
     */
     bool compare(double value);
 
+    /**
+    * Method to resolve the comparison for a source type once
+    * @param [in] type32 The datatype of the source element
+    * @param [out] comparison The comparison to call with \ref getValue
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_TYPE The source type is not supported
+    * @retval ERR_INVALID_ARG  The operator of the trigger is not supported
+    */
+    a_util::result::Result compileComparison(uint32_t type32, DataComparison& comparison) const;
+
+    /**
+    * Returns the value the variable is compared with
+    */
+    double getValue() const;
+
     /**
     * Returns the period of the trigger in ms
     */
@@ -19,6 +19,11 @@
 
 #include "element.h"
 
+#include <algorithm>
+#include <cstring>
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
 using namespace mapping;
 using namespace mapping::rt;
 
@@ -33,194 +38,180 @@ namespace rt
 }
 }
 
-/// Helper method that sets a casted value in the coder
+/// Helper that casts a value into the type of a target element
 template <typename T>
-static void SetCastedValue(void* pDestination, unsigned int nArrayIndex, T* pData,
-    uint32_t type32)
+struct CastTo
 {
-    switch (type32)
+    template <typename S>
+    static inline T cast(S value)
     {
-    case e_uint8:
+        return static_cast<T>(value);
+    }
+};
+
+template <>
+struct CastTo<bool>
+{
+    template <typename S>
+    static inline bool cast(S value)
+    {
+        return value != 0;
+    }
+};
+
+/// Kernel that copies the source memory, used for equal types and structures
+static void CopyKernel(const void* pData, void* pDestination, unsigned int,
+    size_t szMem, const oo::MapTransformationBase*)
+{
+    a_util::memory::copy(pDestination, szMem, pData, szMem);
+}
+
+/// Kernel that casts all array elements from the source type into the target type
+/// note: the fixed size copies compile to plain (unaligned) loads and stores,
+/// so the loop can be vectorized by the compiler
+template <typename S, typename D>
+struct ConvertKernel
+{
+    static void run(const void* pData, void* pDestination, unsigned int nArraySize,
+        size_t, const oo::MapTransformationBase*)
+    {
+        assert(pData);
+        const uint8_t* pSource = static_cast<const uint8_t*>(pData);
+        uint8_t* pTarget = static_cast<uint8_t*>(pDestination);
+        for (unsigned int i = 0; i < nArraySize; ++i)
         {
-            uint8_t ui8Temp = static_cast<uint8_t>(*pData);
-            a_util::memory::copy((uint8_t*)pDestination + nArrayIndex, sizeof(uint8_t), &ui8Temp, sizeof(uint8_t));
+            S xValue;
+            std::memcpy(&xValue, pSource + i * sizeof(S), sizeof(S));
+            D xResult = CastTo<D>::cast(xValue);
+            std::memcpy(pTarget + i * sizeof(D), &xResult, sizeof(D));
         }
-        break;
-    case e_uint16:
+    }
+};
+
+/// Kernel that casts a single source value into the target type and writes it to all array elements
+template <typename S, typename D>
+struct FillKernel
+{
+    static void run(const void* pData, void* pDestination, unsigned int nArraySize,
+        size_t, const oo::MapTransformationBase*)
+    {
+        assert(pData);
+        S xValue;
+        std::memcpy(&xValue, pData, sizeof(S));
+        D xResult = CastTo<D>::cast(xValue);
+
+        uint8_t* pTarget = static_cast<uint8_t*>(pDestination);
+        for (unsigned int i = 0; i < nArraySize; ++i)
         {
-            uint16_t ui16Temp = static_cast<uint16_t>(*pData);
-            a_util::memory::copy((uint16_t*)pDestination + nArrayIndex, sizeof(uint16_t), &ui16Temp, sizeof(uint16_t));
+            std::memcpy(pTarget + i * sizeof(D), &xResult, sizeof(D));
         }
-        break;
-    case e_uint32:
+    }
+};
+
+/// Kernel that transforms all array elements and casts them into the target type.
+/// The elements are transformed in blocks with one call to the transformation per block.
+template <typename S, typename D>
+struct TransformKernel
+{
+    static void run(const void* pData, void* pDestination, unsigned int nArraySize,
+        size_t, const oo::MapTransformationBase* pTrans)
+    {
+        assert(pTrans);
+        assert(pData);
+        static const unsigned int nBlockSize = 64;
+        double aValues[nBlockSize];
+
+        const uint8_t* pSource = static_cast<const uint8_t*>(pData);
+        uint8_t* pTarget = static_cast<uint8_t*>(pDestination);
+        for (unsigned int nBlock = 0; nBlock < nArraySize; nBlock += nBlockSize)
         {
-            uint32_t ui32Temp = static_cast<uint32_t>(*pData);
-            a_util::memory::copy((uint32_t*)pDestination + nArrayIndex, sizeof(uint32_t), &ui32Temp, sizeof(uint32_t));
+            unsigned int nCount = std::min(nBlockSize, nArraySize - nBlock);
+            for (unsigned int i = 0; i < nCount; ++i)
+            {
+                S xValue;
+                std::memcpy(&xValue, pSource + (nBlock + i) * sizeof(S), sizeof(S));
+                aValues[i] = static_cast<double>(xValue);
+            }
+
+            pTrans->evaluate(aValues, aValues, nCount);
+
+            for (unsigned int i = 0; i < nCount; ++i)
+            {
+                D xResult = CastTo<D>::cast(aValues[i]);
+                std::memcpy(pTarget + (nBlock + i) * sizeof(D), &xResult, sizeof(D));
+            }
         }
-        break;
+    }
+};
+
+/// Helper method that selects the kernel instance for a target type
+template <template <typename, typename> class KERNEL, typename S>
+static AssignmentKernel SelectTargetKernel(uint32_t ui32DstType)
+{
+    switch (ui32DstType)
+    {
+    case e_uint8:
+        return &KERNEL<S, uint8_t>::run;
+    case e_uint16:
+        return &KERNEL<S, uint16_t>::run;
+    case e_uint32:
+        return &KERNEL<S, uint32_t>::run;
     case e_uint64:
-        {
-            uint64_t ui64Temp = static_cast<uint64_t>(*pData);
-            a_util::memory::copy((uint64_t*)pDestination + nArrayIndex, sizeof(uint64_t), &ui64Temp, sizeof(uint64_t));
-        }
-        break;
+        return &KERNEL<S, uint64_t>::run;
     case e_int8:
-        {
-            int8_t i8Temp = static_cast<int8_t>(*pData);
-            a_util::memory::copy((int8_t*)pDestination + nArrayIndex, sizeof(int8_t), &i8Temp, sizeof(int8_t));
-        }
-        break;
+        return &KERNEL<S, int8_t>::run;
     case e_int16:
-        {
-            int16_t i16Temp = static_cast<int16_t>(*pData);
-            a_util::memory::copy((int16_t*)pDestination + nArrayIndex, sizeof(int16_t), &i16Temp, sizeof(int16_t));
-        }
-        break;
+        return &KERNEL<S, int16_t>::run;
     case e_int32:
-        {
-            int32_t i32Temp = static_cast<int32_t>(*pData);
-            a_util::memory::copy((int32_t*)pDestination + nArrayIndex, sizeof(int32_t), &i32Temp, sizeof(int32_t));
-        }
-        break;
+        return &KERNEL<S, int32_t>::run;
     case e_int64:
-        {
-            int64_t i64Temp = static_cast<int64_t>(*pData);
-            a_util::memory::copy((int64_t*)pDestination + nArrayIndex, sizeof(int64_t), &i64Temp, sizeof(int64_t));
-        }
-        break;
+        return &KERNEL<S, int64_t>::run;
     case e_float32:
-        {
-            float f32Temp = static_cast<float>(*pData);
-            a_util::memory::copy((float*)pDestination + nArrayIndex, sizeof(float), &f32Temp, sizeof(float));
-        }
-        break;
+        return &KERNEL<S, float>::run;
     case e_float64:
-        {
-            double f64Temp = static_cast<double>(*pData);
-            a_util::memory::copy((double*)pDestination + nArrayIndex, sizeof(double), &f64Temp, sizeof(double));
-        }
-        break;
+        return &KERNEL<S, double>::run;
     case e_bool:
-        {
-            bool bTemp = *pData != 0 ? true : false;
-            a_util::memory::copy((bool*)pDestination + nArrayIndex, sizeof(bool), &bTemp, sizeof(bool));
-        }
-        break;
+        return &KERNEL<S, bool>::run;
     case e_char:
-        {
-            char cTemp = static_cast<char>(*pData);
-            a_util::memory::copy((char*)pDestination + nArrayIndex, sizeof(char), &cTemp, sizeof(char));
-        }
-        break;
+        return &KERNEL<S, char>::run;
     default:
-        assert(false);
-        break;
+        return NULL;
     }
 }
 
-template <>
-void SetCastedValue<bool>(void* pDestination, unsigned int nArrayIndex, bool* pData,
-    uint32_t type32)
+/// Helper method that selects the kernel instance for a source and a target type
+template <template <typename, typename> class KERNEL>
+static AssignmentKernel SelectKernel(uint32_t ui32SrcType, uint32_t ui32DstType)
 {
-    int nBool = *pData ? 1 : 0;
-    switch (type32)
+    switch (ui32SrcType)
     {
     case e_uint8:
-        {
-            uint8_t ui8Temp = static_cast<uint8_t>(nBool);
-            a_util::memory::copy((uint8_t*)pDestination + nArrayIndex, sizeof(uint8_t), &ui8Temp, sizeof(uint8_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, uint8_t>(ui32DstType);
     case e_uint16:
-        {
-            uint16_t ui16Temp = static_cast<uint16_t>(nBool);
-            a_util::memory::copy((uint16_t*)pDestination + nArrayIndex, sizeof(uint16_t), &ui16Temp, sizeof(uint16_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, uint16_t>(ui32DstType);
     case e_uint32:
-        {
-            uint32_t ui32Temp = static_cast<uint32_t>(nBool);
-            a_util::memory::copy((uint32_t*)pDestination + nArrayIndex, sizeof(uint32_t), &ui32Temp, sizeof(uint32_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, uint32_t>(ui32DstType);
     case e_uint64:
-        {
-            uint64_t ui64Temp = static_cast<uint64_t>(nBool);
-            a_util::memory::copy((uint64_t*)pDestination + nArrayIndex, sizeof(uint64_t), &ui64Temp, sizeof(uint64_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, uint64_t>(ui32DstType);
     case e_int8:
-        {
-            int8_t i8Temp = static_cast<int8_t>(nBool);
-            a_util::memory::copy((int8_t*)pDestination + nArrayIndex, sizeof(int8_t), &i8Temp, sizeof(int8_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, int8_t>(ui32DstType);
     case e_int16:
-        {
-            int16_t i16Temp = static_cast<int16_t>(nBool);
-            a_util::memory::copy((int16_t*)pDestination + nArrayIndex, sizeof(int16_t), &i16Temp, sizeof(int16_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, int16_t>(ui32DstType);
     case e_int32:
-        {
-            int32_t i32Temp = static_cast<int32_t>(nBool);
-            a_util::memory::copy((int32_t*)pDestination + nArrayIndex, sizeof(int32_t), &i32Temp, sizeof(int32_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, int32_t>(ui32DstType);
     case e_int64:
-        {
-            int64_t i64Temp = static_cast<int64_t>(nBool);
-            a_util::memory::copy((int64_t*)pDestination + nArrayIndex, sizeof(int64_t), &i64Temp, sizeof(int64_t));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, int64_t>(ui32DstType);
     case e_float32:
-        {
-            float f32Temp = static_cast<float>(nBool);
-            a_util::memory::copy((float*)pDestination + nArrayIndex, sizeof(float), &f32Temp, sizeof(float));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, float>(ui32DstType);
     case e_float64:
-        {
-            double f64Temp = static_cast<double>(nBool);
-            a_util::memory::copy((double*)pDestination + nArrayIndex, sizeof(double), &f64Temp, sizeof(double));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, double>(ui32DstType);
     case e_bool:
-        a_util::memory::copy((bool*)pDestination + nArrayIndex, sizeof(bool), pData, sizeof(bool));
-        break;
+        // bools are read as bytes
+        return SelectTargetKernel<KERNEL, uint8_t>(ui32DstType);
     case e_char:
-        {
-            char cTemp = static_cast<char>(nBool);
-            a_util::memory::copy((char*)pDestination + nArrayIndex, sizeof(char), &cTemp, sizeof(char));
-        }
-        break;
+        return SelectTargetKernel<KERNEL, char>(ui32DstType);
     default:
-        assert(false);
-        break;
-    }
-}
-
-template <typename T>
-static inline void TransformAndSetValueImpl(const void* pData, void* pDestination,
-    unsigned int nArraySize, const oo::MapTransformationBase* pTrans, uint32_t type32)
-{
-    assert(pTrans);
-    assert(pData);
-    for(unsigned int i = 0; i < nArraySize; i++)
-    {
-        double fValue = pTrans->evaluate(static_cast<double>(*((T*)pData + i)));
-        SetCastedValue(pDestination, i, &fValue, type32);
-    }
-}
-
-template <typename T>
-static inline void SetValueImpl(const void* pData, void* pDestination, unsigned int nArraySize,
-    uint32_t type32)
-{
-    assert(pData);
-    for(unsigned int i = 0; i < nArraySize; i++)
-    {
-        SetCastedValue<T>(pDestination, i, (T*)pData + i, type32);
+        return NULL;
     }
 }
 
@@ -300,116 +291,44 @@ a_util::result::Result TargetElement::setTransformation(const oo::MapTransformat
 }
 
 a_util::result::Result TargetElement::setValue(const void* pData, uint32_t ui32SrcType, size_t szMem)
+{
+    AssignmentKernel pKernel = NULL;
+    RETURN_IF_FAILED(compileAssignment(ui32SrcType, pKernel));
+    assign(pData, pKernel, szMem);
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result TargetElement::compileAssignment(uint32_t ui32SrcType, AssignmentKernel& pKernel) const
 {
     // Scalars (and enums converted to scalars)
     if(_type)
     {
         if(_transformation)
         {
-            switch(ui32SrcType)
-            {
-            case e_uint8:
-                TransformAndSetValueImpl<uint8_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_uint16:
-                TransformAndSetValueImpl<uint16_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_uint32:
-                TransformAndSetValueImpl<uint32_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_uint64:
-                TransformAndSetValueImpl<uint64_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_int8:
-                TransformAndSetValueImpl<int8_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_int16:
-                TransformAndSetValueImpl<int16_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_int32:
-                TransformAndSetValueImpl<int32_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_int64:
-                TransformAndSetValueImpl<int64_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_float32:
-                TransformAndSetValueImpl<float>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_float64:
-                TransformAndSetValueImpl<double>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_bool:
-                TransformAndSetValueImpl<uint8_t>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            case e_char:
-                TransformAndSetValueImpl<char>(pData, _element_ptr, _array_size, _transformation, _type_int);
-                break;
-            default: 
-                return ERR_INVALID_TYPE;
-            }
+            pKernel = SelectKernel<TransformKernel>(ui32SrcType, _type_int);
         }
         else if(_type_int == ui32SrcType)
         {
             // Source and target have the same type
-            a_util::memory::copy(_element_ptr, szMem, pData, szMem);
+            pKernel = &CopyKernel;
         }
         else
         {
             // Source and target have different types
-            switch(ui32SrcType)
-            {
-            case e_uint8:
-                SetValueImpl<uint8_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_uint16:
-                SetValueImpl<uint16_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_uint32:
-                SetValueImpl<uint32_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_uint64:
-                SetValueImpl<uint64_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_int8:
-                SetValueImpl<int8_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_int16:
-                SetValueImpl<int16_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_int32:
-                SetValueImpl<int32_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_int64:
-                SetValueImpl<int64_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_float32:
-                SetValueImpl<float>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_float64:
-                SetValueImpl<double>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_bool:
-                SetValueImpl<uint8_t>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            case e_char:
-                SetValueImpl<char>(pData, _element_ptr, _array_size, _type_int);
-                break;
-            default: 
-                return ERR_INVALID_TYPE;
-            }
+            pKernel = SelectKernel<ConvertKernel>(ui32SrcType, _type_int);
         }
+
+        return pKernel ? a_util::result::SUCCESS : ERR_INVALID_TYPE;
     }
     else if(_struct) // Structures
     {
         // Transformations are not allowed
-        a_util::memory::copy(_element_ptr, szMem, pData, szMem);
-    }
-    else
-    {
-        return ERR_INVALID_ARG;
+        pKernel = &CopyKernel;
+        return a_util::result::SUCCESS;
     }
 
-    return a_util::result::SUCCESS;
+    return ERR_INVALID_ARG;
 }
 
 Target* TargetElement::getTarget()
@@ -428,10 +347,14 @@ a_util::result::Result TargetElement::setDefaultValue(const std::string& strDefa
             fVal = a_util::strings::toDouble(strDefault);
         }
         
-        for(unsigned int i = 0; i < _array_size; i++)
+        AssignmentKernel pKernel = SelectKernel<FillKernel>(e_float64, _type_int);
+        if (!pKernel)
         {
-            SetCastedValue<double>(_element_ptr, i, &fVal, _type_int);
+            return ERR_INVALID_TYPE;
         }
+
+        // the value is converted once and written to all array elements
+        pKernel(&fVal, _element_ptr, _array_size, sizeof(fVal), NULL);
     }
 
     //Structures
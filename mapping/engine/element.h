@@ -37,6 +37,17 @@ namespace rt
 
 class Target;
 
+/**
+* Precompiled function that writes a source value (or array) into a target element
+* @param [in] data The pointer referencing the source value
+* @param [in] element_ptr The pointer referencing the element in the target buffer
+* @param [in] array_size The array size of the target element
+* @param [in] mem_size The size of the source value
+* @param [in] transformation The transformation to apply, may be NULL
+*/
+typedef void (*AssignmentKernel)(const void* data, void* element_ptr, unsigned int array_size,
+    size_t mem_size, const oo::MapTransformationBase* transformation);
+
 /// TargetElement represents a single signal element in the target
 class TargetElement
 {
@@ -87,6 +98,27 @@ public:
     */
     a_util::result::Result setValue(const void* data, uint32_t src_type, size_t mem_size);
 
+    /**
+    * Method to resolve the conversion of a source type into this element once
+    * @param [in] src_type The datatype of the source element
+    * @param [out] kernel The kernel to use with \ref assign
+    * @retval a_util::result::SUCCESS Everything went fine
+    * @retval ERR_INVALID_TYPE The source type can not be assigned to this element
+    * @retval ERR_INVALID_ARG The element is neither a scalar nor a structure
+    */
+    a_util::result::Result compileAssignment(uint32_t src_type, AssignmentKernel& kernel) const;
+
+    /**
+    * Setter value to the element using a precompiled kernel
+    * @param [in] data The pointer referencing the source buffer
+    * @param [in] kernel The kernel returned by \ref compileAssignment
+    * @param [in] mem_size The size of the source buffer
+    */
+    inline void assign(const void* data, AssignmentKernel kernel, size_t mem_size)
+    {
+        kernel(data, _element_ptr, _array_size, mem_size, _transformation);
+    }
+
     /**
     * Getter for the parent target reference
     * @returns The target
@@ -0,0 +1,235 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "emission_queue.h"
+
+#include <algorithm>
+
+#include "a_util/result/error_def.h"
+
+namespace mapping
+{
+namespace rt
+{
+    //define all needed error types and values locally
+    _MAKE_RESULT(-5, ERR_INVALID_ARG);
+    _MAKE_RESULT(-40, ERR_INVALID_STATE);
+}
+}
+
+using namespace mapping;
+using namespace mapping::rt;
+
+EmissionQueue::EmissionQueue(IMappingEnvironment& oEnv) :
+    _env(oEnv), _policy(e_drop_oldest), _worker_count(0),
+    _head(0), _count(0), _running(false), _dropped(0)
+{
+}
+
+EmissionQueue::~EmissionQueue()
+{
+    stop();
+}
+
+a_util::result::Result EmissionQueue::create(size_t szCapacity, size_t nWorkerCount,
+    BackpressurePolicy ePolicy)
+{
+    if (szCapacity == 0 || nWorkerCount == 0)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _emissions.clear();
+    _emissions.resize(szCapacity);
+    _head = 0;
+    _count = 0;
+    _worker_count = nWorkerCount;
+    _policy = ePolicy;
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result EmissionQueue::start()
+{
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    if (_running || _emissions.empty())
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _running = true;
+    for (size_t nWorker = 0; nWorker < _worker_count; ++nWorker)
+    {
+        _workers.push_back(a_util::concurrency::thread(&EmissionQueue::work, this));
+        _worker_ids.push_back(_workers.back().get_id());
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result EmissionQueue::stop()
+{
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        _running = false;
+    }
+    _not_empty.notify_all();
+    _not_full.notify_all();
+
+    // the workers send all queued emissions before they exit
+    for (std::vector<a_util::concurrency::thread>::iterator it = _workers.begin();
+        it != _workers.end(); ++it)
+    {
+        it->join();
+    }
+    _workers.clear();
+
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    _worker_ids.clear();
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result EmissionQueue::push(handle_t hTarget, const void* pData, size_t szSize,
+    timestamp_t tmTimeStamp)
+{
+    std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+    if (!_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    if (_policy == e_coalesce)
+    {
+        for (size_t nQueued = 0; nQueued < _count; ++nQueued)
+        {
+            Emission& oEmission = _emissions[(_head + nQueued) % _emissions.size()];
+            if (oEmission.target == hTarget)
+            {
+                oEmission.buffer.assign(static_cast<const uint8_t*>(pData),
+                    static_cast<const uint8_t*>(pData) + szSize);
+                oEmission.time_stamp = tmTimeStamp;
+                ++_dropped;
+                return a_util::result::SUCCESS;
+            }
+        }
+    }
+
+    if (_count == _emissions.size())
+    {
+        if (_policy == e_block)
+        {
+            if (isWorker())
+            {
+                // an emission triggered by sending another one, waiting for space in the
+                // queue that this worker empties would never end
+                oLock.unlock();
+                return _env.sendTarget(hTarget, pData, szSize, tmTimeStamp);
+            }
+
+            while (_running && _count == _emissions.size())
+            {
+                _not_full.wait(oLock);
+            }
+
+            if (!_running)
+            {
+                return ERR_INVALID_STATE;
+            }
+        }
+        else
+        {
+            dropOldest();
+        }
+    }
+
+    Emission& oEmission = _emissions[(_head + _count) % _emissions.size()];
+    oEmission.target = hTarget;
+    oEmission.time_stamp = tmTimeStamp;
+    oEmission.buffer.assign(static_cast<const uint8_t*>(pData),
+        static_cast<const uint8_t*>(pData) + szSize);
+    ++_count;
+
+    oLock.unlock();
+    _not_empty.notify_one();
+
+    return a_util::result::SUCCESS;
+}
+
+uint64_t EmissionQueue::getDroppedCount() const
+{
+    return _dropped;
+}
+
+BackpressurePolicy EmissionQueue::getPolicy() const
+{
+    return _policy;
+}
+
+void EmissionQueue::dropOldest()
+{
+    _head = (_head + 1) % _emissions.size();
+    --_count;
+    ++_dropped;
+}
+
+bool EmissionQueue::isWorker() const
+{
+    return std::find(_worker_ids.begin(), _worker_ids.end(), std::this_thread::get_id()) !=
+        _worker_ids.end();
+}
+
+void EmissionQueue::work()
+{
+    Emission oEmission;
+    for (;;)
+    {
+        {
+            std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+            while (_running && _count == 0)
+            {
+                _not_empty.wait(oLock);
+            }
+
+            if (_count == 0)
+            {
+                // stopped and drained
+                return;
+            }
+
+            // take over the buffer and leave the previous one for reuse
+            Emission& oQueued = _emissions[_head];
+            oEmission.target = oQueued.target;
+            oEmission.time_stamp = oQueued.time_stamp;
+            oEmission.buffer.swap(oQueued.buffer);
+            _head = (_head + 1) % _emissions.size();
+            --_count;
+        }
+        _not_full.notify_one();
+
+        _env.sendTarget(oEmission.target, oEmission.buffer.empty() ? NULL : &oEmission.buffer[0],
+            oEmission.buffer.size(), oEmission.time_stamp);
+    }
+}
@@ -0,0 +1,149 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef EMISSION_QUEUE_HEADER
+#define EMISSION_QUEUE_HEADER
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "a_util/result.h"
+#include "a_util/concurrency.h"
+
+#include "mapping_environment_intf.h"
+
+namespace mapping
+{
+namespace rt
+{
+
+/// Backpressure policies of the emission queue
+enum BackpressurePolicy
+{
+    // drop the oldest queued emission if the queue is full
+    e_drop_oldest = 1,
+    // block the trigger until a queued emission has been sent
+    e_block,
+    // replace a queued emission of the same target, drop the oldest if the queue is full
+    e_coalesce
+};
+
+/// EmissionQueue sends target buffers to the environment from worker threads,
+/// so triggers are not stalled by slow consumers
+class EmissionQueue
+{
+public:
+    /**
+    * CTOR
+    * @param [in] env The mapping environment
+    */
+    EmissionQueue(IMappingEnvironment& env);
+
+    /**
+    * DTOR
+    */
+    ~EmissionQueue();
+
+    /**
+    * Creation method to configure the queue
+    * @param [in] capacity The maximum amount of queued emissions
+    * @param [in] worker_count The amount of worker threads that send the emissions
+    * @param [in] policy The behaviour if the queue is full
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_ARG  Error capacity or worker count is zero
+    * @retval ERR_INVALID_STATE Error queue is running
+    */
+    a_util::result::Result create(size_t capacity, size_t worker_count, BackpressurePolicy policy);
+
+    /**
+    * Method to start the worker threads
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error queue is already running
+    */
+    a_util::result::Result start();
+
+    /**
+    * Method to send all queued emissions and stop the worker threads
+    * @retval a_util::result::SUCCESS      Everything went fine
+    */
+    a_util::result::Result stop();
+
+    /**
+    * Method to queue a copy of a target buffer.
+    * Emissions of the same target may be sent out of order if there is more than one worker.
+    * An emission pushed by a worker while a blocking queue is full is sent right away.
+    * @param [in] target The target handle
+    * @param [in] data The target buffer
+    * @param [in] size The size of the target buffer
+    * @param [in] time_stamp The time stamp of the emission
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error queue is not running
+    */
+    a_util::result::Result push(handle_t target, const void* data, size_t size,
+        timestamp_t time_stamp);
+
+    /**
+    * Getter for the amount of emissions that have been dropped or replaced
+    * @return the amount of dropped emissions
+    */
+    uint64_t getDroppedCount() const;
+
+    /**
+    * Getter for the backpressure policy
+    * @return the policy
+    */
+    BackpressurePolicy getPolicy() const;
+
+private:
+    /// @cond nodoc
+    struct Emission
+    {
+        handle_t target;
+        timestamp_t time_stamp;
+        std::vector<uint8_t> buffer;
+    };
+
+    void work();
+    void dropOldest();
+    bool isWorker() const;
+
+    IMappingEnvironment& _env;
+    BackpressurePolicy _policy;
+    size_t _worker_count;
+    // ring buffer of preallocated emissions, the buffers are swapped out and reused by the workers
+    std::vector<Emission> _emissions;
+    size_t _head;
+    size_t _count;
+    bool _running;
+    std::atomic<uint64_t> _dropped;
+    std::vector<a_util::concurrency::thread> _workers;
+    std::vector<std::thread::id> _worker_ids;
+    a_util::concurrency::mutex _mutex;
+    a_util::concurrency::condition_variable _not_empty;
+    a_util::concurrency::condition_variable _not_full;
+
+    EmissionQueue(const EmissionQueue&); // = delete;
+    EmissionQueue& operator=(const EmissionQueue&); // = delete;
+    /// @endcond
+};
+
+} // namespace rt
+} // namespace mapping
+#endif //EMISSION_QUEUE_HEADER
@@ -0,0 +1,100 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "instrumentation.h"
+
+using namespace mapping;
+using namespace mapping::rt;
+
+double LatencyStatistics::getMean() const
+{
+    return count == 0 ? 0.0 : static_cast<double>(total_ns) / static_cast<double>(count);
+}
+
+uint64_t LatencyStatistics::getPercentile(double f64Percentile) const
+{
+    uint64_t nRank = static_cast<uint64_t>(f64Percentile / 100.0 * static_cast<double>(count));
+    uint64_t nSeen = 0;
+    for (size_t nBucket = 0; nBucket < latency_bucket_count - 1; ++nBucket)
+    {
+        nSeen += buckets[nBucket];
+        if (nSeen > nRank || nSeen == count)
+        {
+            return (uint64_t)1 << nBucket;
+        }
+    }
+    return max_ns;
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::record(uint64_t nDuration)
+{
+    // index of the highest set bit + 1, so bucket n holds durations in [2^(n-1), 2^n)
+    size_t nBucket = 0;
+    for (uint64_t nRest = nDuration; nRest != 0 && nBucket < latency_bucket_count - 1; nRest >>= 1)
+    {
+        ++nBucket;
+    }
+
+    _buckets[nBucket].fetch_add(1, std::memory_order_relaxed);
+    _total.fetch_add(nDuration, std::memory_order_relaxed);
+
+    uint64_t nMax = _max.load(std::memory_order_relaxed);
+    while (nDuration > nMax &&
+        !_max.compare_exchange_weak(nMax, nDuration, std::memory_order_relaxed))
+    {
+    }
+}
+
+void LatencyHistogram::reset()
+{
+    for (size_t nBucket = 0; nBucket < latency_bucket_count; ++nBucket)
+    {
+        _buckets[nBucket].store(0, std::memory_order_relaxed);
+    }
+    _total.store(0, std::memory_order_relaxed);
+    _max.store(0, std::memory_order_relaxed);
+}
+
+void LatencyHistogram::getStatistics(LatencyStatistics& oStatistics) const
+{
+    // the values are not read atomically as a whole, so the count is derived from the buckets
+    // to keep the percentiles consistent
+    oStatistics.count = 0;
+    for (size_t nBucket = 0; nBucket < latency_bucket_count; ++nBucket)
+    {
+        oStatistics.buckets[nBucket] = _buckets[nBucket].load(std::memory_order_relaxed);
+        oStatistics.count += oStatistics.buckets[nBucket];
+    }
+    oStatistics.total_ns = _total.load(std::memory_order_relaxed);
+    oStatistics.max_ns = _max.load(std::memory_order_relaxed);
+}
+
+Instrumentation::Instrumentation() : _enabled(false)
+{
+}
+
+void Instrumentation::setEnabled(bool bEnabled)
+{
+    _enabled.store(bEnabled, std::memory_order_relaxed);
+}
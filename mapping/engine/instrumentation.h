@@ -0,0 +1,186 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef MAPPING_INSTRUMENTATION_HEADER
+#define MAPPING_INSTRUMENTATION_HEADER
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace mapping
+{
+namespace rt
+{
+
+/// Amount of buckets of a latency histogram, bucket n counts durations below 2^n ns
+/// and the last bucket counts all remaining durations
+static const size_t latency_bucket_count = 40;
+
+/// Snapshot of a latency histogram
+struct LatencyStatistics
+{
+    /// Amount of recorded durations
+    uint64_t count;
+    /// Sum of all recorded durations in ns
+    uint64_t total_ns;
+    /// Longest recorded duration in ns
+    uint64_t max_ns;
+    /// Amount of durations per bucket
+    uint64_t buckets[latency_bucket_count];
+
+    /**
+    * Getter for the mean duration
+    * @return the mean duration in ns, 0 if nothing has been recorded
+    */
+    double getMean() const;
+
+    /**
+    * Getter for a percentile of the durations
+    * @param [in] percentile The percentile between 0 and 100
+    * @return the upper bound of the bucket that contains the percentile in ns
+    */
+    uint64_t getPercentile(double percentile) const;
+};
+
+/// Statistics of a mapped source
+struct SourceStatistics
+{
+    /// Name of the source
+    std::string name;
+    /// Amount of samples received
+    uint64_t samples_received;
+    /// Time spent in onSampleReceived
+    LatencyStatistics receive_time;
+};
+
+/// Statistics of a mapped target
+struct TargetStatistics
+{
+    /// Name of the target
+    std::string name;
+    /// Amount of target buffers sent
+    uint64_t emissions;
+    /// Time spent waiting for the target buffer lock, by sources and triggers
+    LatencyStatistics lock_wait;
+    /// Time spent handing the target buffer to the environment or the emission queue
+    LatencyStatistics send_time;
+    /// Time from the first source sample that updated the target until the target was sent
+    LatencyStatistics source_to_emit;
+};
+
+/// Statistics of a trigger
+struct TriggerStatistics
+{
+    /// Name of the trigger, as used by the mapping engine
+    std::string name;
+    /// Amount of times the trigger fired while running
+    uint64_t fire_count;
+};
+
+/// Statistics of all sources, targets and triggers of a mapping engine
+struct MappingStatistics
+{
+    /// Source statistics
+    std::vector<SourceStatistics> sources;
+    /// Target statistics
+    std::vector<TargetStatistics> targets;
+    /// Trigger statistics
+    std::vector<TriggerStatistics> triggers;
+};
+
+/// Lock-free histogram of durations with logarithmic buckets
+class LatencyHistogram
+{
+public:
+    /// CTOR
+    LatencyHistogram();
+
+    /**
+    * Method to record a duration
+    * @param [in] duration_ns The duration in ns
+    */
+    void record(uint64_t duration_ns);
+
+    /**
+    * Method to clear all recorded durations
+    */
+    void reset();
+
+    /**
+    * Getter for a snapshot of the histogram
+    * @param [out] statistics The destination of the snapshot
+    */
+    void getStatistics(LatencyStatistics& statistics) const;
+
+private:
+    /// @cond nodoc
+    std::atomic<uint64_t> _buckets[latency_bucket_count];
+    std::atomic<uint64_t> _total;
+    std::atomic<uint64_t> _max;
+
+    LatencyHistogram(const LatencyHistogram&); // = delete;
+    LatencyHistogram& operator=(const LatencyHistogram&); // = delete;
+    /// @endcond
+};
+
+/// Switch for the instrumentation of all sources, targets and triggers of a mapping engine.
+/// If disabled, the instrumented code paths cost a single relaxed load.
+class Instrumentation
+{
+public:
+    /// CTOR
+    Instrumentation();
+
+    /**
+    * Setter for the instrumentation state
+    * @param [in] enabled True to collect statistics
+    */
+    void setEnabled(bool enabled);
+
+    /**
+    * Getter for the instrumentation state
+    * @return true if statistics are collected
+    */
+    inline bool isEnabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    /**
+    * Getter for a monotonic time stamp
+    * @return the time stamp in ns
+    */
+    static inline uint64_t now()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+private:
+    /// @cond nodoc
+    std::atomic<bool> _enabled;
+    /// @endcond
+};
+
+} // namespace rt
+} // namespace mapping
+#endif //MAPPING_INSTRUMENTATION_HEADER
@@ -19,6 +19,8 @@
 
 #include "mapping_engine.h"
 
+#include <algorithm>
+
 #include "a_util/result/error_def.h"
 #include "legacy_error_macros.h"
 
@@ -39,13 +41,15 @@ using namespace mapping;
 using namespace mapping::rt;
 
 MappingEngine::MappingEngine(IMappingEnvironment& oEnv):
-    _env(oEnv), _map_config(NULL), _running(false)
+    _env(oEnv), _map_config(NULL), _running(false), _publication_mode(e_publish_locked),
+    _scheduler(oEnv), _max_shard_count(0), _shard_capacity(0), _shard_count(0)
 {
 }
 
 MappingEngine::~MappingEngine()
 {
     stop();
+    destroyShards();
     unmapAll();
 }
 
@@ -135,6 +139,8 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
         }
         else
         {
+            pTarget->setPublicationMode(_publication_mode);
+            pTarget->setEmissionQueue(_emission_queue.get());
             _targets[strTargetName] = pTarget;
         }
     }
@@ -174,7 +180,7 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
                 if(_triggers.find(strTrigName) == _triggers.end())
                 {
                     PeriodicTrigger* pTrigger = new PeriodicTrigger(_env, strTrigName,
-                        pMapPTrigger->getPeriod());
+                        pMapPTrigger->getPeriod(), &_scheduler);
                     nRes = pTrigger->create();
                     if (isFailed(nRes))
                     {
@@ -260,6 +266,17 @@ a_util::result::Result MappingEngine::Map(const std::string& strTargetName, hand
 
     if(isOk(nRes))
     {
+        // new sources and triggers are instrumented as well, the others are not affected
+        pTarget->setInstrumentation(&_instrumentation);
+        for (SourceMap::iterator it = _sources.begin(); it != _sources.end(); ++it)
+        {
+            it->second->setInstrumentation(&_instrumentation);
+        }
+        for (TriggerMap::iterator it = _triggers.begin(); it != _triggers.end(); ++it)
+        {
+            it->second->setInstrumentation(&_instrumentation);
+        }
+
         hMappedSignal = reinterpret_cast<handle_t>(pTarget);
         _env.targetMapped(strTargetName.c_str(), pTarget->getType().c_str(), hMappedSignal, pTarget->getSize());
     }
@@ -289,6 +306,16 @@ a_util::result::Result MappingEngine::start()
     {
         return ERR_INVALID_STATE;
     }
+
+    // start the emission queue before the triggers that fill it
+    if (_emission_queue)
+    {
+        RETURN_IF_FAILED(_emission_queue->start());
+    }
+    if (_max_shard_count > 0)
+    {
+        RETURN_IF_FAILED(startShards());
+    }
     _running = true;
 
     // start the triggers in order to send targets
@@ -335,11 +362,20 @@ a_util::result::Result MappingEngine::stop()
     }
     _running = false;
 
+    // map the queued samples while their triggers are still running
+    stopShards();
+
     // stop the triggers in order to send targets
     for(TriggerMap::iterator it = _triggers.begin(); it != _triggers.end(); it++)
     {
         it->second->stop();
     }
+
+    // send all queued targets
+    if (_emission_queue)
+    {
+        RETURN_IF_FAILED(_emission_queue->stop());
+    }
     return a_util::result::SUCCESS;
 }
 
@@ -407,6 +443,305 @@ a_util::result::Result MappingEngine::unmapAll()
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result MappingEngine::setPublicationMode(PublicationMode eMode)
+{
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _publication_mode = eMode;
+    for (TargetMap::iterator it = _targets.begin(); it != _targets.end(); ++it)
+    {
+        it->second->setPublicationMode(eMode);
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingEngine::enableAsyncEmission(size_t szCapacity, size_t nWorkerCount,
+    BackpressurePolicy ePolicy)
+{
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    a_util::memory::unique_ptr<EmissionQueue> pQueue(new EmissionQueue(_env));
+    RETURN_IF_FAILED(pQueue->create(szCapacity, nWorkerCount, ePolicy));
+    _emission_queue.reset(pQueue.release());
+
+    for (TargetMap::iterator it = _targets.begin(); it != _targets.end(); ++it)
+    {
+        it->second->setEmissionQueue(_emission_queue.get());
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingEngine::disableAsyncEmission()
+{
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    for (TargetMap::iterator it = _targets.begin(); it != _targets.end(); ++it)
+    {
+        it->second->setEmissionQueue(NULL);
+    }
+    _emission_queue.reset();
+
+    return a_util::result::SUCCESS;
+}
+
+uint64_t MappingEngine::getDroppedEmissionCount() const
+{
+    return _emission_queue ? _emission_queue->getDroppedCount() : 0;
+}
+
+a_util::result::Result MappingEngine::enableSharding(size_t szShardCount, size_t szCapacity)
+{
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+    if (szShardCount == 0 || szCapacity == 0)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    _max_shard_count = szShardCount;
+    _shard_capacity = szCapacity;
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingEngine::disableSharding()
+{
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _max_shard_count = 0;
+    stopShards();
+    _shard_count = 0;
+    return a_util::result::SUCCESS;
+}
+
+size_t MappingEngine::getShardCount() const
+{
+    return _shard_count;
+}
+
+uint64_t MappingEngine::getFailedSampleCount() const
+{
+    uint64_t nFailed = 0;
+    for (size_t nShard = 0; nShard < _shard_count; ++nShard)
+    {
+        nFailed += _shards[nShard]->getFailedCount();
+    }
+    return nFailed;
+}
+
+/// Finds the representative of the connected component of a target
+static const Target* findComponent(std::map<const Target*, const Target*>& mapParents,
+    const Target* pTarget)
+{
+    const Target* pRoot = pTarget;
+    while (mapParents[pRoot] != pRoot)
+    {
+        pRoot = mapParents[pRoot];
+    }
+
+    // compress the path
+    while (mapParents[pTarget] != pRoot)
+    {
+        const Target* pNext = mapParents[pTarget];
+        mapParents[pTarget] = pRoot;
+        pTarget = pNext;
+    }
+
+    return pRoot;
+}
+
+a_util::result::Result MappingEngine::startShards()
+{
+    stopShards();
+    _shard_count = 0;
+
+    // sources that assign or trigger a common target belong to the same component
+    std::map<const Target*, const Target*> mapParents;
+    std::vector<std::pair<Source*, const Target*> > vecSourceTargets;
+    for (SourceMap::iterator it = _sources.begin(); it != _sources.end(); ++it)
+    {
+        std::vector<const Target*> vecTargets;
+        it->second->getConnectedTargets(vecTargets);
+        if (vecTargets.empty())
+        {
+            continue;
+        }
+
+        for (std::vector<const Target*>::iterator itTarget = vecTargets.begin();
+            itTarget != vecTargets.end(); ++itTarget)
+        {
+            if (mapParents.find(*itTarget) == mapParents.end())
+            {
+                mapParents[*itTarget] = *itTarget;
+            }
+        }
+
+        const Target* pRoot = findComponent(mapParents, vecTargets.front());
+        for (std::vector<const Target*>::iterator itTarget = vecTargets.begin() + 1;
+            itTarget != vecTargets.end(); ++itTarget)
+        {
+            const Target* pOtherRoot = findComponent(mapParents, *itTarget);
+            if (pOtherRoot != pRoot)
+            {
+                mapParents[pOtherRoot] = pRoot;
+            }
+        }
+        vecSourceTargets.push_back(std::make_pair(it->second, vecTargets.front()));
+    }
+
+    // the amount of targets is the weight of a component
+    std::map<const Target*, size_t> mapWeights;
+    for (std::map<const Target*, const Target*>::iterator it = mapParents.begin();
+        it != mapParents.end(); ++it)
+    {
+        ++mapWeights[findComponent(mapParents, it->first)];
+    }
+    if (mapWeights.empty())
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    // distribute the heaviest components first, each to the shard with the least targets
+    std::vector<std::pair<size_t, const Target*> > vecComponents;
+    for (std::map<const Target*, size_t>::iterator it = mapWeights.begin(); it != mapWeights.end(); ++it)
+    {
+        vecComponents.push_back(std::make_pair(it->second, it->first));
+    }
+    std::sort(vecComponents.rbegin(), vecComponents.rend());
+
+    size_t szShardCount = std::min(_max_shard_count, vecComponents.size());
+    std::vector<size_t> vecLoads(szShardCount, 0);
+    std::map<const Target*, size_t> mapComponentShards;
+    for (size_t nComponent = 0; nComponent < vecComponents.size(); ++nComponent)
+    {
+        size_t nShard = std::min_element(vecLoads.begin(), vecLoads.end()) - vecLoads.begin();
+        vecLoads[nShard] += vecComponents[nComponent].first;
+        mapComponentShards[vecComponents[nComponent].second] = nShard;
+    }
+
+    // the shards of a previous start are reused, see destroyShards
+    while (_shards.size() < szShardCount)
+    {
+        _shards.push_back(new MappingShard());
+    }
+    for (size_t nShard = 0; nShard < szShardCount; ++nShard)
+    {
+        _shard_count = nShard + 1;
+        a_util::result::Result nRes = _shards[nShard]->create(_shard_capacity);
+        if (isOk(nRes))
+        {
+            nRes = _shards[nShard]->start();
+        }
+        if (isFailed(nRes))
+        {
+            stopShards();
+            _shard_count = 0;
+            return nRes;
+        }
+    }
+
+    for (std::vector<std::pair<Source*, const Target*> >::iterator it = vecSourceTargets.begin();
+        it != vecSourceTargets.end(); ++it)
+    {
+        it->first->setShard(_shards[mapComponentShards[findComponent(mapParents, it->second)]]);
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+void MappingEngine::stopShards()
+{
+    // stopped shards reject samples once they are drained, so the sources map them
+    // directly and in order until they are detached
+    for (std::vector<MappingShard*>::iterator it = _shards.begin(); it != _shards.end(); ++it)
+    {
+        (*it)->stop();
+    }
+
+    for (SourceMap::iterator it = _sources.begin(); it != _sources.end(); ++it)
+    {
+        it->second->setShard(NULL);
+    }
+}
+
+void MappingEngine::destroyShards()
+{
+    // a source callback may still hold a detached shard, so the shards are only deleted
+    // together with the engine, which the environment must not call anymore
+    stopShards();
+    for (std::vector<MappingShard*>::iterator it = _shards.begin(); it != _shards.end(); ++it)
+    {
+        delete *it;
+    }
+    _shards.clear();
+}
+
+void MappingEngine::enableInstrumentation(bool bEnabled)
+{
+    _instrumentation.setEnabled(bEnabled);
+}
+
+bool MappingEngine::isInstrumentationEnabled() const
+{
+    return _instrumentation.isEnabled();
+}
+
+void MappingEngine::getStatistics(MappingStatistics& oStatistics) const
+{
+    oStatistics.sources.resize(_sources.size());
+    size_t nIdx = 0;
+    for (SourceMap::const_iterator it = _sources.begin(); it != _sources.end(); ++it, ++nIdx)
+    {
+        it->second->getStatistics(oStatistics.sources[nIdx]);
+    }
+
+    oStatistics.targets.resize(_targets.size());
+    nIdx = 0;
+    for (TargetMap::const_iterator it = _targets.begin(); it != _targets.end(); ++it, ++nIdx)
+    {
+        it->second->getStatistics(oStatistics.targets[nIdx]);
+    }
+
+    oStatistics.triggers.resize(_triggers.size());
+    nIdx = 0;
+    for (TriggerMap::const_iterator it = _triggers.begin(); it != _triggers.end(); ++it, ++nIdx)
+    {
+        oStatistics.triggers[nIdx].name = it->first;
+        oStatistics.triggers[nIdx].fire_count = it->second->getFireCount();
+    }
+}
+
+void MappingEngine::resetStatistics()
+{
+    for (SourceMap::iterator it = _sources.begin(); it != _sources.end(); ++it)
+    {
+        it->second->resetStatistics();
+    }
+    for (TargetMap::iterator it = _targets.begin(); it != _targets.end(); ++it)
+    {
+        it->second->resetStatistics();
+    }
+    for (TriggerMap::iterator it = _triggers.begin(); it != _triggers.end(); ++it)
+    {
+        it->second->resetStatistics();
+    }
+}
+
 a_util::result::Result MappingEngine::getCurrentData(handle_t hMappedSignal,
     void* pTargetBuffer, size_t szTargetBuffer) const
 {
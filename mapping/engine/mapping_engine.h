@@ -35,8 +35,12 @@
 #include "target.h"
 #include "trigger.h"
 #include "periodic_trigger.h"
+#include "periodic_scheduler.h"
 #include "data_trigger.h"
 #include "signal_trigger.h"
+#include "emission_queue.h"
+#include "instrumentation.h"
+#include "mapping_shard.h"
 
 namespace mapping
 {
@@ -118,6 +122,104 @@ public:
     */
     bool hasTriggers(handle_t mapped_signal) const;
 
+    /**
+    * Setter for the publication mode of all current and future targets
+    * @param [in] mode The publication mode
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error mapping is running
+    */
+    a_util::result::Result setPublicationMode(PublicationMode mode);
+
+    /**
+    * Method to send all targets asynchronously from worker threads
+    * @param [in] capacity The maximum amount of queued target emissions
+    * @param [in] worker_count The amount of worker threads
+    * @param [in] policy The behaviour if the queue is full
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_ARG  Error capacity or worker count is zero
+    * @retval ERR_INVALID_STATE Error mapping is running
+    */
+    a_util::result::Result enableAsyncEmission(size_t capacity, size_t worker_count,
+        BackpressurePolicy policy);
+
+    /**
+    * Method to send all targets synchronously from the triggers again
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error mapping is running
+    */
+    a_util::result::Result disableAsyncEmission();
+
+    /**
+    * Getter for the amount of target emissions that have been dropped by the emission queue
+    * @return the amount of dropped emissions
+    */
+    uint64_t getDroppedEmissionCount() const;
+
+    /**
+    * Method to map the samples of unrelated sources in parallel. On start, the sources are
+    * partitioned into groups that share no targets, and the groups are distributed over
+    * shards that map their samples on their own worker thread.
+    * The environment may deliver samples concurrently while sharding is enabled.
+    * A sample that is sent back into the mapping from within \c sendTarget is mapped right
+    * away by the worker of its shard.
+    * @param [in] shard_count The maximum amount of shards
+    * @param [in] capacity The maximum amount of queued samples per shard
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_ARG  Error shard count or capacity is zero
+    * @retval ERR_INVALID_STATE Error mapping is running
+    */
+    a_util::result::Result enableSharding(size_t shard_count, size_t capacity);
+
+    /**
+    * Method to map the samples in the callbacks of the environment again
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error mapping is running
+    */
+    a_util::result::Result disableSharding();
+
+    /**
+    * Getter for the amount of shards created by the last start
+    * @return the amount of shards, 0 if sharding is disabled
+    */
+    size_t getShardCount() const;
+
+    /**
+    * Getter for the amount of queued samples that the shards of the last start failed to map
+    * @return the amount of failed samples, 0 if sharding is disabled
+    */
+    uint64_t getFailedSampleCount() const;
+
+    /**
+    * Method to switch the collection of statistics on or off, also while the mapping is running.
+    * Disabled instrumentation costs a single relaxed load per sample, lock and emission.
+    * The benchmark cases mapping/flat/sample/instrumentation_off and _on measure the overhead.
+    * @param [in] enabled True to collect statistics
+    */
+    void enableInstrumentation(bool enabled);
+
+    /**
+    * Getter for the state of the instrumentation
+    * @return true if statistics are collected
+    */
+    bool isInstrumentationEnabled() const;
+
+    /**
+    * Getter for the statistics of all sources, targets and triggers, collected while the
+    * instrumentation was enabled. Must not be called concurrently to Map or unmap.
+    * @param [out] statistics The destination of the statistics
+    */
+    void getStatistics(MappingStatistics& statistics) const;
+
+    /**
+    * Method to clear the statistics of all sources, targets and triggers
+    */
+    void resetStatistics();
+
     /**
     * Method to send current data
     *
@@ -147,9 +249,36 @@ private:
     */
     a_util::result::Result initializeModel();
 
+    /**
+    * Method to partition the sources into shards and start them
+    *
+    * @retval a_util::result::SUCCESS      Everything went fine
+    */
+    a_util::result::Result startShards();
+
+    /**
+    * Method to map all queued samples and detach the shards from the sources.
+    * The stopped shards are kept for the next start.
+    */
+    void stopShards();
+
+    /**
+    * Method to stop and delete the shards, only called by the DTOR
+    */
+    void destroyShards();
+
 private:
     IMappingEnvironment& _env;
     bool _running;
+    PublicationMode _publication_mode;
+    a_util::memory::unique_ptr<EmissionQueue> _emission_queue;
+    Instrumentation _instrumentation;
+    size_t _max_shard_count;
+    size_t _shard_capacity;
+    // all shards ever created, the first _shard_count of them were started by the last start
+    std::vector<MappingShard*> _shards;
+    size_t _shard_count;
+    PeriodicScheduler _scheduler;
 
     oo::MapConfiguration _map_config;
     TargetMap _targets;
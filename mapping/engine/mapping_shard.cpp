@@ -0,0 +1,182 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "mapping_shard.h"
+
+#include "a_util/result/error_def.h"
+
+#include "source.h"
+
+namespace mapping
+{
+namespace rt
+{
+    //define all needed error types and values locally
+    _MAKE_RESULT(-5, ERR_INVALID_ARG);
+    _MAKE_RESULT(-40, ERR_INVALID_STATE);
+}
+}
+
+using namespace mapping;
+using namespace mapping::rt;
+
+MappingShard::MappingShard() : _head(0), _count(0), _running(false), _busy(false), _failed(0)
+{
+}
+
+MappingShard::~MappingShard()
+{
+    stop();
+}
+
+a_util::result::Result MappingShard::create(size_t szCapacity)
+{
+    if (szCapacity == 0)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    if (_running)
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _samples.clear();
+    _samples.resize(szCapacity);
+    _head = 0;
+    _count = 0;
+    _failed = 0;
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingShard::start()
+{
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    if (_running || _samples.empty())
+    {
+        return ERR_INVALID_STATE;
+    }
+
+    _running = true;
+    _worker = a_util::concurrency::thread(&MappingShard::work, this);
+    _worker_id = _worker.get_id();
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingShard::stop()
+{
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        _running = false;
+    }
+    _not_empty.notify_all();
+    _not_full.notify_all();
+
+    // the worker maps all queued samples before it exits
+    if (_worker.joinable())
+    {
+        _worker.join();
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result MappingShard::push(Source* pSource, const void* pData, size_t szSize)
+{
+    std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+    if (_running && std::this_thread::get_id() == _worker_id)
+    {
+        // a sample sent back into the shard by the worker is mapped by the worker right away,
+        // waiting for space in its own queue would never end
+        return ERR_INVALID_STATE;
+    }
+
+    while (_running && _count == _samples.size())
+    {
+        _not_full.wait(oLock);
+    }
+
+    if (!_running)
+    {
+        // let the worker finish the queued samples before the caller maps this one
+        while ((_count > 0 || _busy) && std::this_thread::get_id() != _worker_id)
+        {
+            _drained.wait(oLock);
+        }
+        return ERR_INVALID_STATE;
+    }
+
+    Sample& oSample = _samples[(_head + _count) % _samples.size()];
+    oSample.source = pSource;
+    oSample.buffer.assign(static_cast<const uint8_t*>(pData),
+        static_cast<const uint8_t*>(pData) + szSize);
+    ++_count;
+
+    oLock.unlock();
+    _not_empty.notify_one();
+
+    return a_util::result::SUCCESS;
+}
+
+uint64_t MappingShard::getFailedCount() const
+{
+    return _failed.load();
+}
+
+void MappingShard::work()
+{
+    Sample oSample;
+    for (;;)
+    {
+        {
+            std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+            _busy = false;
+            while (_running && _count == 0)
+            {
+                _not_empty.wait(oLock);
+            }
+
+            if (_count == 0)
+            {
+                // stopped and drained
+                oLock.unlock();
+                _drained.notify_all();
+                return;
+            }
+
+            // take over the buffer and leave the previous one for reuse
+            Sample& oQueued = _samples[_head];
+            oSample.source = oQueued.source;
+            oSample.buffer.swap(oQueued.buffer);
+            _head = (_head + 1) % _samples.size();
+            --_count;
+            _busy = true;
+        }
+        _not_full.notify_one();
+
+        if (isFailed(oSample.source->processSample(
+            oSample.buffer.empty() ? NULL : &oSample.buffer[0], oSample.buffer.size())))
+        {
+            _failed.fetch_add(1);
+        }
+    }
+}
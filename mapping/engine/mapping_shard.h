@@ -0,0 +1,128 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef MAPPING_SHARD_HEADER
+#define MAPPING_SHARD_HEADER
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "a_util/result.h"
+#include "a_util/concurrency.h"
+
+namespace mapping
+{
+namespace rt
+{
+
+class Source;
+
+/// MappingShard maps the samples of a group of sources on its own worker thread.
+/// The sources of a shard share no targets with the sources of other shards,
+/// so shards map in parallel without contending for target locks.
+/// A shard object may be stopped and restarted, but must outlive all sources that
+/// still reference it, since a source callback may be about to push into it.
+class MappingShard
+{
+public:
+    /**
+    * CTOR
+    */
+    MappingShard();
+
+    /**
+    * DTOR
+    */
+    ~MappingShard();
+
+    /**
+    * Creation method to configure the shard
+    * @param [in] capacity The maximum amount of queued samples
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_ARG  Error capacity is zero
+    * @retval ERR_INVALID_STATE Error shard is running
+    */
+    a_util::result::Result create(size_t capacity);
+
+    /**
+    * Method to start the worker thread
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error shard is already running or not created
+    */
+    a_util::result::Result start();
+
+    /**
+    * Method to map all queued samples and stop the worker thread
+    * @retval a_util::result::SUCCESS      Everything went fine
+    */
+    a_util::result::Result stop();
+
+    /**
+    * Method to queue a copy of a sample, blocks while the queue is full.
+    * A stopping shard blocks until its worker mapped all queued samples, so a sample that
+    * is rejected may be mapped by the caller without overtaking any queued sample.
+    * @param [in] source The source that received the sample
+    * @param [in] data The sample
+    * @param [in] size The size of the sample
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_STATE Error shard is not running or the caller is the worker
+    *                           of the shard, the sample has not been queued
+    */
+    a_util::result::Result push(Source* source, const void* data, size_t size);
+
+    /**
+    * Getter for the amount of queued samples that failed to be mapped by the worker
+    * @return the amount of failed samples since the last create
+    */
+    uint64_t getFailedCount() const;
+
+private:
+    /// @cond nodoc
+    struct Sample
+    {
+        Source* source;
+        std::vector<uint8_t> buffer;
+    };
+
+    void work();
+
+    // ring buffer of preallocated samples, the buffers are swapped out and reused by the worker
+    std::vector<Sample> _samples;
+    size_t _head;
+    size_t _count;
+    bool _running;
+    // the worker is mapping a sample that has been taken out of the queue
+    bool _busy;
+    a_util::concurrency::thread _worker;
+    std::thread::id _worker_id;
+    std::atomic<uint64_t> _failed;
+    a_util::concurrency::mutex _mutex;
+    a_util::concurrency::condition_variable _not_empty;
+    a_util::concurrency::condition_variable _not_full;
+    a_util::concurrency::condition_variable _drained;
+
+    MappingShard(const MappingShard&); // = delete;
+    MappingShard& operator=(const MappingShard&); // = delete;
+    /// @endcond
+};
+
+} // namespace rt
+} // namespace mapping
+#endif //MAPPING_SHARD_HEADER
@@ -0,0 +1,289 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "periodic_scheduler.h"
+
+#include <algorithm>
+
+#include "a_util/result/error_def.h"
+
+#include "periodic_trigger.h"
+
+namespace mapping
+{
+namespace rt
+{
+    //define all needed error types and values locally
+    _MAKE_RESULT(-5, ERR_INVALID_ARG);
+    _MAKE_RESULT(-20, ERR_NOT_FOUND);
+}
+}
+
+using namespace mapping;
+using namespace mapping::rt;
+
+PeriodicScheduler::Group::Group(PeriodicScheduler& oScheduler, timestamp_t tmPeriod) :
+    scheduler(oScheduler), period(tmPeriod), ticks(0)
+{
+}
+
+void PeriodicScheduler::Group::onTimer(timestamp_t tmNow)
+{
+    scheduler.onTimer(*this, tmNow);
+}
+
+PeriodicScheduler::PeriodicScheduler(IMappingEnvironment& oEnv) : _env(oEnv)
+{
+}
+
+PeriodicScheduler::~PeriodicScheduler()
+{
+    for (Groups::iterator it = _groups.begin(); it != _groups.end(); ++it)
+    {
+        _env.unregisterPeriodicTimer((*it)->period, *it);
+        delete *it;
+    }
+}
+
+timestamp_t PeriodicScheduler::getPeriod(const PeriodicTrigger* pTrigger)
+{
+    return (timestamp_t)pTrigger->getPeriod() * 1000;
+}
+
+timestamp_t PeriodicScheduler::getCommonPeriod(const ScheduledTriggers& vecTriggers)
+{
+    timestamp_t tmCommon = 0;
+    for (ScheduledTriggers::const_iterator it = vecTriggers.begin(); it != vecTriggers.end(); ++it)
+    {
+        // greatest common divisor
+        timestamp_t tmPeriod = getPeriod(it->trigger);
+        while (tmPeriod != 0)
+        {
+            timestamp_t tmRest = tmCommon % tmPeriod;
+            tmCommon = tmPeriod;
+            tmPeriod = tmRest;
+        }
+    }
+    return tmCommon;
+}
+
+void PeriodicScheduler::takeOver(Group& oGroup, const ScheduledTriggers& vecTriggers)
+{
+    for (ScheduledTriggers::const_iterator it = vecTriggers.begin(); it != vecTriggers.end(); ++it)
+    {
+        ScheduledTrigger sTrigger = { it->trigger, (uint64_t)(getPeriod(it->trigger) / oGroup.period) };
+        oGroup.triggers.push_back(sTrigger);
+    }
+}
+
+a_util::result::Result PeriodicScheduler::add(PeriodicTrigger* pTrigger)
+{
+    timestamp_t tmPeriod = getPeriod(pTrigger);
+    if (tmPeriod <= 0)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        for (Groups::iterator it = _groups.begin(); it != _groups.end(); ++it)
+        {
+            for (ScheduledTriggers::iterator itTrigger = (*it)->triggers.begin();
+                itTrigger != (*it)->triggers.end(); ++itTrigger)
+            {
+                if (itTrigger->trigger == pTrigger)
+                {
+                    return ERR_INVALID_ARG;
+                }
+            }
+        }
+
+        // join the group with the largest period that the new period is a multiple of
+        Group* pGroup = NULL;
+        for (Groups::iterator it = _groups.begin(); it != _groups.end(); ++it)
+        {
+            if (tmPeriod % (*it)->period == 0 && (!pGroup || (*it)->period > pGroup->period))
+            {
+                pGroup = *it;
+            }
+        }
+
+        if (pGroup)
+        {
+            ScheduledTrigger sTrigger = { pTrigger, (uint64_t)(tmPeriod / pGroup->period) };
+            pGroup->triggers.push_back(sTrigger);
+            return a_util::result::SUCCESS;
+        }
+    }
+
+    // new base rate, the environment may wait for running callbacks, so timers are
+    // (un)registered unlocked and the current groups keep running until the new one is registered
+    Group* pGroup = new Group(*this, tmPeriod);
+    ScheduledTrigger sTrigger = { pTrigger, 1 };
+    pGroup->triggers.push_back(sTrigger);
+    a_util::result::Result nResult = _env.registerPeriodicTimer(tmPeriod, pGroup);
+    if (isFailed(nResult))
+    {
+        delete pGroup;
+        return nResult;
+    }
+
+    // take over all groups that are harmonic to the new one
+    Groups vecMerged;
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        for (Groups::iterator it = _groups.begin(); it != _groups.end();)
+        {
+            if ((*it)->period % tmPeriod == 0)
+            {
+                takeOver(*pGroup, (*it)->triggers);
+                vecMerged.push_back(*it);
+                it = _groups.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        _groups.push_back(pGroup);
+    }
+
+    retire(vecMerged);
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result PeriodicScheduler::remove(PeriodicTrigger* pTrigger)
+{
+    Groups vecRetired;
+    Group* pGroup = NULL;
+    Group* pSlowerGroup = NULL;
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        Groups::iterator itGroup = _groups.begin();
+        for (; itGroup != _groups.end(); ++itGroup)
+        {
+            ScheduledTriggers& vecTriggers = (*itGroup)->triggers;
+            ScheduledTriggers::iterator itTrigger = vecTriggers.begin();
+            while (itTrigger != vecTriggers.end() && itTrigger->trigger != pTrigger)
+            {
+                ++itTrigger;
+            }
+
+            if (itTrigger != vecTriggers.end())
+            {
+                vecTriggers.erase(itTrigger);
+                break;
+            }
+        }
+
+        if (itGroup == _groups.end())
+        {
+            return ERR_NOT_FOUND;
+        }
+
+        // the remaining triggers may allow a slower timer
+        pGroup = *itGroup;
+        timestamp_t tmPeriod = getCommonPeriod(pGroup->triggers);
+        if (tmPeriod == 0)
+        {
+            vecRetired.push_back(*itGroup);
+            _groups.erase(itGroup);
+        }
+        else if (tmPeriod != (*itGroup)->period)
+        {
+            pSlowerGroup = new Group(*this, tmPeriod);
+        }
+    }
+
+    if (pSlowerGroup)
+    {
+        // the current timer keeps running if the slower one can not be registered
+        if (isFailed(_env.registerPeriodicTimer(pSlowerGroup->period, pSlowerGroup)))
+        {
+            delete pSlowerGroup;
+            return a_util::result::SUCCESS;
+        }
+
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        Groups::iterator itGroup = std::find(_groups.begin(), _groups.end(), pGroup);
+        if (itGroup != _groups.end() && !pGroup->triggers.empty() &&
+            getCommonPeriod(pGroup->triggers) % pSlowerGroup->period == 0)
+        {
+            takeOver(*pSlowerGroup, pGroup->triggers);
+            vecRetired.push_back(pGroup);
+            *itGroup = pSlowerGroup;
+        }
+        else
+        {
+            // the group has been changed in the meantime
+            vecRetired.push_back(pSlowerGroup);
+        }
+    }
+
+    retire(vecRetired);
+
+    return a_util::result::SUCCESS;
+}
+
+void PeriodicScheduler::retire(const Groups& vecGroups)
+{
+    for (Groups::const_iterator it = vecGroups.begin(); it != vecGroups.end(); ++it)
+    {
+        _env.unregisterPeriodicTimer((*it)->period, *it);
+        delete *it;
+    }
+}
+
+size_t PeriodicScheduler::getTimerCount() const
+{
+    std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+    return _groups.size();
+}
+
+void PeriodicScheduler::onTimer(Group& oGroup, timestamp_t tmNow)
+{
+    std::vector<Target*> vecDueTargets;
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(_mutex);
+        ++oGroup.ticks;
+
+        for (ScheduledTriggers::iterator it = oGroup.triggers.begin();
+            it != oGroup.triggers.end(); ++it)
+        {
+            if (oGroup.ticks % it->divider == 0 && it->trigger->isRunning())
+            {
+                it->trigger->recordFire();
+                TargetSet& oTargets = it->trigger->getTargetList();
+                vecDueTargets.insert(vecDueTargets.end(), oTargets.begin(), oTargets.end());
+            }
+        }
+    }
+
+    // targets of several due triggers are sent once, unlocked, so a send may
+    // add or remove triggers
+    std::sort(vecDueTargets.begin(), vecDueTargets.end());
+    vecDueTargets.erase(std::unique(vecDueTargets.begin(), vecDueTargets.end()),
+        vecDueTargets.end());
+    for (std::vector<Target*>::iterator it = vecDueTargets.begin();
+        it != vecDueTargets.end(); ++it)
+    {
+        (*it)->send(tmNow);
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * @file
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef PERIODIC_SCHEDULER_HEADER
+#define PERIODIC_SCHEDULER_HEADER
+
+#include <vector>
+
+#include "a_util/result.h"
+#include "a_util/concurrency.h"
+
+#include "mapping_environment_intf.h"
+#include "target.h"
+
+namespace mapping
+{
+namespace rt
+{
+
+class PeriodicTrigger;
+
+/// PeriodicScheduler drives periodic triggers with harmonic periods from a single timer.
+/// Every group runs at the greatest common divisor of the periods of its triggers, which is
+/// the period of its fastest trigger unless that one has been removed. All triggers of the
+/// group fire on every n-th tick.
+/// All targets that are due in one tick are sent in one pass, each of them once.
+class PeriodicScheduler
+{
+public:
+    /**
+    * CTOR
+    * @param [in] env The mapping environment
+    */
+    PeriodicScheduler(IMappingEnvironment& env);
+
+    /**
+    * DTOR
+    */
+    ~PeriodicScheduler();
+
+    /**
+    * Method to schedule a periodic trigger. The trigger joins the group of an existing timer if
+    * its period is a multiple of the group period, otherwise a new timer is registered.
+    * Groups whose period is a multiple of the new period are merged into the new group once
+    * its timer has been registered. If the registration fails, all groups are kept as they are.
+    * @param [in] trigger The trigger, its period has to be at least 1ms
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_INVALID_ARG  Error the period is too small or the trigger is already scheduled
+    * @return The error of the environment if the timer could not be registered
+    */
+    a_util::result::Result add(PeriodicTrigger* trigger);
+
+    /**
+    * Method to unschedule a periodic trigger. The timer of its group is unregistered
+    * if it was the last trigger of the group, and replaced by a slower one if the remaining
+    * triggers allow it.
+    * @param [in] trigger The trigger
+    * @retval a_util::result::SUCCESS      Everything went fine
+    * @retval ERR_NOT_FOUND    Error the trigger is not scheduled
+    */
+    a_util::result::Result remove(PeriodicTrigger* trigger);
+
+    /**
+    * Getter for the amount of timers registered at the environment
+    * @return the amount of timers
+    */
+    size_t getTimerCount() const;
+
+private:
+    /// @cond nodoc
+    struct ScheduledTrigger
+    {
+        PeriodicTrigger* trigger;
+        // the trigger fires on every n-th tick of its group
+        uint64_t divider;
+    };
+    typedef std::vector<ScheduledTrigger> ScheduledTriggers;
+
+    class Group : public IPeriodicListener
+    {
+    public:
+        Group(PeriodicScheduler& scheduler, timestamp_t period);
+        void onTimer(timestamp_t now);
+
+        PeriodicScheduler& scheduler;
+        timestamp_t period;
+        uint64_t ticks;
+        ScheduledTriggers triggers;
+    };
+    typedef std::vector<Group*> Groups;
+
+    void onTimer(Group& group, timestamp_t now);
+    void retire(const Groups& groups);
+    static timestamp_t getPeriod(const PeriodicTrigger* trigger);
+    static timestamp_t getCommonPeriod(const ScheduledTriggers& triggers);
+    static void takeOver(Group& group, const ScheduledTriggers& triggers);
+
+    IMappingEnvironment& _env;
+    Groups _groups;
+    mutable a_util::concurrency::mutex _mutex;
+
+    PeriodicScheduler(const PeriodicScheduler&); // = delete;
+    PeriodicScheduler& operator=(const PeriodicScheduler&); // = delete;
+    /// @endcond
+};
+
+} // namespace rt
+} // namespace mapping
+#endif //PERIODIC_SCHEDULER_HEADER
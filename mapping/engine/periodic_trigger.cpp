@@ -18,22 +18,34 @@
 */
 
 #include "periodic_trigger.h"
+#include "periodic_scheduler.h"
 
 using namespace mapping::rt;
 
 PeriodicTrigger::PeriodicTrigger(IMappingEnvironment& oEnv,
-    const std::string& strTriggerName, double fPeriod) : _env(oEnv),
-    _name(strTriggerName), _period(fPeriod), _running(false)
+    const std::string& strTriggerName, double fPeriod, PeriodicScheduler* pScheduler) :
+    _env(oEnv), _scheduler(pScheduler), _name(strTriggerName), _period(fPeriod), _running(false)
 {
 }
 
 PeriodicTrigger::~PeriodicTrigger()
 {
-    _env.unregisterPeriodicTimer((timestamp_t)_period * 1000, this);
+    if (isScheduled())
+    {
+        _scheduler->remove(this);
+    }
+    else
+    {
+        _env.unregisterPeriodicTimer((timestamp_t)_period * 1000, this);
+    }
 }
 
 a_util::result::Result PeriodicTrigger::create()
 {
+    if (isScheduled())
+    {
+        return _scheduler->add(this);
+    }
     return _env.registerPeriodicTimer((timestamp_t)_period * 1000, this);
 }
 
@@ -49,21 +61,29 @@ a_util::result::Result PeriodicTrigger::stop()
     return a_util::result::SUCCESS;
 }
 
+double PeriodicTrigger::getPeriod() const
+{
+    return _period;
+}
+
+bool PeriodicTrigger::isRunning() const
+{
+    return _running;
+}
+
+bool PeriodicTrigger::isScheduled() const
+{
+    return _scheduler && (timestamp_t)_period * 1000 > 0;
+}
+
 void PeriodicTrigger::onTimer(timestamp_t tmNow)
 {
     if (_running)
     {
+        recordFire();
         for(TargetSet::iterator it = _targets.begin(); it != _targets.end(); ++it)
         {
-            const void* pBuffer = NULL;
-            size_t szBuffer = 0;
-            (*it)->aquireReadLock();
-            (*it)->updateTriggerFunctionValues();
-            if (isOk((*it)->getBufferRef(pBuffer, szBuffer)))
-            {
-                _env.sendTarget((handle_t)*it, pBuffer, szBuffer, tmNow);
-            }
-            (*it)->releaseReadLock();
+            (*it)->send(tmNow);
         }
     }
 }
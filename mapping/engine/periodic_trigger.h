@@ -29,6 +29,8 @@ namespace mapping
 namespace rt
 {
 
+class PeriodicScheduler;
+
 /// PeriodicTrigger implements a concrete periodic trigger in the runtime
 class PeriodicTrigger : public TriggerBase, private IPeriodicListener
 {
@@ -38,8 +40,11 @@ public:
     * @param [in] env The mapping environment
     * @param [in] trigger_name The name of the trigger
     * @param [in] period The period of the trigger
+    * @param [in] scheduler The scheduler that drives the trigger, NULL for an own timer.
+    *                       Triggers with a period of 0 always use an own timer.
     */
-    PeriodicTrigger(IMappingEnvironment& env, const std::string& trigger_name, double period);
+    PeriodicTrigger(IMappingEnvironment& env, const std::string& trigger_name, double period,
+        PeriodicScheduler* scheduler = NULL);
 
     /**
     * DTOR
@@ -66,12 +71,27 @@ public:
     */
     a_util::result::Result stop();
 
+    /**
+    * Getter for the period
+    * @return the period in ms
+    */
+    double getPeriod() const;
+
+    /**
+    * Getter for the running state
+    * @return true if the trigger is started
+    */
+    bool isRunning() const;
+
 private: // IPeriodicListener
     /// @cond nodoc
     void onTimer(timestamp_t now);
 
 private:
+    bool isScheduled() const;
+
     IMappingEnvironment& _env;
+    PeriodicScheduler* _scheduler;
     std::string _name;
     double _period;
     bool _running;
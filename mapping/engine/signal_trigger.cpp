@@ -48,17 +48,10 @@ a_util::result::Result SignalTrigger::transmit()
 {
     if(_is_running)
     {
+        recordFire();
         for(TargetSet::iterator it = _targets.begin(); it != _targets.end(); ++it)
         {
-            const void* pBuffer = NULL;
-            size_t szBuffer = 0;
-            (*it)->aquireReadLock();
-            (*it)->updateTriggerFunctionValues();
-            if (isOk((*it)->getBufferRef(pBuffer, szBuffer)))
-            {
-                _env.sendTarget((handle_t)*it, pBuffer, szBuffer, 0);
-            }
-            (*it)->releaseReadLock();
+            (*it)->send(0);
         }
     }
 
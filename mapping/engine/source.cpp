@@ -28,6 +28,7 @@
 
 #include "data_trigger.h"
 #include "signal_trigger.h"
+#include "mapping_shard.h"
 
 namespace mapping
 {
@@ -42,7 +43,9 @@ namespace rt
 using namespace mapping;
 using namespace mapping::rt;
 
-Source::Source(IMappingEnvironment& oEnv) : _env(oEnv), _handle(0)
+Source::Source(IMappingEnvironment& oEnv) : _env(oEnv), _handle(0), _shard(NULL),
+    _instrumentation(NULL),
+    _samples_received(0)
 {
     _type_map["tUInt8"] =   e_uint8;
     _type_map["tUInt16"] =  e_uint16;
@@ -136,6 +139,24 @@ a_util::result::Result Source::addTrigger(const oo::MapConfiguration& oMapConfig
             {
                 return ERR_INVALID_TYPE;
             }
+
+            // resolve the comparison once instead of on every sample
+            CompiledTrigger oCompiled = {};
+            oCompiled.data_trigger = pDataTrigger;
+            oCompiled.element_ptr_offset = oStruct.element_ptr_offset;
+            oCompiled.value = pDataTrigger->getValue();
+            RETURN_IF_FAILED(pDataTrigger->compileComparison(oStruct.type32, oCompiled.comparison));
+            _compiled_triggers.push_back(oCompiled);
+        }
+        else
+        {
+            SignalTrigger* pSignalTrigger = dynamic_cast<SignalTrigger*>(oTrigger);
+            if (pSignalTrigger)
+            {
+                CompiledTrigger oCompiled = {};
+                oCompiled.signal_trigger = pSignalTrigger;
+                _compiled_triggers.push_back(oCompiled);
+            }
         }
 
         _triggers.push_back(std::make_pair(oTrigger, oStruct));
@@ -159,7 +180,7 @@ a_util::result::Result Source::addAssignment(const oo::MapConfiguration& oMapCon
 {
     if(strSourceElement == "received()")
     {
-        _received_elements.push_back(pTargetElement);
+        getTargetAssignments(pTargetElement->getTarget()).received_elements.push_back(pTargetElement);
     }
     else
     {
@@ -251,30 +272,60 @@ a_util::result::Result Source::addAssignment(const oo::MapConfiguration& oMapCon
             // Get element pointer offset
             oStruct.element_ptr_offset = (uintptr_t)oDecoder.getElementAddress(nIdx);
         }
-    
-        Assignments::iterator itAssigns = _assignments.end();
-        for (itAssigns = _assignments.begin(); itAssigns != _assignments.end(); ++itAssigns)
-        {
-            if (itAssigns->first == oStruct)
-            {
-                break;
-            }
-        }
 
-        if (itAssigns == _assignments.end())
+        // resolve the conversion once instead of on every sample
+        CompiledAssignment oCompiled;
+        oCompiled.element_ptr_offset = oStruct.element_ptr_offset;
+        oCompiled.buffer_size = oStruct.buffer_size;
+        oCompiled.target_element = pTargetElement;
+        RETURN_IF_FAILED(pTargetElement->compileAssignment(oStruct.type32, oCompiled.kernel));
+
+        addToAssignments(_assignments, oStruct, pTargetElement);
+        // group the assignments by target, so only one target is locked at a time on samples
+        getTargetAssignments(pTargetElement->getTarget()).assignments.push_back(oCompiled);
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+Source::TargetAssignments& Source::getTargetAssignments(const Target* pTarget)
+{
+    for (TargetAssignmentList::iterator it = _target_assignments.begin();
+        it != _target_assignments.end(); ++it)
+    {
+        if (it->target == pTarget)
         {
-            _assignments.push_back(std::make_pair(oStruct, TargetElementList()));
-            _assignments.back().second.push_back(pTargetElement);
+            return *it;
         }
-        else
+    }
+
+    TargetAssignments oTargetAssignments;
+    oTargetAssignments.target = pTarget;
+    _target_assignments.push_back(oTargetAssignments);
+    return _target_assignments.back();
+}
+
+void Source::addToAssignments(Assignments& oAssignments, const AssignmentStruct& oStruct,
+    TargetElement* pTargetElement)
+{
+    Assignments::iterator itAssigns = oAssignments.end();
+    for (itAssigns = oAssignments.begin(); itAssigns != oAssignments.end(); ++itAssigns)
+    {
+        if (itAssigns->first == oStruct)
         {
-            itAssigns->second.push_back(pTargetElement);
+            break;
         }
     }
 
-    _targets.insert(pTargetElement->getTarget());
-
-    return a_util::result::SUCCESS;
+    if (itAssigns == oAssignments.end())
+    {
+        oAssignments.push_back(std::make_pair(oStruct, TargetElementList()));
+        oAssignments.back().second.push_back(pTargetElement);
+    }
+    else
+    {
+        itAssigns->second.push_back(pTargetElement);
+    }
 }
 
 a_util::result::Result Source::removeAssignmentsFor(const Target* pTarget)
@@ -307,7 +358,15 @@ a_util::result::Result Source::removeAssignmentsFor(const Target* pTarget)
         }
     }
 
-    _targets.erase(pTarget);
+    for (TargetAssignmentList::iterator it = _target_assignments.begin();
+        it != _target_assignments.end(); ++it)
+    {
+        if (it->target == pTarget)
+        {
+            _target_assignments.erase(it);
+            break;
+        }
+    }
 
     return a_util::result::SUCCESS;
 }
@@ -316,112 +375,115 @@ a_util::result::Result Source::onSampleReceived(const void* pData, size_t szSize
 {
     if (!pData) { return ERR_POINTER; }
 
-    // lock all currently mapped target buffers
-    // note: theres some optimization potential here:
-    //   -- rework the assignment container to be able to sort the assignments by target
-    //   -- lock only the current target during iteration over all assignments
-    // for now it is fast enough since the number of mapped targets isn't to high
-    for (TargetRefList::const_iterator it = _targets.begin();
-        it != _targets.end(); ++it)
+    // the shard copies the sample, it is mapped here if the shard is not running
+    MappingShard* pShard = _shard.load();
+    if (pShard && isOk(pShard->push(this, pData, szSize)))
     {
-        (*it)->aquireWriteLock();
+        return a_util::result::SUCCESS;
     }
 
-    // write true into all received(<this_signal>) assignments
-    bool bValue = true;
-    for(TargetElementList::iterator it = _received_elements.begin(); it != _received_elements.end(); it++)
-    {
-        (*it)->setValue(&bValue, e_bool, sizeof(bValue));
-    }
+    return processSample(pData, szSize);
+}
 
-    // write all assignments that stem from this source
-    for (Assignments::iterator itAssign = _assignments.begin();
-        itAssign != _assignments.end(); ++itAssign)
+a_util::result::Result Source::processSample(const void* pData, size_t szSize)
+{
+    if (!pData) { return ERR_POINTER; }
+
+    const bool bInstrumented = _instrumentation && _instrumentation->isEnabled();
+    const uint64_t nReceived = bInstrumented ? Instrumentation::now() : 0;
+
+    // write all assignments that stem from this source, target by target
+    // note: only the target that is currently written is locked, so triggers of other
+    // targets are not blocked while this sample is distributed
+    bool bValue = true;
+    for (TargetAssignmentList::const_iterator itTarget = _target_assignments.begin();
+        itTarget != _target_assignments.end(); ++itTarget)
     {
-        void* pValue = (void*)((uintptr_t)pData + itAssign->first.element_ptr_offset);
+        itTarget->target->aquireWriteLock();
 
-        const std::vector<TargetElement*>& vecElements = itAssign->second;
-        uint32_t type32 = itAssign->first.type32;
-        size_t buffer_size = itAssign->first.buffer_size;
+        // write true into all received(<this_signal>) assignments
+        const TargetElementList& vecReceived = itTarget->received_elements;
+        for (size_t idx = 0; idx < vecReceived.size(); ++idx)
+        {
+            vecReceived[idx]->setValue(&bValue, e_bool, sizeof(bValue));
+        }
 
-        for (size_t idx = 0; idx < vecElements.size(); ++idx)
+        for (CompiledAssignments::const_iterator itAssign = itTarget->assignments.begin();
+            itAssign != itTarget->assignments.end(); ++itAssign)
         {
-            vecElements[idx]->setValue(pValue, type32, buffer_size);
+            const void* pValue = (const void*)((uintptr_t)pData + itAssign->element_ptr_offset);
+            itAssign->target_element->assign(pValue, itAssign->kernel, itAssign->buffer_size);
         }
-    }
 
-    // unlock all currently mapped target buffers
-    for (TargetRefList::const_iterator it = _targets.begin();
-        it != _targets.end(); ++it)
-    {
-        (*it)->releaseWriteLock();
+        itTarget->target->releaseWriteLock();
+
+        if (bInstrumented)
+        {
+            itTarget->target->markUpdated(nReceived);
+        }
     }
 
-    // call signal triggers
-    for(Triggers::iterator it = _triggers.begin();
-        it != _triggers.end(); it++)
+    // call the signal triggers and the data triggers whose comparison holds for the
+    // received value in the order they were added
+    for (CompiledTriggers::const_iterator it = _compiled_triggers.begin();
+        it != _compiled_triggers.end(); ++it)
     {
-        SignalTrigger* pSigTrigger = dynamic_cast<SignalTrigger*>(it->first);
-        DataTrigger* pDataTrigger = dynamic_cast<DataTrigger*>(it->first);
-        if(pSigTrigger)
+        if (it->signal_trigger)
         {
-            pSigTrigger->transmit();
+            it->signal_trigger->transmit();
+            continue;
         }
-        else if(pDataTrigger)
-        {
-            // read the current value and cast it into a float64
-            double f64Val = 0;
-            void* pValue = (void*)((uintptr_t)pData + it->second.element_ptr_offset);
-            switch (it->second.type32)
-            {
-            case e_uint8:
-                f64Val = *(static_cast<uint8_t*>(pValue));
-                break;
-            case e_uint16:
-                f64Val = *(static_cast<uint16_t*>(pValue));
-                break;
-            case e_uint32:
-                f64Val = *(static_cast<uint32_t*>(pValue));
-                break;
-            case e_uint64:
-                f64Val = static_cast<double>(*(static_cast<uint64_t*>(pValue)));
-                break;
-            case e_int8:
-                f64Val = *(static_cast<int8_t*>(pValue));
-                break;
-            case e_int16:
-                f64Val = *(static_cast<int16_t*>(pValue));
-                break;
-            case e_int32:
-                f64Val = *(static_cast<int32_t*>(pValue));
-                break;
-            case e_int64:
-                f64Val = static_cast<double>(*(static_cast<int64_t*>(pValue)));
-                break;
-            case e_float32:
-                f64Val = *(static_cast<float*>(pValue));
-                break;
-            case e_float64:
-                f64Val = *(static_cast<double*>(pValue));
-                break;
-            case e_bool:
-                f64Val = *(static_cast<bool*>(pValue));
-                break;
-            case e_char:
-                f64Val = *(static_cast<char*>(pValue));
-                break;
-            default:
-                assert(false);
-                break;
-            }
 
-            // compare/interpret the operator comparison
-            if(pDataTrigger->compare(f64Val))
-            {
-                pDataTrigger->transmit();
-            }
+        const void* pValue = (const void*)((uintptr_t)pData + it->element_ptr_offset);
+        if (it->comparison(pValue, it->value))
+        {
+            it->data_trigger->transmit();
         }
     }
 
+    if (bInstrumented)
+    {
+        _samples_received.fetch_add(1, std::memory_order_relaxed);
+        _receive_time.record(Instrumentation::now() - nReceived);
+    }
+
     return a_util::result::SUCCESS;
 }
+
+void Source::setShard(MappingShard* pShard)
+{
+    _shard = pShard;
+}
+
+void Source::getConnectedTargets(std::vector<const Target*>& vecTargets) const
+{
+    for (TargetAssignmentList::const_iterator it = _target_assignments.begin();
+        it != _target_assignments.end(); ++it)
+    {
+        vecTargets.push_back(it->target);
+    }
+
+    for (Triggers::const_iterator it = _triggers.begin(); it != _triggers.end(); ++it)
+    {
+        const TargetSet& oTargets = it->first->getTargetList();
+        vecTargets.insert(vecTargets.end(), oTargets.begin(), oTargets.end());
+    }
+}
+
+void Source::setInstrumentation(const Instrumentation* pInstrumentation)
+{
+    _instrumentation = pInstrumentation;
+}
+
+void Source::getStatistics(SourceStatistics& oStatistics) const
+{
+    oStatistics.name = _name;
+    oStatistics.samples_received = _samples_received.load(std::memory_order_relaxed);
+    _receive_time.getStatistics(oStatistics.receive_time);
+}
+
+void Source::resetStatistics()
+{
+    _samples_received.store(0, std::memory_order_relaxed);
+    _receive_time.reset();
+}
@@ -22,6 +22,8 @@
 #ifndef MAPPING_SOURCE_HEADER
 #define MAPPING_SOURCE_HEADER
 
+#include <atomic>
+
 #include "a_util/result.h"
 
 #include "mapping/configuration/map_source.h"
@@ -29,6 +31,7 @@
 
 #include "mapping_environment_intf.h"
 #include "element.h"
+#include "instrumentation.h"
 
 
 namespace mapping
@@ -62,9 +65,20 @@ namespace rt
 {
 
 class TriggerBase;
+class MappingShard;
+class SignalTrigger;
+class DataTrigger;
 class Target;
 class TargetElement;
 
+/**
+* Precompiled comparison of a source value with the value of a data trigger
+* @param [in] data The pointer referencing the source value
+* @param [in] value The value of the data trigger
+* @return the result of the comparison
+*/
+typedef bool (*DataComparison)(const void* data, double value);
+
 class Source : public ISignalListener
 {
 public: // types
@@ -79,6 +93,37 @@ public: // types
     typedef std::vector<uint8_t> MemoryBuffer;
     typedef std::set<const Target*> TargetRefList;
 
+    // A source element assigned to a target element with its precompiled conversion
+    struct CompiledAssignment
+    {
+        uintptr_t element_ptr_offset;
+        size_t buffer_size;
+        TargetElement* target_element;
+        AssignmentKernel kernel;
+    };
+    typedef std::vector<CompiledAssignment> CompiledAssignments;
+
+    // All assignments of this source to the elements of a single target
+    struct TargetAssignments
+    {
+        const Target* target;
+        TargetElementList received_elements;
+        CompiledAssignments assignments;
+    };
+    typedef std::vector<TargetAssignments> TargetAssignmentList;
+
+    // A signal trigger or a data trigger with its precompiled comparison
+    struct CompiledTrigger
+    {
+        SignalTrigger* signal_trigger;
+        DataTrigger* data_trigger;
+        uintptr_t element_ptr_offset;
+        DataComparison comparison;
+        double value;
+    };
+    // kept in the order the triggers were added, which is the order they fire in
+    typedef std::vector<CompiledTrigger> CompiledTriggers;
+
 #if defined(__GNUC__) && (__GNUC__ == 5) && defined(__QNX__)
 #pragma GCC diagnostic warning "-Wattributes" // standard type attributes are ignored when used in templates
 #endif
@@ -149,6 +194,61 @@ public:
     */
     a_util::result::Result onSampleReceived(const void* data, size_t size);
 
+    /**
+    * Method to map a sample into the targets and call the triggers of this source.
+    * This is done by onSampleReceived, or by the worker of the shard of the source.
+    * @param[in] data The memory location of the sample
+    * @param[in] size The memory size of the sample
+    * @retval a_util::result::SUCCESS      Everything went fine
+    */
+    a_util::result::Result processSample(const void* data, size_t size);
+
+    /**
+    * Setter for the shard that maps the samples of this source
+    * @param[in] shard The shard, NULL to map the samples in onSampleReceived
+    */
+    void setShard(MappingShard* shard);
+
+    /**
+    * Method to collect all targets that are assigned or triggered by this source
+    * @param[out] targets The targets, existing entries are kept
+    */
+    void getConnectedTargets(std::vector<const Target*>& targets) const;
+
+    /**
+    * Setter for the instrumentation switch of the engine
+    * @param[in] instrumentation The instrumentation, NULL to disable the statistics
+    */
+    void setInstrumentation(const Instrumentation* instrumentation);
+
+    /**
+    * Getter for the statistics collected while the instrumentation was enabled
+    * @param[out] statistics The destination of the statistics
+    */
+    void getStatistics(SourceStatistics& statistics) const;
+
+    /**
+    * Method to clear the statistics
+    */
+    void resetStatistics();
+
+private:
+    /**
+    * Method to find or create the assignment group of a target
+    * @param[in] target The target
+    * @return the assignment group of the target
+    */
+    TargetAssignments& getTargetAssignments(const Target* target);
+
+    /**
+    * Method to add a target element to the assignment of a source element
+    * @param[in] assignments The assignment list
+    * @param[in] assignment The source element
+    * @param[in] target_element The target element
+    */
+    static void addToAssignments(Assignments& assignments, const AssignmentStruct& assignment,
+        TargetElement* target_element);
+
 private:
     IMappingEnvironment& _env;
     handle_t _handle;
@@ -156,11 +256,15 @@ private:
     std::string _type;
     std::string _type_description;
     Assignments _assignments;
-    TargetRefList _targets;
+    TargetAssignmentList _target_assignments;
     a_util::memory::unique_ptr<ddl::CodecFactory> _codec_factory;
     TypeMap _type_map;
-    TargetElementList _received_elements;
     Triggers _triggers;
+    CompiledTriggers _compiled_triggers;
+    std::atomic<MappingShard*> _shard;
+    const Instrumentation* _instrumentation;
+    std::atomic<uint64_t> _samples_received;
+    LatencyHistogram _receive_time;
 
     Source(const Source&); // = delete;
     Source& operator=(const Source&); // = delete;
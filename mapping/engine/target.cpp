@@ -20,6 +20,7 @@
 #include "target.h"
 
 #include <memory>   //std::unique_ptr<>
+#include <thread>
 #include "a_util/result/error_def.h"
 #include "legacy_error_macros.h"
 
@@ -42,7 +43,9 @@ using namespace mapping;
 using namespace mapping::rt;
 
 Target::Target(IMappingEnvironment& oEnv) :
-    _counter(0), _env(oEnv)
+    _counter(0), _env(oEnv), _publication_mode(e_publish_locked), _emission_queue(NULL),
+    _writes_started(0), _writes_finished(0), _instrumentation(NULL), _emissions(0),
+    _pending_since(0)
 {
 }
 
@@ -68,6 +71,7 @@ a_util::result::Result Target::create(const oo::MapConfiguration& oMapConfig,
     
     // Alloc and zero memory
     _buffer.resize(oFactory.getStaticBufferSize(), 0);
+    _snapshot.resize(_buffer.size(), 0);
 
     // Begin here, end when target is destroyed or after reset
     _codec.reset(new ddl::StaticCodec(oFactory.makeStaticCodecFor(&_buffer[0], _buffer.size())));
@@ -189,6 +193,35 @@ a_util::result::Result Target::reset(const oo::MapConfiguration& oMapConfig)
     // Reset Counter
     _counter = 0;
 
+    if (_default_image.empty())
+    {
+        nResult = applyDefaultValues(oMapConfig);
+        if (isOk(nResult))
+        {
+            // the DDL defaults do not change, so later resets only copy them
+            _default_image = _buffer;
+        }
+    }
+    else
+    {
+        a_util::memory::copy(&_buffer[0], _buffer.size(), &_default_image[0], _default_image.size());
+    }
+
+    // Set constant elements
+    if (isOk(nResult))
+    {
+        for(Constants::iterator it = _constant_elements.begin(); it != _constant_elements.end(); it++)
+        {
+            nResult = it->second->setDefaultValue(it->first);
+        }
+    }
+    return nResult;
+}
+
+a_util::result::Result Target::applyDefaultValues(const oo::MapConfiguration& oMapConfig)
+{
+    a_util::result::Result nResult = a_util::result::SUCCESS;
+
     // Set default values from DDL
     const ddl::DDLDescription* pDescription = oMapConfig.getDescription();
     if (!pDescription) { return ERR_POINTER; }
@@ -288,14 +321,6 @@ a_util::result::Result Target::reset(const oo::MapConfiguration& oMapConfig)
         }
     }
 
-    // Set constant elements
-    if (isOk(nResult))
-    {
-        for(Constants::iterator it = _constant_elements.begin(); it != _constant_elements.end(); it++)
-        {
-            nResult = it->second->setDefaultValue(it->first);
-        }
-    }
     return nResult;
 }
 
@@ -358,9 +383,22 @@ a_util::result::Result Target::getCurrentBuffer(void* pTargetBuffer, size_t szTa
         return ERR_MEMORY;
     }
 
-    updateAccessFunctionValues();
+    if (_publication_mode == e_publish_snapshot)
+    {
+        {
+            // the shared lock does not serialize the function values with send
+            std::lock_guard<a_util::concurrency::mutex> oLock(_snapshot_mutex);
+            aquireWriteLock();
+            updateAccessFunctionValues();
+            releaseWriteLock();
+        }
+
+        readSnapshot(pTargetBuffer);
+        return a_util::result::SUCCESS;
+    }
 
     aquireReadLock();
+    updateAccessFunctionValues();
     a_util::memory::copy(pTargetBuffer, szTargetBuffer, &_buffer[0], _buffer.size());
     releaseReadLock();
     return a_util::result::SUCCESS;
@@ -377,3 +415,122 @@ a_util::result::Result Target::getBufferRef(const void*& pBuffer, size_t& szTarg
     return a_util::result::SUCCESS;
 }
 
+a_util::result::Result Target::send(timestamp_t tmTimeStamp)
+{
+    if (_publication_mode == e_publish_snapshot)
+    {
+        // the snapshot mutex serializes the triggers of this target, sources are not affected
+        std::lock_guard<a_util::concurrency::mutex> oLock(_snapshot_mutex);
+        aquireWriteLock();
+        updateTriggerFunctionValues();
+        updateAccessFunctionValues();
+        releaseWriteLock();
+
+        readSnapshot(&_snapshot[0]);
+        return emit(&_snapshot[0], _snapshot.size(), tmTimeStamp);
+    }
+
+    // both modes update the function values right before the buffer is published
+    aquireReadLock();
+    updateTriggerFunctionValues();
+    updateAccessFunctionValues();
+    a_util::result::Result nResult = emit(&_buffer[0], _buffer.size(), tmTimeStamp);
+    releaseReadLock();
+
+    return nResult;
+}
+
+void Target::setPublicationMode(PublicationMode eMode)
+{
+    _publication_mode = eMode;
+}
+
+PublicationMode Target::getPublicationMode() const
+{
+    return _publication_mode;
+}
+
+void Target::setEmissionQueue(EmissionQueue* pQueue)
+{
+    _emission_queue = pQueue;
+}
+
+void Target::setInstrumentation(const Instrumentation* pInstrumentation)
+{
+    _instrumentation = pInstrumentation;
+}
+
+void Target::getStatistics(TargetStatistics& oStatistics) const
+{
+    oStatistics.name = _name;
+    oStatistics.emissions = _emissions.load(std::memory_order_relaxed);
+    _lock_wait.getStatistics(oStatistics.lock_wait);
+    _send_time.getStatistics(oStatistics.send_time);
+    _source_to_emit.getStatistics(oStatistics.source_to_emit);
+}
+
+void Target::resetStatistics()
+{
+    _emissions.store(0, std::memory_order_relaxed);
+    _pending_since.store(0, std::memory_order_relaxed);
+    _lock_wait.reset();
+    _send_time.reset();
+    _source_to_emit.reset();
+}
+
+a_util::result::Result Target::emit(const void* pBuffer, size_t szBuffer, timestamp_t tmTimeStamp)
+{
+    if (!isInstrumented())
+    {
+        if (_emission_queue)
+        {
+            // the queue copies the buffer, so it can be released right away
+            return _emission_queue->push((handle_t)this, pBuffer, szBuffer, tmTimeStamp);
+        }
+
+        return _env.sendTarget((handle_t)this, pBuffer, szBuffer, tmTimeStamp);
+    }
+
+    uint64_t nStart = Instrumentation::now();
+    a_util::result::Result nResult = _emission_queue ?
+        _emission_queue->push((handle_t)this, pBuffer, szBuffer, tmTimeStamp) :
+        _env.sendTarget((handle_t)this, pBuffer, szBuffer, tmTimeStamp);
+    uint64_t nEnd = Instrumentation::now();
+
+    _emissions.fetch_add(1, std::memory_order_relaxed);
+    _send_time.record(nEnd - nStart);
+    uint64_t nPendingSince = _pending_since.exchange(0, std::memory_order_relaxed);
+    if (nPendingSince != 0)
+    {
+        _source_to_emit.record(nEnd - nPendingSince);
+    }
+
+    return nResult;
+}
+
+void Target::readSnapshot(void* pTargetBuffer) const
+{
+    // optimistic copy that is retried if a source updated the buffer in the meantime
+    for (int nTry = 0; nTry < 16; ++nTry)
+    {
+        uint64_t nFinished = _writes_finished.load(std::memory_order_acquire);
+        uint64_t nStarted = _writes_started.load(std::memory_order_acquire);
+        if (nStarted != nFinished)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+
+        a_util::memory::copy(pTargetBuffer, _buffer.size(), &_buffer[0], _buffer.size());
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (_writes_started.load(std::memory_order_relaxed) == nStarted)
+        {
+            return;
+        }
+    }
+
+    // the sources are updating the buffer continuously, so block them for a single copy
+    aquireReadLock();
+    a_util::memory::copy(pTargetBuffer, _buffer.size(), &_buffer[0], _buffer.size());
+    releaseReadLock();
+}
@@ -23,13 +23,17 @@
 #ifndef TARGET_HEADER
 #define TARGET_HEADER
 
+#include <atomic>
 #include <vector>
 #include "a_util/result.h"
+#include "a_util/concurrency.h"
 
 #include "codec/static_codec.h"
 
 #include "element.h"
 #include "source.h"
+#include "emission_queue.h"
+#include "instrumentation.h"
 #include "mapping_environment_intf.h"
 #include "mapping/configuration/map_target.h"
 #include "mapping/configuration/map_source.h"
@@ -39,6 +43,15 @@ namespace mapping
 namespace rt
 {
 
+/// Publication modes of the target buffers
+enum PublicationMode
+{
+    // triggers lock the target buffer while it is sent
+    e_publish_locked = 1,
+    // triggers send a snapshot of the target buffer, so sources are never blocked by sending
+    e_publish_snapshot
+};
+
 /// Target represents a mapped target signal in the runtime api
 class Target
 {
@@ -84,7 +97,8 @@ public:
         const std::string& target_description, SourceMap& sources);
 
     /**
-    * Reset target Buffers
+    * Reset target Buffers. The default values of the DDL are evaluated by the first reset
+    * only, later resets copy them and set the constants again.
     * @param[in] map_config - The Configuration instance
     * @return error code
     */
@@ -135,6 +149,50 @@ public:
     */
     a_util::result::Result getBufferRef(const void*& buffer, size_t& target_buffer_size);
 
+    /**
+    * Method to update the trigger dependent values and send the target buffer
+    * to the environment
+    *
+    * @param [in] time_stamp The time stamp for the environment
+    * @retval a_util::result::SUCCESS Everything went fine
+    */
+    a_util::result::Result send(timestamp_t time_stamp);
+
+    /**
+    * Setter for the publication mode
+    * @param [in] mode The publication mode
+    */
+    void setPublicationMode(PublicationMode mode);
+
+    /**
+    * Getter for the publication mode
+    * @return the publication mode
+    */
+    PublicationMode getPublicationMode() const;
+
+    /**
+    * Setter for the queue that sends the target buffer asynchronously
+    * @param [in] queue The emission queue, NULL to send synchronously
+    */
+    void setEmissionQueue(EmissionQueue* queue);
+
+    /**
+    * Setter for the instrumentation switch of the engine
+    * @param [in] instrumentation The instrumentation, NULL to disable the statistics
+    */
+    void setInstrumentation(const Instrumentation* instrumentation);
+
+    /**
+    * Getter for the statistics collected while the instrumentation was enabled
+    * @param [out] statistics The destination of the statistics
+    */
+    void getStatistics(TargetStatistics& statistics) const;
+
+    /**
+    * Method to clear the statistics
+    */
+    void resetStatistics();
+
     /**
     * Method to update all dynamic values that are to be updates during buffer access
     * (i.e. simulation time)
@@ -160,19 +218,100 @@ private:
     MemoryBuffer _buffer;
     mutable a_util::concurrency::shared_mutex _buffer_mutex;
     IMappingEnvironment& _env;
+    PublicationMode _publication_mode;
+    EmissionQueue* _emission_queue;
+    // sequence counters of the buffer updates, equal if no update is in progress
+    mutable std::atomic<uint64_t> _writes_started;
+    mutable std::atomic<uint64_t> _writes_finished;
+    // snapshot that is sent in e_publish_snapshot mode, guarded by _snapshot_mutex together
+    // with the function values
+    MemoryBuffer _snapshot;
+    a_util::concurrency::mutex _snapshot_mutex;
+    // buffer with the default values of the DDL, created by the first reset
+    MemoryBuffer _default_image;
+    // statistics, only collected if the instrumentation is enabled
+    const Instrumentation* _instrumentation;
+    mutable LatencyHistogram _lock_wait;
+    LatencyHistogram _send_time;
+    LatencyHistogram _source_to_emit;
+    std::atomic<uint64_t> _emissions;
+    // receive time of the oldest source sample that has not been sent yet, 0 if none
+    mutable std::atomic<uint64_t> _pending_since;
+
+    /**
+    * Method to write the default values of the DDL into the target buffer
+    *
+    * @param [in] map_config The Configuration instance
+    * @retval a_util::result::SUCCESS Everything went fine
+    */
+    a_util::result::Result applyDefaultValues(const oo::MapConfiguration& map_config);
+
+    /**
+    * Method to copy a consistent state of the target buffer without blocking the sources
+    *
+    * @param [out] target_buffer The destination buffer of at least getSize() bytes
+    */
+    void readSnapshot(void* target_buffer) const;
+
+    /**
+    * Method to hand a target buffer to the emission queue or the environment
+    */
+    a_util::result::Result emit(const void* buffer, size_t buffer_size, timestamp_t time_stamp);
     /// @nodoc
 public:
+    /// Check whether statistics are collected
+    inline bool isInstrumented() const
+    {
+        return _instrumentation && _instrumentation->isEnabled();
+    }
+
     /// Lock the buffer for a source update
-    inline void aquireWriteLock() const { _buffer_mutex.lock_shared(); }
+    inline void aquireWriteLock() const
+    {
+        if (isInstrumented())
+        {
+            uint64_t nStart = Instrumentation::now();
+            _buffer_mutex.lock_shared();
+            _lock_wait.record(Instrumentation::now() - nStart);
+        }
+        else
+        {
+            _buffer_mutex.lock_shared();
+        }
+        _writes_started.fetch_add(1);
+    }
 
     /// Unlock the buffer after a source update
-    inline void releaseWriteLock() const { _buffer_mutex.unlock_shared(); }
+    inline void releaseWriteLock() const
+    {
+        _writes_finished.fetch_add(1);
+        _buffer_mutex.unlock_shared();
+    }
 
     /// Lock the buffer for a buffer read
-    inline void aquireReadLock() const { _buffer_mutex.lock(); }
+    inline void aquireReadLock() const
+    {
+        if (isInstrumented())
+        {
+            uint64_t nStart = Instrumentation::now();
+            _buffer_mutex.lock();
+            _lock_wait.record(Instrumentation::now() - nStart);
+        }
+        else
+        {
+            _buffer_mutex.lock();
+        }
+    }
 
     /// Unlock the buffer after a buffer read
     inline void releaseReadLock() const { _buffer_mutex.unlock(); }
+
+    /// Remember the receive time of a source sample that updated the buffer
+    inline void markUpdated(uint64_t received) const
+    {
+        uint64_t nNone = 0;
+        _pending_since.compare_exchange_strong(nNone, received, std::memory_order_relaxed);
+    }
 };
 
 /// Public composite types used in the mapping::rt namespace
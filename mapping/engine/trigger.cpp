@@ -21,6 +21,8 @@
 
 using namespace mapping::rt;
 
+TriggerBase::TriggerBase() : _instrumentation(NULL), _fire_count(0) {}
+
 TriggerBase::~TriggerBase() {}
 
 TargetSet& TriggerBase::getTargetList()
@@ -39,3 +41,18 @@ a_util::result::Result TriggerBase::removeTarget(Target* target)
     _targets.erase(target);
     return a_util::result::SUCCESS;
 }
+
+void TriggerBase::setInstrumentation(const Instrumentation* pInstrumentation)
+{
+    _instrumentation = pInstrumentation;
+}
+
+uint64_t TriggerBase::getFireCount() const
+{
+    return _fire_count.load(std::memory_order_relaxed);
+}
+
+void TriggerBase::resetStatistics()
+{
+    _fire_count.store(0, std::memory_order_relaxed);
+}
@@ -20,9 +20,12 @@
 #ifndef TRIGGER_BASE_HEADER
 #define TRIGGER_BASE_HEADER
 
+#include <atomic>
+
 #include "a_util/result.h"
 
 #include "target.h"
+#include "instrumentation.h"
 
 namespace mapping
 {
@@ -33,6 +36,11 @@ namespace rt
 class TriggerBase
 {
 public:
+    /**
+    * CTOR
+    */
+    TriggerBase();
+
     /**
     * Virtual DTOR
     */
@@ -74,9 +82,43 @@ public: // Base implementations
     */
     a_util::result::Result removeTarget(Target* target);
 
+    /**
+    * Setter for the instrumentation switch of the engine
+    * @param[in] instrumentation The instrumentation, NULL to disable the statistics
+    */
+    void setInstrumentation(const Instrumentation* instrumentation);
+
+    /**
+    * Getter for the amount of times the trigger fired while the instrumentation was enabled
+    * @return the fire count
+    */
+    uint64_t getFireCount() const;
+
+    /**
+    * Method to clear the statistics
+    */
+    void resetStatistics();
+
+    /**
+    * Method to count a firing of the trigger
+    */
+    inline void recordFire()
+    {
+        if (_instrumentation && _instrumentation->isEnabled())
+        {
+            _fire_count.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
 protected:
     /// nodoc
     TargetSet _targets;
+
+private:
+    /// @cond nodoc
+    const Instrumentation* _instrumentation;
+    std::atomic<uint64_t> _fire_count;
+    /// @endcond
 };
 
 typedef std::map<std::string, TriggerBase*> TriggerMap;
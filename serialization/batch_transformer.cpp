@@ -0,0 +1,251 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+
+#include "batch_transformer.h"
+
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
+#include "transform_plan.h"
+
+namespace ddl
+{
+
+namespace serialization
+{
+//define all needed error types and values locally
+_MAKE_RESULT(-4, ERR_POINTER);
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+
+/// the amount of samples a worker takes at once
+static const size_t nSamplesPerChunk = 16;
+
+BatchTransformer::BatchTransformer(size_t nThreadCount):
+    _job(NULL),
+    _generation(0),
+    _busy_threads(0),
+    _stop(false),
+    _result_sample(0)
+{
+    if (nThreadCount == 0)
+    {
+        nThreadCount = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+
+    _threads.reserve(nThreadCount);
+    for (size_t nThread = 0; nThread < nThreadCount; ++nThread)
+    {
+        _threads.push_back(a_util::concurrency::thread(&BatchTransformer::run, this));
+    }
+}
+
+BatchTransformer::~BatchTransformer()
+{
+    {
+        std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+        _stop = true;
+    }
+    _job_available.notify_all();
+
+    for (std::vector<a_util::concurrency::thread>::iterator itThread = _threads.begin();
+         itThread != _threads.end(); ++itThread)
+    {
+        itThread->join();
+    }
+}
+
+size_t BatchTransformer::getThreadCount() const
+{
+    return _threads.size();
+}
+
+a_util::result::Result BatchTransformer::transform(const CodecFactory& oFactory,
+                                                   DataRepresentation eSourceRep,
+                                                   const void* const* pSources,
+                                                   const size_t* pSourceSizes,
+                                                   void* const* pDestinations,
+                                                   const size_t* pDestinationSizes,
+                                                   size_t nCount,
+                                                   bool bZero)
+{
+    if (nCount == 0)
+    {
+        return a_util::result::SUCCESS;
+    }
+
+    if (!pSources || !pSourceSizes || !pDestinations || !pDestinationSizes)
+    {
+        return ERR_POINTER;
+    }
+
+    RETURN_IF_FAILED(oFactory.isValid());
+
+    std::lock_guard<a_util::concurrency::mutex> oTransformGuard(_transform_mutex);
+
+    Job sJob;
+    sJob.factory = &oFactory;
+    sJob.source_rep = eSourceRep;
+    sJob.sources = pSources;
+    sJob.source_sizes = pSourceSizes;
+    sJob.destinations = pDestinations;
+    sJob.destination_sizes = pDestinationSizes;
+    sJob.count = nCount;
+    sJob.zero = bZero;
+    sJob.next_sample = 0;
+    sJob.failed_sample = nCount;
+
+    std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+    _job = &sJob;
+    _result = a_util::result::SUCCESS;
+    _result_sample = nCount;
+    _busy_threads = _threads.size();
+    ++_generation;
+    _job_available.notify_all();
+
+    while (_busy_threads > 0)
+    {
+        _job_done.wait(oLock);
+    }
+    _job = NULL;
+
+    return _result;
+}
+
+void BatchTransformer::run()
+{
+    uint64_t nGeneration = 0;
+    while (true)
+    {
+        Job* pJob = NULL;
+        {
+            std::unique_lock<a_util::concurrency::mutex> oLock(_mutex);
+            while (!_stop && _generation == nGeneration)
+            {
+                _job_available.wait(oLock);
+            }
+
+            if (_stop)
+            {
+                return;
+            }
+
+            nGeneration = _generation;
+            pJob = _job;
+        }
+
+        size_t nFailedSample = 0;
+        a_util::result::Result oResult = process(*pJob, nFailedSample);
+
+        std::lock_guard<a_util::concurrency::mutex> oGuard(_mutex);
+        if (isFailed(oResult) && nFailedSample < _result_sample)
+        {
+            // the result does not depend on the order in which the workers finish
+            _result = oResult;
+            _result_sample = nFailedSample;
+        }
+        if (--_busy_threads == 0)
+        {
+            _job_done.notify_all();
+        }
+    }
+}
+
+a_util::result::Result BatchTransformer::process(Job& sJob, size_t& nFailedSample)
+{
+    DataRepresentation eTargetRep = sJob.source_rep == deserialized ? serialized : deserialized;
+
+    // the state of this worker, reused for all samples it processes
+    a_util::memory::unique_ptr<Decoder> pDecoder;
+    TransformPlan oPlan;
+
+    while (true)
+    {
+        size_t nBegin = sJob.next_sample.fetch_add(nSamplesPerChunk);
+        if (nBegin >= sJob.count || nBegin > sJob.failed_sample)
+        {
+            // the chunks are handed out in order, so all remaining samples follow a failed one
+            break;
+        }
+        size_t nEnd = std::min(nBegin + nSamplesPerChunk, sJob.count);
+
+        for (size_t nSample = nBegin; nSample < nEnd; ++nSample)
+        {
+            const void* pSource = sJob.sources[nSample];
+            void* pDestination = sJob.destinations[nSample];
+            a_util::result::Result oResult;
+            if (!pSource || !pDestination)
+            {
+                oResult = ERR_POINTER;
+            }
+            else if (!pDecoder)
+            {
+                pDecoder.reset(new Decoder(sJob.factory->makeDecoderFor(pSource, sJob.source_sizes[nSample],
+                                                                       sJob.source_rep)));
+                oResult = oPlan.create(*pDecoder, eTargetRep);
+            }
+            else
+            {
+                oResult = pDecoder->rebind(pSource, sJob.source_sizes[nSample]);
+                if (isOk(oResult) && !oPlan.matches(*pDecoder))
+                {
+                    // the dynamic layout of the sample differs from the previous one
+                    oResult = oPlan.create(*pDecoder, eTargetRep);
+                }
+            }
+
+            if (isOk(oResult))
+            {
+                oResult = pDecoder->isValid();
+            }
+
+            if (isOk(oResult) && sJob.destination_sizes[nSample] < pDecoder->getBufferSize(eTargetRep))
+            {
+                oResult = ERR_INVALID_ARG;
+            }
+
+            if (isOk(oResult))
+            {
+                if (sJob.zero)
+                {
+                    a_util::memory::set(pDestination, sJob.destination_sizes[nSample], 0,
+                                        sJob.destination_sizes[nSample]);
+                }
+                oResult = oPlan.execute(*pDecoder, pDestination, sJob.destination_sizes[nSample]);
+            }
+
+            if (isFailed(oResult))
+            {
+                size_t nFirstFailed = sJob.failed_sample;
+                while (nSample < nFirstFailed &&
+                       !sJob.failed_sample.compare_exchange_weak(nFirstFailed, nSample))
+                {
+                }
+                nFailedSample = nSample;
+                return oResult;
+            }
+        }
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+}
+
+}
@@ -0,0 +1,151 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef DDL_SERIALIZER_BATCH_TRANSFORMER_CLASS_HEADER
+#define DDL_SERIALIZER_BATCH_TRANSFORMER_CLASS_HEADER
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "a_util/result.h"
+#include "a_util/concurrency.h"
+
+#include "codec/codec_factory.h"
+
+namespace ddl
+{
+
+namespace serialization
+{
+
+/**
+ * Transforms many samples of one structure into the opposite data representation
+ * using a pool of worker threads.
+ * Each worker keeps its own decoder and @ref TransformPlan for the duration of a call to
+ * @ref transform and rebinds them to the samples it processes.
+ */
+class BatchTransformer
+{
+    public:
+        /**
+         * Constructor that starts the worker threads.
+         * @param[in] thread_count The amount of worker threads, 0 uses one thread per core.
+         */
+        explicit BatchTransformer(size_t thread_count = 0);
+
+        /**
+         * Destructor that stops the worker threads.
+         */
+        ~BatchTransformer();
+
+        /**
+         * Noncopyable
+         */
+        BatchTransformer(const BatchTransformer&) = delete;
+
+        /**
+         * Noncopyable
+         */
+        BatchTransformer& operator=(const BatchTransformer&) = delete;
+
+        /**
+         * @return The amount of worker threads.
+         */
+        size_t getThreadCount() const;
+
+        /**
+         * Transforms the samples. Blocks until all samples have been transformed.
+         * @param[in] factory The factory of the structure of all samples.
+         * @param[in] source_rep The representation of the source samples.
+         * @param[in] sources Array of pointers to the source samples.
+         * @param[in] source_sizes Array with the sizes of the source samples.
+         * @param[out] destinations Array of pointers to the destination buffers.
+         * @param[in] destination_sizes Array with the sizes of the destination buffers.
+         * @param[in] count The amount of samples.
+         * @param[in] zero Whether or not to memzero the destination buffers before writing
+         *                 the elements to them.
+         * @retval ERR_INVALID_ARG A source sample or a destination buffer is too small.
+         * @retval ERR_POINTER One of the arrays is NULL.
+         * @return The error of the failed sample with the lowest index.
+         */
+        a_util::result::Result transform(const CodecFactory& factory,
+                                         DataRepresentation source_rep,
+                                         const void* const* sources,
+                                         const size_t* source_sizes,
+                                         void* const* destinations,
+                                         const size_t* destination_sizes,
+                                         size_t count,
+                                         bool zero = false);
+
+    private:
+        /// For internal use only. @internal
+        struct Job
+        {
+            const CodecFactory* factory;
+            DataRepresentation source_rep;
+            const void* const* sources;
+            const size_t* source_sizes;
+            void* const* destinations;
+            const size_t* destination_sizes;
+            size_t count;
+            bool zero;
+            std::atomic<size_t> next_sample;
+            /// the lowest index of a sample that failed so far, count if none failed
+            std::atomic<size_t> failed_sample;
+        };
+
+        /// For internal use only. @internal
+        void run();
+        /// For internal use only. @internal
+        a_util::result::Result process(Job& job, size_t& failed_sample);
+
+    private:
+        /// For internal use only. @internal
+        std::vector<a_util::concurrency::thread> _threads;
+        /// For internal use only. @internal
+        a_util::concurrency::mutex _mutex;
+        /// For internal use only. @internal
+        a_util::concurrency::condition_variable _job_available;
+        /// For internal use only. @internal
+        a_util::concurrency::condition_variable _job_done;
+        /// For internal use only. @internal Serializes concurrent calls to transform.
+        a_util::concurrency::mutex _transform_mutex;
+        /// For internal use only. @internal
+        Job* _job;
+        /// For internal use only. @internal
+        uint64_t _generation;
+        /// For internal use only. @internal
+        size_t _busy_threads;
+        /// For internal use only. @internal
+        bool _stop;
+        /// For internal use only. @internal
+        a_util::result::Result _result;
+        /// For internal use only. @internal The index of the sample _result belongs to.
+        size_t _result_sample;
+};
+
+}
+
+}
+
+#endif
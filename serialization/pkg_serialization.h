@@ -22,6 +22,8 @@
 #define _DDL_SERIALIZATION_PKG_HEADER_
 
 #include "serialization.h"
+#include "transform_plan.h"
+#include "batch_transformer.h"
 
 #endif
 
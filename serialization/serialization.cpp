@@ -19,6 +19,7 @@
 
 #include "serialization.h"
 #include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
 
 namespace ddl
 {
@@ -26,6 +27,7 @@ namespace ddl
 namespace serialization
 {
 //define all needed error types and values locally
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
 _MAKE_RESULT(-12, ERR_MEMORY);
 
 a_util::result::Result transform_to_buffer(const Decoder& decoder, a_util::memory::MemoryBuffer& buffer, bool zero)
@@ -50,6 +52,33 @@ a_util::result::Result transform_to_buffer(const Decoder& decoder, a_util::memor
     return transform(decoder, codec);
 }
 
+a_util::result::Result transform_to_buffer(const Decoder& decoder, const TransformPlan& plan,
+                                           a_util::memory::MemoryBuffer& buffer, bool zero)
+{
+    if (!plan.matches(decoder))
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    DataRepresentation target_rep = decoder.getRepresentation() == deserialized ?
+                                         serialized :
+                                         deserialized;
+    size_t needed_size = decoder.getBufferSize(target_rep);
+    if (buffer.getSize() < needed_size)
+    {
+        if (!buffer.allocate(needed_size))
+        {
+            return ERR_MEMORY;
+        }
+    }
+
+    if (zero)
+    {
+        a_util::memory::set(buffer.getPtr(), buffer.getSize(), 0, buffer.getSize());
+    }
+    return plan.execute(decoder, buffer.getPtr(), buffer.getSize());
+}
+
 }
 
 }
@@ -26,6 +26,7 @@
 #include "a_util/result.h"
 
 #include "codec/codec.h"
+#include "transform_plan.h"
 
 namespace ddl
 {
@@ -73,6 +74,19 @@ a_util::result::Result transform(const DECODER& decoder, ENCODER& encoder)
  */
 a_util::result::Result transform_to_buffer(const Decoder& decoder, a_util::memory::MemoryBuffer& buffer, bool zero = false);
 
+/**
+ * Tranforms the data from a given decoder into the opposite data representation using a
+ * precompiled plan. Use this to transform a stream of samples with the same layout.
+ * Allocates the buffer accordingly.
+ * @param[in] decoder The source decoder.
+ * @param[in] plan The plan, created for a decoder with the same layout.
+ * @param[out] buffer The destination buffer object.
+ * @param[in] zero Whether or not to memzero the buffer before writing the elements to it.
+ * @retval ERR_INVALID_ARG The plan does not match the decoder.
+ */
+a_util::result::Result transform_to_buffer(const Decoder& decoder, const TransformPlan& plan,
+                                           a_util::memory::MemoryBuffer& buffer, bool zero = false);
+
 }
 
 }
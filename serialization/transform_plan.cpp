@@ -0,0 +1,245 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#include "transform_plan.h"
+
+#include "a_util/result/error_def.h"
+#include "legacy_error_macros.h"
+
+#include "codec/element_accessor.h"
+#include "codec/bitserializer.h"
+#include "codec/dynamic_layout.h"
+
+namespace ddl
+{
+
+namespace serialization
+{
+//define all needed error types and values locally
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+_MAKE_RESULT(-10, ERR_INVALID_INDEX);
+
+static inline size_t getByteEnd(const Position& sPos)
+{
+    return (sPos.bit_offset + sPos.bit_size + 7) / 8;
+}
+
+static const ElementAccessor& getAccessor(DataRepresentation eRep)
+{
+    return eRep == deserialized ?
+                DeserializedAccessor::getInstance() :
+                SerializedAccessor::getInstance();
+}
+
+/**
+ * Determines how an element can be transformed between the two representations.
+ */
+static TransformPlan::OperationType getOperationType(const StructLayoutElement& sElement)
+{
+    if (sElement.serialized.bit_offset % 8 != 0 ||
+        sElement.deserialized.bit_offset % 8 != 0 ||
+        sElement.serialized.bit_size != sElement.deserialized.bit_size)
+    {
+        return TransformPlan::convert_element;
+    }
+
+    if (sElement.deserialized.bit_size == 8 ||
+        sElement.byte_order == a_util::memory::get_platform_endianess())
+    {
+        return TransformPlan::copy_span;
+    }
+
+    if (sElement.type != a_util::variant::VT_Bool &&
+        (sElement.deserialized.bit_size == 16 ||
+         sElement.deserialized.bit_size == 32 ||
+         sElement.deserialized.bit_size == 64))
+    {
+        return TransformPlan::swap_span;
+    }
+
+    return TransformPlan::convert_element;
+}
+
+TransformPlan::TransformPlan():
+    _element_count(0),
+    _min_source_size(0),
+    _min_destination_size(0),
+    _source_rep(deserialized)
+{
+}
+
+a_util::result::Result TransformPlan::create(const StaticDecoder& oDecoder, DataRepresentation eTargetRep)
+{
+    _operations.clear();
+    _element_count = oDecoder.getElementCount();
+    _min_source_size = 0;
+    _min_destination_size = 0;
+    _source_rep = oDecoder.getRepresentation();
+    _layout.reset();
+    _array_sizes.clear();
+    if (_source_rep == eTargetRep)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    for (size_t nElement = 0; nElement < _element_count; ++nElement)
+    {
+        const StructLayoutElement* pElement = oDecoder.getLayoutElement(nElement);
+        if (!pElement)
+        {
+            return ERR_INVALID_INDEX;
+        }
+
+        _min_source_size = std::max(_min_source_size, getByteEnd(_source_rep == deserialized ?
+                                                                 pElement->deserialized :
+                                                                 pElement->serialized));
+        _min_destination_size = std::max(_min_destination_size, getByteEnd(eTargetRep == deserialized ?
+                                                                           pElement->deserialized :
+                                                                           pElement->serialized));
+
+        OperationType eType = getOperationType(*pElement);
+        size_t nElementSize = pElement->deserialized.bit_size / 8;
+        if (eType != convert_element && !_operations.empty() &&
+            _operations.back().type == eType &&
+            (eType == copy_span || _operations.back().element_size == nElementSize))
+        {
+            // extend the previous span if the element directly follows it in both representations
+            StructLayoutElement& sSpan = _operations.back().element;
+            if (sSpan.deserialized.bit_offset + sSpan.deserialized.bit_size == pElement->deserialized.bit_offset &&
+                sSpan.serialized.bit_offset + sSpan.serialized.bit_size == pElement->serialized.bit_offset)
+            {
+                sSpan.deserialized.bit_size += pElement->deserialized.bit_size;
+                sSpan.serialized.bit_size += pElement->serialized.bit_size;
+                continue;
+            }
+        }
+
+        Operation sOperation;
+        sOperation.element = *pElement;
+        sOperation.element.name.clear();
+        sOperation.element.p_enum = NULL;
+        sOperation.element.constant = NULL;
+        sOperation.type = eType;
+        sOperation.element_size = nElementSize;
+        _operations.push_back(sOperation);
+    }
+
+    const DynamicLayout* pDynamicLayout = oDecoder.getDynamicLayout();
+    if (pDynamicLayout)
+    {
+        pDynamicLayout->getArraySizes(_array_sizes);
+    }
+    _layout = oDecoder._layout;
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result TransformPlan::execute(const void* pSource, size_t nSourceSize,
+                                              void* pDestination, size_t nDestinationSize) const
+{
+    if (nSourceSize < _min_source_size || nDestinationSize < _min_destination_size)
+    {
+        return ERR_INVALID_ARG;
+    }
+
+    const ElementAccessor& oSourceAccessor = getAccessor(_source_rep);
+    const ElementAccessor& oDestinationAccessor = getAccessor(_source_rep == deserialized ?
+                                                              serialized : deserialized);
+    const uint8_t* pSourceBytes = static_cast<const uint8_t*>(pSource);
+    uint8_t* pDestinationBytes = static_cast<uint8_t*>(pDestination);
+
+    for (std::vector<Operation>::const_iterator itOperation = _operations.begin();
+         itOperation != _operations.end(); ++itOperation)
+    {
+        const StructLayoutElement& sElement = itOperation->element;
+        if (itOperation->type == convert_element)
+        {
+            uint64_t nBuffer = 0;
+            RETURN_IF_FAILED(oSourceAccessor.getValue(sElement, pSource, nSourceSize, &nBuffer));
+            RETURN_IF_FAILED(oDestinationAccessor.setValue(sElement, pDestination, nDestinationSize, &nBuffer));
+            continue;
+        }
+
+        size_t nSourceOffset = _source_rep == deserialized ?
+                                    sElement.deserialized.bit_offset / 8 :
+                                    sElement.serialized.bit_offset / 8;
+        size_t nDestinationOffset = _source_rep == deserialized ?
+                                    sElement.serialized.bit_offset / 8 :
+                                    sElement.deserialized.bit_offset / 8;
+        size_t nSize = sElement.deserialized.bit_size / 8;
+        if (itOperation->type == copy_span)
+        {
+            a_util::memory::copy(pDestinationBytes + nDestinationOffset, nSize,
+                                 pSourceBytes + nSourceOffset, nSize);
+        }
+        else
+        {
+            RETURN_IF_FAILED(a_util::memory::detail::swapEndianessArray(pDestinationBytes + nDestinationOffset,
+                                                                        pSourceBytes + nSourceOffset,
+                                                                        itOperation->element_size,
+                                                                        nSize / itOperation->element_size));
+        }
+    }
+
+    return a_util::result::SUCCESS;
+}
+
+a_util::result::Result TransformPlan::execute(const StaticDecoder& oDecoder,
+                                              void* pDestination, size_t nDestinationSize) const
+{
+    if (!matches(oDecoder))
+    {
+        return ERR_INVALID_ARG;
+    }
+    return execute(oDecoder._data, oDecoder._data_size, pDestination, nDestinationSize);
+}
+
+bool TransformPlan::matches(const StaticDecoder& oDecoder) const
+{
+    // the positions of all elements follow from the struct and the sizes of its dynamic arrays,
+    // a layout that failed to expand ends earlier and therefore has less elements
+    if (!_layout || _layout != oDecoder._layout ||
+        _source_rep != oDecoder.getRepresentation() ||
+        _element_count != oDecoder.getElementCount())
+    {
+        return false;
+    }
+
+    const DynamicLayout* pDynamicLayout = oDecoder.getDynamicLayout();
+    return pDynamicLayout ? pDynamicLayout->hasArraySizes(_array_sizes) : _array_sizes.empty();
+}
+
+size_t TransformPlan::getElementCount() const
+{
+    return _element_count;
+}
+
+size_t TransformPlan::getOperationCount() const
+{
+    return _operations.size();
+}
+
+DataRepresentation TransformPlan::getSourceRepresentation() const
+{
+    return _source_rep;
+}
+
+}
+
+}
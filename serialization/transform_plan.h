@@ -0,0 +1,150 @@
+/**
+ * @file
+ * Implementation of the ADTF default media description.
+ *
+ * @copyright
+ * @verbatim
+   Copyright @ 2017 Audi Electronics Venture GmbH. All rights reserved.
+
+       This Source Code Form is subject to the terms of the Mozilla
+       Public License, v. 2.0. If a copy of the MPL was not distributed
+       with this file, You can obtain one at https://mozilla.org/MPL/2.0/.
+
+   If it is not possible or desirable to put the notice in a particular file, then
+   You may include the notice in a location (such as a LICENSE file in a
+   relevant directory) where a recipient would be likely to look for such a notice.
+
+   You may add additional accurate notices of copyright ownership.
+   @endverbatim
+*/
+
+#ifndef DDL_SERIALIZER_TRANSFORM_PLAN_CLASS_HEADER
+#define DDL_SERIALIZER_TRANSFORM_PLAN_CLASS_HEADER
+
+#include <vector>
+
+#include "a_util/result.h"
+
+#include "codec/static_codec.h"
+
+namespace ddl
+{
+
+namespace serialization
+{
+
+/**
+ * Precompiled plan that converts data from one representation into the other.
+ * Runs of elements that are byte aligned and have the same size and byte order in both
+ * representations are merged into single memory copies. Runs of byte aligned elements of the
+ * same size with a byte order different from the platform (i.e. big endian arrays) are
+ * converted at once with vectorized byte swaps. All other elements are converted one by one.
+ * A plan can be reused for all data with the same layout as the decoder it has been
+ * created for, i.e. all data of a static struct or all data with the same dynamic array sizes.
+ */
+class TransformPlan
+{
+    public:
+        /**
+         * The kinds of operations a plan consists of.
+         */
+        enum OperationType
+        {
+            copy_span,      ///< Memory copy of consecutive elements.
+            swap_span,      ///< Byte swapping copy of consecutive elements of the same size.
+            convert_element ///< Conversion of a single element.
+        };
+
+    public:
+        /**
+         * Constructor that creates an empty plan.
+         */
+        TransformPlan();
+
+        /**
+         * Creates the plan for the elements of the given decoder.
+         * @param[in] decoder The decoder whose data should be transformed.
+         * @param[in] target_rep The data representation that the data should be transformed into.
+         * @return Standard result.
+         */
+        a_util::result::Result create(const StaticDecoder& decoder, DataRepresentation target_rep);
+
+        /**
+         * Transforms the data.
+         * @param[in] source The source data.
+         * @param[in] source_size The size of the source data.
+         * @param[out] destination The destination data.
+         * @param[in] destination_size The size of the destination data.
+         * @retval ERR_INVALID_ARG One of the buffers is too small.
+         */
+        a_util::result::Result execute(const void* source, size_t source_size,
+                                       void* destination, size_t destination_size) const;
+
+        /**
+         * Transforms the data of a decoder.
+         * @param[in] decoder The decoder of the source data.
+         * @param[out] destination The destination data.
+         * @param[in] destination_size The size of the destination data.
+         * @retval ERR_INVALID_ARG One of the buffers is too small or the plan does not match the decoder.
+         */
+        a_util::result::Result execute(const StaticDecoder& decoder,
+                                       void* destination, size_t destination_size) const;
+
+        /**
+         * Checks whether the plan has been created for the layout of the given decoder,
+         * i.e. for the same struct, the same data representation and the same sizes
+         * of the dynamic arrays.
+         * @param[in] decoder The decoder to check.
+         * @return Whether the plan can transform the data of the decoder.
+         */
+        bool matches(const StaticDecoder& decoder) const;
+
+        /**
+         * @return The amount of elements that the plan has been created for.
+         */
+        size_t getElementCount() const;
+
+        /**
+         * @return The amount of memory copies, byte swaps and element conversions the plan consists of.
+         */
+        size_t getOperationCount() const;
+
+        /**
+         * @return The data representation of the source data.
+         */
+        DataRepresentation getSourceRepresentation() const;
+
+    private:
+        /// For internal use only. @internal
+        struct Operation
+        {
+            /// The source and destination positions of the element or span.
+            StructLayoutElement element;
+            /// The kind of operation.
+            OperationType type;
+            /// The size of a single element of a swap span in bytes.
+            size_t element_size;
+        };
+
+    private:
+        /// For internal use only. @internal
+        std::vector<Operation> _operations;
+        /// For internal use only. @internal
+        size_t _element_count;
+        /// For internal use only. @internal
+        size_t _min_source_size;
+        /// For internal use only. @internal
+        size_t _min_destination_size;
+        /// For internal use only. @internal
+        DataRepresentation _source_rep;
+        /// For internal use only. @internal Kept alive so that its address can not be reused.
+        a_util::memory::shared_ptr<const StructLayout> _layout;
+        /// For internal use only. @internal
+        std::vector<uint64_t> _array_sizes;
+};
+
+}
+
+}
+
+#endif
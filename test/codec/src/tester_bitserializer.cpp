@@ -18,6 +18,7 @@
    @endverbatim
 */
 
+#include <vector>
 #include <gtest/gtest.h>
 #include "../../_common/adtf_compat.h"
 #include "../../_common/compat.h"
@@ -481,4 +482,133 @@ TEST(CodecTest,
 
     ASSERT_TRUE(sValue2 == sResult2);
 
-}
\ No newline at end of file
+}
+
+/**
+* @detail  Read and write big endian arrays with all available byte swap kernels
+*/
+TEST(CodecTest,
+    BitSerializerTestArrays)
+{
+    TEST_REQ("");
+
+    uint8_t aui8Buffer[1 + 37 * 8];
+    for (size_t nByte = 0; nByte < sizeof(aui8Buffer); ++nByte)
+    {
+        aui8Buffer[nByte] = static_cast<uint8_t>(nByte * 13 + 1);
+    }
+    BitSerializer oBits(aui8Buffer, sizeof(aui8Buffer));
+
+    uint32_t aui32Array[37];
+    ASSERT_EQ(a_util::result::SUCCESS, oBits.readArray(8, 37, aui32Array, bit_big_endian));
+    for (size_t nIndex = 0; nIndex < 37; ++nIndex)
+    {
+        uint32_t ui32Value = 0;
+        ASSERT_EQ(a_util::result::SUCCESS, oBits.read(8 + nIndex * 32, 32, &ui32Value, bit_big_endian));
+        ASSERT_EQ(aui32Array[nIndex], ui32Value);
+    }
+
+    // unaligned arrays fall back to the element-wise conversion
+    uint16_t aui16Array[37];
+    ASSERT_EQ(a_util::result::SUCCESS, oBits.readArray(3, 37, aui16Array, bit_big_endian));
+    for (size_t nIndex = 0; nIndex < 37; ++nIndex)
+    {
+        uint16_t ui16Value = 0;
+        ASSERT_EQ(a_util::result::SUCCESS, oBits.read(3 + nIndex * 16, 16, &ui16Value, bit_big_endian));
+        ASSERT_EQ(aui16Array[nIndex], ui16Value);
+    }
+
+    double af64Array[37];
+    for (size_t nIndex = 0; nIndex < 37; ++nIndex)
+    {
+        af64Array[nIndex] = nIndex * 1.5 - 7.25;
+    }
+    ASSERT_EQ(a_util::result::SUCCESS, oBits.writeArray(8, 37, af64Array, bit_big_endian));
+    for (size_t nIndex = 0; nIndex < 37; ++nIndex)
+    {
+        double f64Value = 0;
+        ASSERT_EQ(a_util::result::SUCCESS, oBits.read(8 + nIndex * 64, 64, &f64Value, bit_big_endian));
+        ASSERT_EQ(af64Array[nIndex], f64Value);
+    }
+    ASSERT_NE(a_util::result::SUCCESS, oBits.readArray(16, 37, af64Array, bit_big_endian));
+
+    for (size_t nElementSize = 2; nElementSize <= 8; nElementSize *= 2)
+    {
+        uint8_t aui8Expected[sizeof(aui8Buffer)];
+        size_t nCount = (sizeof(aui8Buffer) - 1) / nElementSize;
+        ASSERT_EQ(a_util::result::SUCCESS, detail::swapEndianessArray(aui8Expected, aui8Buffer + 1, nElementSize,
+                                                                      nCount, detail::swap_kernel_scalar));
+        for (int nKernel = detail::swap_kernel_sse2; nKernel <= detail::swap_kernel_avx2; ++nKernel)
+        {
+            if (!detail::isSwapKernelSupported(static_cast<detail::SwapKernel>(nKernel)))
+            {
+                continue;
+            }
+            uint8_t aui8Result[sizeof(aui8Buffer)];
+            ASSERT_EQ(a_util::result::SUCCESS, detail::swapEndianessArray(aui8Result, aui8Buffer + 1, nElementSize,
+                                                                          nCount, static_cast<detail::SwapKernel>(nKernel)));
+            ASSERT_EQ(0, a_util::memory::compare(aui8Result, nCount * nElementSize,
+                                                 aui8Expected, nCount * nElementSize));
+        }
+        ASSERT_EQ(aui8Expected[0], aui8Buffer[nElementSize]);
+    }
+    ASSERT_NE(a_util::result::SUCCESS, detail::swapEndianessArray(aui8Buffer, aui8Buffer, 3, 1));
+}
+
+template <typename T>
+void compareArrayWithElementWise(size_t nStartBit, Endianess eEndianess)
+{
+    const size_t nCount = 1024;
+    const size_t nBitSize = sizeof(T) * 8;
+    std::vector<uint8_t> oBuffer(nCount * sizeof(T) + 1);
+    for (size_t nByte = 0; nByte < oBuffer.size(); ++nByte)
+    {
+        oBuffer[nByte] = static_cast<uint8_t>(nByte * 7 + 3);
+    }
+    BitSerializer oBits(&oBuffer[0], oBuffer.size());
+
+    std::vector<T> oArray(nCount);
+    ASSERT_EQ(a_util::result::SUCCESS, oBits.readArray(nStartBit, nCount, &oArray[0], eEndianess));
+    for (size_t nIndex = 0; nIndex < nCount; ++nIndex)
+    {
+        T xValue = 0;
+        ASSERT_EQ(a_util::result::SUCCESS, oBits.read(nStartBit + nIndex * nBitSize, nBitSize, &xValue, eEndianess));
+        ASSERT_EQ(xValue, oArray[nIndex]);
+    }
+
+    std::vector<uint8_t> oElementWise(oBuffer);
+    BitSerializer oElementWiseBits(&oElementWise[0], oElementWise.size());
+    for (size_t nIndex = 0; nIndex < nCount; ++nIndex)
+    {
+        oArray[nIndex] = static_cast<T>(nIndex * 0x01030507 + 11);
+        ASSERT_EQ(a_util::result::SUCCESS, oElementWiseBits.write(nStartBit + nIndex * nBitSize, nBitSize,
+                                                                  oArray[nIndex], eEndianess));
+    }
+    ASSERT_EQ(a_util::result::SUCCESS, oBits.writeArray(nStartBit, nCount, &oArray[0], eEndianess));
+    ASSERT_TRUE(oBuffer == oElementWise);
+}
+
+/**
+* @detail  Compare the array conversion of 1k element arrays with the element-wise conversion
+*/
+TEST(CodecTest,
+    BitSerializerTestArraysElementWise)
+{
+    TEST_REQ("");
+
+    Endianess aEndianess[] = {bit_little_endian, bit_big_endian};
+    size_t aStartBits[] = {0, 3, 8};
+    for (size_t nEndianess = 0; nEndianess < 2; ++nEndianess)
+    {
+        for (size_t nStartBit = 0; nStartBit < 3; ++nStartBit)
+        {
+            compareArrayWithElementWise<uint8_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<int16_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<uint16_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<int32_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<uint32_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<int64_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+            compareArrayWithElementWise<uint64_t>(aStartBits[nStartBit], aEndianess[nEndianess]);
+        }
+    }
+}
@@ -18,6 +18,8 @@
    @endverbatim
 */
 
+#include <cstdio>
+#include <cstring>
 #include <ddl.h>
 #include <gtest/gtest.h>
 #include "../../_common/adtf_compat.h"
@@ -25,6 +27,8 @@
 
 using namespace ddl;
 
+_MAKE_RESULT(-5, ERR_INVALID_ARG);
+
 void DumpElements(const StaticDecoder& oDecoder)
 {
     const uint8_t* pFirstElement = static_cast<const uint8_t*>(oDecoder.getElementAddress(0));
@@ -166,6 +170,41 @@ TEST(CodecTest,
     test_static(oFactory, static_struct::sTestData, deserialized);
 }
 
+/**
+* @detail Check access through resolved element handles
+*/
+TEST(CodecTest,
+    TestElementHandles)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("test", static_struct::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    ElementHandle<int32_t> oValue = oFactory.resolve<int32_t>("child[1].value[2]");
+    ElementHandle<int8_t> oAfter = oFactory.resolve<int8_t>("child[0].after");
+    ASSERT_TRUE(oValue.isValid());
+    ASSERT_TRUE(oAfter.isValid());
+    ASSERT_EQ(oValue.getIndex() , 8);
+    ASSERT_FALSE(oFactory.resolve<int32_t>("child[0].after").isValid());
+    ASSERT_FALSE(oFactory.resolve<int32_t>("does_not_exist").isValid());
+
+    static_struct::tTest sTest = static_struct::sTestData;
+    StaticCodec oCodec = oFactory.makeStaticCodecFor(&sTest, sizeof(sTest));
+    ASSERT_EQ(oCodec.getValue(oValue) , 9);
+    ASSERT_EQ(oCodec.getValue(oAfter) , 5);
+    oCodec.setValue(oValue, 0x20);
+    ASSERT_EQ(sTest.sChild[1].nValue[2] , 0x20);
+
+    static_struct::serialized::tTest sSerialized = static_struct::serialized::sTestData;
+    StaticCodec oSerializedCodec = oFactory.makeStaticCodecFor(&sSerialized, sizeof(sSerialized),
+                                                               serialized);
+    ASSERT_EQ(oSerializedCodec.getValue(oValue) , 9);
+    ASSERT_EQ(oSerializedCodec.getValue(oAfter) , 5);
+    oSerializedCodec.setValue(oValue, 0x20);
+    ASSERT_EQ(access_element::get_value(oSerializedCodec, "child[1].value[2]").getInt32() , 0x20);
+}
+
 /**
 * @detail  Check serialized codec static information
 */
@@ -178,6 +217,179 @@ TEST(CodecTest,
     test_static(oFactory, static_struct::serialized::sTestData, serialized);
 }
 
+/**
+* @detail Check that struct layouts are shared between factories for the same description
+*/
+TEST(CodecTest,
+    TestLayoutCache)
+{
+    TEST_REQ("");
+
+    CodecFactory::clearLayoutCache();
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 0);
+
+    CodecFactory oFactory("test", static_struct::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 1);
+
+    CodecFactory oCachedFactory("test", static_struct::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oCachedFactory.isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 1);
+    ASSERT_EQ(oCachedFactory.getStaticElementCount() , oFactory.getStaticElementCount());
+    ASSERT_EQ(oCachedFactory.getStaticBufferSize(serialized) , oFactory.getStaticBufferSize(serialized));
+
+    Decoder oDecoder = oCachedFactory.makeDecoderFor(&static_struct::sTestData,
+                                                     sizeof(static_struct::sTestData));
+    ASSERT_EQ(access_element::get_value(oDecoder, "child[1].after").getInt8() , 10);
+
+    // invalid factories are not cached
+    ASSERT_NE(a_util::result::SUCCESS, CodecFactory("unknown", static_struct::strTestDesc).isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 1);
+
+    CodecFactory::clearLayoutCache();
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 0);
+    ASSERT_EQ(access_element::get_value(oDecoder, "child[1].after").getInt8() , 10);
+}
+
+/**
+* @detail Check that the layout cache evicts the least recently used layouts
+*/
+TEST(CodecTest,
+    TestLayoutCacheCapacity)
+{
+    TEST_REQ("");
+
+    CodecFactory::clearLayoutCache();
+    size_t nDefaultCapacity = CodecFactory::getLayoutCacheCapacity();
+    ASSERT_GT(nDefaultCapacity , 0);
+
+    CodecFactory::setLayoutCacheCapacity(2);
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("test", static_struct::strTestDesc).isValid());
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("child_struct", static_struct::strTestDesc).isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 2);
+
+    // "test" is now the most recently used layout, so "child_struct" is evicted
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("test", static_struct::strTestDesc).isValid());
+    std::string strOtherDesc = std::string(static_struct::strTestDesc) + " ";
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("test", strOtherDesc.c_str()).isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 2);
+
+    CodecFactory::setLayoutCacheCapacity(1);
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 1);
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("test", strOtherDesc.c_str()).isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 1);
+
+    // evicted layouts stay valid in existing factories
+    CodecFactory oFactory("test", static_struct::strTestDesc);
+    CodecFactory::setLayoutCacheCapacity(0);
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 0);
+    Decoder oDecoder = oFactory.makeDecoderFor(&static_struct::sTestData,
+                                               sizeof(static_struct::sTestData));
+    ASSERT_EQ(access_element::get_value(oDecoder, "child[1].after").getInt8() , 10);
+
+    ASSERT_EQ(a_util::result::SUCCESS, CodecFactory("test", static_struct::strTestDesc).isValid());
+    ASSERT_EQ(CodecFactory::getLayoutCacheSize() , 0);
+
+    CodecFactory::setLayoutCacheCapacity(nDefaultCapacity);
+}
+
+/**
+* @detail Check the columnar extraction of elements from many samples
+*/
+TEST(CodecTest,
+    TestColumnExtractor)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("test", static_struct::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    std::vector<std::string> vecNames;
+    vecNames.push_back("child[0].value[1]");
+    vecNames.push_back("child[1].after");
+
+    static_struct::tTest asSamples[3] = { static_struct::sTestData, static_struct::sTestData,
+                                          static_struct::sTestData };
+    static_struct::serialized::tTest asSerializedSamples[3] = { static_struct::serialized::sTestData,
+                                                                static_struct::serialized::sTestData,
+                                                                static_struct::serialized::sTestData };
+    for (int32_t nSample = 0; nSample < 3; ++nSample)
+    {
+        asSamples[nSample].sChild[0].nValue[1] = nSample * 1000;
+        asSamples[nSample].sChild[1].nAfter = static_cast<int8_t>(nSample);
+        asSerializedSamples[nSample].sChild[0].nValue[1] = a_util::memory::swapEndianess(nSample * 1000);
+        asSerializedSamples[nSample].sChild[1].nAfter = static_cast<int8_t>(nSample);
+    }
+
+    ColumnExtractor oExtractor;
+    ASSERT_EQ(a_util::result::SUCCESS, oExtractor.create(oFactory, vecNames, deserialized));
+    ASSERT_EQ(oExtractor.getColumnCount() , 2);
+    ASSERT_EQ(oExtractor.getColumnType(0) , a_util::variant::VT_Int32);
+    ASSERT_EQ(oExtractor.getColumnValueSize(1) , sizeof(int8_t));
+
+    int32_t anValues[3] = {};
+    int8_t anAfter[3] = {};
+    void* apColumns[2] = { anValues, anAfter };
+    ASSERT_EQ(a_util::result::SUCCESS, oExtractor.extractContiguous(asSamples, 3, sizeof(static_struct::tTest), apColumns));
+    for (int32_t nSample = 0; nSample < 3; ++nSample)
+    {
+        ASSERT_EQ(anValues[nSample] , nSample * 1000);
+        ASSERT_EQ(anAfter[nSample] , nSample);
+    }
+    ASSERT_NE(a_util::result::SUCCESS, oExtractor.extractContiguous(asSamples, 3, 4, apColumns));
+
+    const void* apSamples[3] = { &asSerializedSamples[2], &asSerializedSamples[0], &asSerializedSamples[1] };
+    ASSERT_EQ(a_util::result::SUCCESS, oExtractor.create(oFactory, vecNames, serialized));
+    ASSERT_EQ(a_util::result::SUCCESS, oExtractor.extract(apSamples, 3, sizeof(static_struct::serialized::tTest),
+                                                          apColumns));
+    ASSERT_EQ(anValues[0] , 2000);
+    ASSERT_EQ(anValues[1] , 0);
+    ASSERT_EQ(anValues[2] , 1000);
+    ASSERT_EQ(anAfter[0] , 2);
+
+    vecNames.push_back("does_not_exist");
+    ASSERT_NE(a_util::result::SUCCESS, oExtractor.create(oFactory, vecNames, serialized));
+}
+
+/**
+* @detail Check that a reused transform plan yields the same result as the element-wise transform
+*/
+TEST(CodecTest,
+    TestTransformPlan)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("test", static_struct::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    Decoder oDecoder = oFactory.makeDecoderFor(&static_struct::sTestData,
+                                               sizeof(static_struct::sTestData));
+    serialization::TransformPlan oPlan;
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.create(oDecoder, serialized));
+    ASSERT_EQ(oPlan.getElementCount() , oDecoder.getElementCount());
+    ASSERT_NE(a_util::result::SUCCESS, serialization::TransformPlan().create(oDecoder, deserialized));
+
+    for (int nSample = 0; nSample < 2; ++nSample)
+    {
+        a_util::memory::MemoryBuffer oBuffer;
+        ASSERT_EQ(a_util::result::SUCCESS, serialization::transform_to_buffer(oDecoder, oPlan, oBuffer, true));
+        ASSERT_EQ(oBuffer.getSize() , sizeof(static_struct::serialized::sTestData));
+        ASSERT_EQ(a_util::memory::compare(oBuffer.getPtr(), oBuffer.getSize(),
+                                          &static_struct::serialized::sTestData,
+                                          sizeof(static_struct::serialized::sTestData)) , 0);
+    }
+
+    static_struct::tTest sDeserialized = {};
+    Decoder oSerializedDecoder = oFactory.makeDecoderFor(&static_struct::serialized::sTestData,
+                                                         sizeof(static_struct::serialized::sTestData),
+                                                         serialized);
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.create(oSerializedDecoder, deserialized));
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.execute(oSerializedDecoder, &sDeserialized, sizeof(sDeserialized)));
+    ASSERT_EQ(sDeserialized.sChild[1].nValue[2] , 9);
+    ASSERT_EQ(sDeserialized.sChild[1].nAfter , 10);
+    ASSERT_NE(a_util::result::SUCCESS, oPlan.execute(oSerializedDecoder, &sDeserialized, 4));
+}
+
 namespace simple
 {
     struct tMain
@@ -244,6 +456,16 @@ void TestDynamicSimple(CodecFactory& oFactory, const T& sTestData, DataRepresent
     ASSERT_EQ(access_element::get_value(oDecoder, "array[2]").getInt32() , 3);
     ASSERT_EQ(access_element::get_value(oDecoder, "array[3]").getInt32() , 4);
     ASSERT_EQ(access_element::get_value(oDecoder, "after").getInt16() , 8);
+
+    size_t nIndex = 200;
+    ASSERT_EQ(a_util::result::SUCCESS, access_element::find_index(oDecoder, "array_size", nIndex));
+    ASSERT_EQ(nIndex , 0);
+    ASSERT_EQ(a_util::result::SUCCESS, access_element::find_index(oDecoder, "array[2]", nIndex));
+    ASSERT_EQ(nIndex , 3);
+    ASSERT_EQ(a_util::result::SUCCESS, access_element::find_index(oDecoder, "after", nIndex));
+    ASSERT_EQ(nIndex , 5);
+    ASSERT_NE(a_util::result::SUCCESS, access_element::find_index(oDecoder, "array[4]", nIndex));
+    ASSERT_NE(a_util::result::SUCCESS, access_element::find_index(oFactory, "array[0]", nIndex));
 }
 
 /**
@@ -451,6 +673,252 @@ TEST(CodecTest,
     ::TestDynamicComplex(oFactory, complex::serialized::sTestData, serialized);
 }
 
+/**
+* @detail  Check that dynamic layouts are reused only for data with the same array sizes
+*/
+TEST(CodecTest,
+    TestDynamicLayoutReuse)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("main", complex::strTestDesc);
+    ::TestDynamicComplex(oFactory, complex::sTestData, deserialized);
+
+    complex::tMain sSmaller = complex::sTestData;
+    sSmaller.sTest.nArraySize = 1;
+    Decoder oSmaller = oFactory.makeDecoderFor(&sSmaller, sizeof(sSmaller));
+    ASSERT_EQ(a_util::result::SUCCESS, oSmaller.isValid());
+    ASSERT_EQ(oSmaller.getElementCount() , 13);
+    ASSERT_EQ(access_element::get_value(oSmaller, "test.array[0].child_array2[1]").getInt32() , 20);
+    size_t nIndex = 0;
+    ASSERT_NE(a_util::result::SUCCESS, access_element::find_index(oSmaller, "test.array[1].child_size", nIndex));
+
+    complex::tMain sOther = complex::sTestData;
+    sOther.sTest.aArray[1].nChildSize = 2;
+    Decoder oOther = oFactory.makeDecoderFor(&sOther, sizeof(sOther));
+    ASSERT_EQ(oOther.getElementCount() , 22);
+    ASSERT_EQ(access_element::get_value(oOther, "test.array[1].child_array[1]").getInt32() , 22);
+
+    // the original sizes again
+    ::TestDynamicComplex(oFactory, complex::sTestData, deserialized);
+    const StructElement* pElement = NULL;
+    ASSERT_EQ(a_util::result::SUCCESS, oSmaller.getElement(oSmaller.getElementCount() - 1, pElement));
+    ASSERT_EQ(pElement->name , "after");
+}
+
+/**
+* @detail Check that a transform plan is rejected for decoders with a different layout
+*/
+TEST(CodecTest,
+    TestTransformPlanMismatch)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("main", complex::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+    Decoder oDecoder = oFactory.makeDecoderFor(&complex::sTestData, sizeof(complex::sTestData));
+    serialization::TransformPlan oPlan;
+    ASSERT_EQ(a_util::result::SUCCESS, oPlan.create(oDecoder, serialized));
+    ASSERT_TRUE(oPlan.matches(oDecoder));
+
+    // same amount of elements, but the array sizes 2 and 3 instead of 3 and 2
+    complex::tMain sSwapped = complex::sTestData;
+    sSwapped.sTest.aArray[0].nChildSize = 2;
+    sSwapped.sTest.aArray[0].nChildSize2 = 3;
+    Decoder oSwapped = oFactory.makeDecoderFor(&sSwapped, sizeof(sSwapped));
+    ASSERT_EQ(oSwapped.getElementCount() , oDecoder.getElementCount());
+    ASSERT_FALSE(oPlan.matches(oSwapped));
+    a_util::memory::MemoryBuffer oBuffer;
+    ASSERT_NE(a_util::result::SUCCESS, serialization::transform_to_buffer(oSwapped, oPlan, oBuffer));
+    ASSERT_NE(a_util::result::SUCCESS, oPlan.execute(oSwapped, oBuffer.getPtr(), oBuffer.getSize()));
+
+    // another struct
+    CodecFactory oStaticFactory("test", static_struct::strTestDesc);
+    Decoder oStaticDecoder = oStaticFactory.makeDecoderFor(&static_struct::sTestData,
+                                                           sizeof(static_struct::sTestData));
+    ASSERT_FALSE(oPlan.matches(oStaticDecoder));
+
+    // the same sizes in other data match again
+    complex::tMain sCopy = complex::sTestData;
+    Decoder oCopy = oFactory.makeDecoderFor(&sCopy, sizeof(sCopy));
+    ASSERT_TRUE(oPlan.matches(oCopy));
+    ASSERT_EQ(a_util::result::SUCCESS, serialization::transform_to_buffer(oCopy, oPlan, oBuffer, true));
+    ASSERT_EQ(a_util::memory::compare(oBuffer.getPtr(), sizeof(complex::serialized::sTestData),
+                                      &complex::serialized::sTestData,
+                                      sizeof(complex::serialized::sTestData)) , 0);
+}
+
+namespace hostile
+{
+    const char* strTestDesc =
+        "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+        "<structs>"
+        "<struct alignment=\"1\" name=\"main\" version=\"2\">"
+        "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"array_size\" type=\"tUInt32\"/>"
+        "<element alignment=\"1\" arraysize=\"array_size\" byteorder=\"LE\" bytepos=\"4\" name=\"array\" type=\"tUInt8\"/>"
+        "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"-1\" name=\"after\" type=\"tUInt8\"/>"
+        "</struct>"
+        "</structs>";
+
+#pragma pack(push, 1)
+    struct tMain
+    {
+        uint32_t nArraySize;
+        uint8_t aArray[4];
+    };
+#pragma pack(pop)
+}
+
+/**
+* @detail  Check that array sizes exceeding the data are rejected before the layout is expanded
+*/
+TEST(CodecTest,
+    TestDynamicArraySizeOutOfRange)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("main", hostile::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    hostile::tMain sData = {0xFFFFFFFF, {1, 2, 3, 4}};
+    Decoder oDecoder = oFactory.makeDecoderFor(&sData, sizeof(sData));
+    ASSERT_NE(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(oDecoder.getElementCount() , 1);
+    // the rejected size is not used to name the elements
+    size_t nIndex = 0;
+    ASSERT_EQ(a_util::result::SUCCESS, access_element::find_index(oDecoder, "array_size", nIndex));
+    ASSERT_NE(a_util::result::SUCCESS, access_element::find_index(oDecoder, "array[0]", nIndex));
+
+    // the array fits, but "after" is outside of the data
+    sData.nArraySize = 4;
+    ASSERT_NE(a_util::result::SUCCESS, oDecoder.rebind(&sData, sizeof(sData)));
+    ASSERT_NE(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(oDecoder.getElementCount() , 5);
+    ASSERT_EQ(access_element::get_value(oDecoder, "array[3]").getUInt8() , 4);
+    ASSERT_NE(a_util::result::SUCCESS, access_element::find_index(oDecoder, "after", nIndex));
+
+    sData.nArraySize = 3;
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.rebind(&sData, sizeof(sData)));
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(oDecoder.getElementCount() , 5);
+    ASSERT_EQ(access_element::get_value(oDecoder, "after").getUInt8() , 4);
+
+    // a cached layout for a larger buffer must not be used for a smaller one
+    Decoder oSmaller = oFactory.makeDecoderFor(&sData, sizeof(sData) - 1);
+    ASSERT_NE(a_util::result::SUCCESS, oSmaller.isValid());
+    ASSERT_EQ(oSmaller.getElementCount() , 4);
+}
+
+/**
+* @detail  Check rebinding decoders and codecs to new data
+*/
+TEST(CodecTest,
+    TestRebind)
+{
+    TEST_REQ("");
+
+    CodecFactory oFactory("main", complex::strTestDesc);
+    Decoder oDecoder = oFactory.makeDecoderFor(&complex::sTestData, sizeof(complex::sTestData));
+    ASSERT_EQ(oDecoder.getElementCount() , 23);
+
+    complex::tMain sSameSizes = complex::sTestData;
+    sSameSizes.sTest.aArray[1].aChildArray[2] = 99;
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.rebind(&sSameSizes, sizeof(sSameSizes)));
+    ASSERT_EQ(oDecoder.getElementCount() , 23);
+    ASSERT_EQ(access_element::get_value(oDecoder, "test.array[1].child_array[2]").getInt32() , 99);
+
+    complex::tMain sSmaller = complex::sTestData;
+    sSmaller.sTest.nArraySize = 1;
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.rebind(&sSmaller, sizeof(sSmaller)));
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(oDecoder.getElementCount() , 13);
+
+    ASSERT_NE(a_util::result::SUCCESS, oDecoder.rebind(&complex::sTestData, 4));
+    ASSERT_NE(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.rebind(&complex::sTestData, sizeof(complex::sTestData)));
+    ASSERT_EQ(a_util::result::SUCCESS, oDecoder.isValid());
+    ASSERT_EQ(oDecoder.getElementCount() , 23);
+    ASSERT_EQ(access_element::get_value(oDecoder, "test.array[1].child_array[2]").getInt32() , 33);
+
+    // the dynamic layout is recalculated when rebinding through the base class as well
+    StaticDecoder& oBaseDecoder = oDecoder;
+    ASSERT_EQ(a_util::result::SUCCESS, oBaseDecoder.rebind(&sSmaller, sizeof(sSmaller)));
+    ASSERT_EQ(oDecoder.getElementCount() , 13);
+
+    // codecs can not be bound to read-only data through their base classes either
+    complex::tMain sWritable = complex::sTestData;
+    Codec oDynamicCodec = oFactory.makeCodecFor(&sWritable, sizeof(sWritable));
+    ASSERT_NE(a_util::result::SUCCESS,
+              static_cast<Decoder&>(oDynamicCodec).rebind(&complex::sTestData, sizeof(complex::sTestData)));
+    ASSERT_EQ(a_util::result::SUCCESS, oDynamicCodec.rebind(&sSmaller, sizeof(sSmaller)));
+    ASSERT_EQ(oDynamicCodec.getElementCount() , 13);
+
+    CodecFactory oStaticFactory("test", static_struct::strTestDesc);
+    static_struct::tTest sFirst = static_struct::sTestData;
+    static_struct::tTest sSecond = static_struct::sTestData;
+    StaticCodec oCodec = oStaticFactory.makeStaticCodecFor(&sFirst, sizeof(sFirst));
+    ElementHandle<int8_t> oAfter = oStaticFactory.resolve<int8_t>("child[1].after");
+    oCodec.setValue(oAfter, 42);
+    ASSERT_EQ(a_util::result::SUCCESS, oCodec.rebind(&sSecond, sizeof(sSecond)));
+    oCodec.setValue(oAfter, 43);
+    ASSERT_EQ(sFirst.sChild[1].nAfter , 42);
+    ASSERT_EQ(sSecond.sChild[1].nAfter , 43);
+    ASSERT_NE(a_util::result::SUCCESS,
+              static_cast<StaticDecoder&>(oCodec).rebind(&static_struct::sTestData, sizeof(sFirst)));
+}
+
+/**
+* @detail  Check the parallel transformation of many samples
+*/
+TEST(CodecTest,
+    TestBatchTransformer)
+{
+    TEST_REQ("");
+
+    serialization::BatchTransformer oTransformer(4);
+    ASSERT_EQ(oTransformer.getThreadCount() , 4);
+
+    const size_t nCount = 100;
+    CodecFactory oFactory("main", complex::strTestDesc);
+    std::vector<complex::serialized::tMain> vecDestinations(nCount);
+    std::vector<const void*> vecSources(nCount, &complex::sTestData);
+    std::vector<size_t> vecSourceSizes(nCount, sizeof(complex::sTestData));
+    std::vector<void*> vecDestinationPointers;
+    std::vector<size_t> vecDestinationSizes(nCount, sizeof(complex::serialized::tMain));
+    for (size_t nSample = 0; nSample < nCount; ++nSample)
+    {
+        vecDestinationPointers.push_back(&vecDestinations[nSample]);
+    }
+
+    ASSERT_EQ(a_util::result::SUCCESS, oTransformer.transform(oFactory, deserialized,
+                                                              &vecSources[0], &vecSourceSizes[0],
+                                                              &vecDestinationPointers[0], &vecDestinationSizes[0],
+                                                              nCount, true));
+    for (size_t nSample = 0; nSample < nCount; ++nSample)
+    {
+        ASSERT_EQ(a_util::memory::compare(&vecDestinations[nSample], sizeof(complex::serialized::tMain),
+                                          &complex::serialized::sTestData,
+                                          sizeof(complex::serialized::tMain)) , 0);
+    }
+
+    vecDestinationSizes[nCount / 2] = 4;
+    ASSERT_NE(a_util::result::SUCCESS, oTransformer.transform(oFactory, deserialized,
+                                                              &vecSources[0], &vecSourceSizes[0],
+                                                              &vecDestinationPointers[0], &vecDestinationSizes[0],
+                                                              nCount));
+
+    // the error of the sample with the lowest index is returned, no matter which worker is faster
+    vecSources[nCount - 1] = NULL;
+    for (int nRun = 0; nRun < 20; ++nRun)
+    {
+        a_util::result::Result oResult = oTransformer.transform(oFactory, deserialized,
+                                                                &vecSources[0], &vecSourceSizes[0],
+                                                                &vecDestinationPointers[0],
+                                                                &vecDestinationSizes[0], nCount);
+        ASSERT_TRUE(ERR_INVALID_ARG == oResult);
+    }
+}
+
 class cTestPerf
 {
 public:
@@ -706,6 +1174,188 @@ TEST(CodecTest,
     ASSERT_EQ(access_element::get_value(oCodec, "after").asInt32() , 2);
 }
 
+static void importDescription(const char* strDescription,
+                              a_util::memory::unique_ptr<DDLDescription>& pDDL)
+{
+    DDLImporter oImporter;
+    a_util::memory::unique_ptr<DDLDescription> pDefault(
+        DDLDescription::createDefault(DDLVersion::ddl_version_current, 4));
+    ASSERT_EQ(a_util::result::SUCCESS, oImporter.setXML(strDescription));
+    ASSERT_EQ(a_util::result::SUCCESS, oImporter.createPartial(pDefault.get(),
+                                                               DDLVersion::ddl_version_current));
+    pDDL.reset(oImporter.getDDL());
+}
+
+/**
+* @detail Check codec factories created from precompiled layouts
+*/
+TEST(CodecTest,
+    TestPrecompiledLayouts)
+{
+    TEST_REQ("");
+
+    a_util::memory::unique_ptr<DDLDescription> pDDL;
+    importDescription(constants::strTestDesc, pDDL);
+
+    std::string strData;
+    ASSERT_EQ(a_util::result::SUCCESS, PrecompiledLayouts::write(*pDDL, strData));
+
+    PrecompiledLayouts oLayouts;
+    ASSERT_NE(a_util::result::SUCCESS, oLayouts.createFactory("main").isValid());
+    ASSERT_EQ(a_util::result::SUCCESS, oLayouts.load(strData.data(), strData.size()));
+    ASSERT_EQ(oLayouts.getStructCount() , 1);
+    ASSERT_EQ(oLayouts.getStructName(0) , "main");
+    ASSERT_EQ(oLayouts.getStructName(1) , "");
+    ASSERT_NE(a_util::result::SUCCESS, oLayouts.createFactory("unknown").isValid());
+
+    CodecFactory oFactory = oLayouts.createFactory("main");
+    CodecFactory oXMLFactory("main", constants::strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+    ASSERT_EQ(oFactory.getStaticElementCount() , oXMLFactory.getStaticElementCount());
+    ASSERT_EQ(oFactory.getStaticBufferSize(serialized) , oXMLFactory.getStaticBufferSize(serialized));
+    ASSERT_EQ(oFactory.hasDynamicElements() , oXMLFactory.hasDynamicElements());
+
+    // enums and constants are restored as well
+    constants::tMain sTestData = constants::sTestData;
+    Codec oCodec = oFactory.makeCodecFor(&sTestData, sizeof(sTestData));
+    ASSERT_EQ(a_util::result::SUCCESS, oCodec.isValid());
+    ASSERT_EQ(a_util::result::SUCCESS, oCodec.setConstants());
+    ASSERT_EQ(access_element::get_value(oCodec, "static").asInt32() , 1);
+    ASSERT_EQ(access_element::get_value(oCodec, "array[2]").asInt32() , 1);
+    ASSERT_EQ(access_element::get_value(oCodec, "after").asInt32() , 2);
+    ASSERT_EQ(access_element::get_value_as_string(oCodec, "static") , "A");
+    ASSERT_EQ(access_element::get_value_as_string(oCodec, "after") , "E");
+
+    // corrupted or truncated data is rejected
+    std::string strCorrupted = strData;
+    strCorrupted[0] = 'X';
+    ASSERT_NE(a_util::result::SUCCESS, oLayouts.load(strCorrupted.data(), strCorrupted.size()));
+    ASSERT_NE(a_util::result::SUCCESS, oLayouts.load(strData.data(), strData.size() / 2));
+}
+
+/**
+* @detail Check the round trip of precompiled layouts through a mapped file
+*/
+TEST(CodecTest,
+    TestPrecompiledLayoutsFile)
+{
+    TEST_REQ("");
+
+    a_util::memory::unique_ptr<DDLDescription> pDDL;
+    importDescription(static_struct::strTestDesc, pDDL);
+
+    const char* strFile = "tester_codec_precompiled.layouts";
+    ASSERT_EQ(a_util::result::SUCCESS, PrecompiledLayouts::writeFile(*pDDL, strFile));
+
+    CodecFactory oFactory;
+    {
+        PrecompiledLayouts oLayouts;
+        ASSERT_EQ(a_util::result::SUCCESS, oLayouts.load(strFile));
+        ASSERT_EQ(oLayouts.getStructCount() , 2);
+        ASSERT_EQ(oLayouts.getStructName(0) , "child_struct");
+        ASSERT_EQ(oLayouts.getStructName(1) , "test");
+        oFactory = oLayouts.createFactory("test");
+    }
+    std::remove(strFile);
+
+    // the factory stays valid after the file has been unmapped
+    test_static(oFactory, static_struct::sTestData, deserialized);
+    test_static(oFactory, static_struct::serialized::sTestData, serialized);
+
+    ASSERT_NE(a_util::result::SUCCESS, PrecompiledLayouts().load("does_not_exist.layouts"));
+}
+
+/**
+* @detail Check the round trip of precompiled layouts with dynamic elements
+*/
+TEST(CodecTest,
+    TestPrecompiledLayoutsDynamic)
+{
+    TEST_REQ("");
+
+    a_util::memory::unique_ptr<DDLDescription> pDDL;
+    importDescription(complex::strTestDesc, pDDL);
+
+    std::string strData;
+    ASSERT_EQ(a_util::result::SUCCESS, PrecompiledLayouts::write(*pDDL, strData));
+
+    PrecompiledLayouts oLayouts;
+    ASSERT_EQ(a_util::result::SUCCESS, oLayouts.load(strData.data(), strData.size()));
+    CodecFactory oFactory = oLayouts.createFactory("main");
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+    ASSERT_TRUE(oFactory.hasDynamicElements());
+    ::TestDynamicComplex(oFactory, complex::sTestData, deserialized);
+    ::TestDynamicComplex(oFactory, complex::serialized::sTestData, serialized);
+}
+
+/**
+* @detail Check that precompiled element records with invalid values are rejected
+*/
+TEST(CodecTest,
+    TestPrecompiledLayoutsCorruptedRecord)
+{
+    TEST_REQ("");
+
+    a_util::memory::unique_ptr<DDLDescription> pDDL;
+    importDescription(static_struct::strTestDesc, pDDL);
+
+    std::string strData;
+    ASSERT_EQ(a_util::result::SUCCESS, PrecompiledLayouts::write(*pDDL, strData));
+
+    // child_struct is the first struct and has no enums, so its first element record
+    // follows the file header (32 bytes), the struct entries (24 bytes each) and
+    // its layout record (32 bytes)
+    uint64_t nLayoutOffset = 0;
+    std::memcpy(&nLayoutOffset, &strData[32 + 16], sizeof(nLayoutOffset));
+    const size_t nElement = static_cast<size_t>(nLayoutOffset) + 32;
+    const size_t nType = nElement + 16;
+    const size_t nByteOrder = nElement + 20;
+    const size_t nDeserializedOffset = nElement + 48;
+    const size_t nSerializedSize = nElement + 72;
+
+    struct Corruption
+    {
+        size_t offset;
+        uint64_t value;
+        size_t size;
+    };
+    const Corruption aCorruptions[] =
+    {
+        { nType, 0, sizeof(uint32_t) },                            // VT_Empty
+        { nType, 1000, sizeof(uint32_t) },                         // no type at all
+        { nByteOrder, 7, sizeof(int32_t) },                        // no byte order
+        { nDeserializedOffset, 1024 * 8, sizeof(uint64_t) },       // behind the struct
+        { nDeserializedOffset, uint64_t(-4), sizeof(uint64_t) },   // wraps around
+        { nSerializedSize, 65, sizeof(uint64_t) },                 // larger than any type
+    };
+    for (size_t nCorruption = 0; nCorruption < sizeof(aCorruptions) / sizeof(aCorruptions[0]);
+         ++nCorruption)
+    {
+        const Corruption& sCorruption = aCorruptions[nCorruption];
+        std::string strCorrupted = strData;
+        if (sCorruption.size == sizeof(uint32_t))
+        {
+            uint32_t nValue = static_cast<uint32_t>(sCorruption.value);
+            std::memcpy(&strCorrupted[sCorruption.offset], &nValue, sizeof(nValue));
+        }
+        else
+        {
+            std::memcpy(&strCorrupted[sCorruption.offset], &sCorruption.value, sizeof(sCorruption.value));
+        }
+
+        // the records are only read when a factory is created
+        PrecompiledLayouts oLayouts;
+        ASSERT_EQ(a_util::result::SUCCESS, oLayouts.load(strCorrupted.data(), strCorrupted.size()));
+        ASSERT_EQ(oLayouts.getStructName(0) , "child_struct");
+        ASSERT_NE(a_util::result::SUCCESS, oLayouts.createFactory("child_struct").isValid()) << nCorruption;
+    }
+
+    // the unchanged data is fine
+    PrecompiledLayouts oLayouts;
+    ASSERT_EQ(a_util::result::SUCCESS, oLayouts.load(strData.data(), strData.size()));
+    ASSERT_EQ(a_util::result::SUCCESS, oLayouts.createFactory("child_struct").isValid());
+}
+
 namespace all_types
 {
 
@@ -990,3 +1640,65 @@ TEST(CodecTest,
 }
 
 
+
+/**
+* @detail Read and write arrays at once and compare with the element-wise access
+*/
+TEST(CodecTest,
+    TestArrayValues)
+{
+    TEST_REQ("");
+    using namespace static_struct;
+
+    CodecFactory oFactory("test", strTestDesc);
+    ASSERT_EQ(a_util::result::SUCCESS, oFactory.isValid());
+
+    tTest sDeserialized = sTestData;
+    static_struct::serialized::tTest sSerialized = static_struct::serialized::sTestData;
+    void* aData[] = {&sDeserialized, &sSerialized};
+    size_t aSizes[] = {sizeof(sDeserialized), sizeof(sSerialized)};
+    DataRepresentation aReps[] = {ddl::deserialized, ddl::serialized};
+
+    for (size_t nRep = 0; nRep < 2; ++nRep)
+    {
+        Codec oCodec = oFactory.makeCodecFor(aData[nRep], aSizes[nRep], aReps[nRep]);
+        ASSERT_EQ(a_util::result::SUCCESS, oCodec.isValid());
+
+        // packed big endian array
+        int32_t aValues[3] = {0};
+        ASSERT_EQ(a_util::result::SUCCESS, access_element::get_array_values(oCodec, "child[1].value", aValues));
+        ASSERT_EQ(7, aValues[0]);
+        ASSERT_EQ(8, aValues[1]);
+        ASSERT_EQ(9, aValues[2]);
+
+        int32_t aNewValues[3] = {-1, 0x12345678, 42};
+        ASSERT_EQ(a_util::result::SUCCESS, access_element::set_array_values(oCodec, "child[0].value", aNewValues));
+        for (size_t nValue = 0; nValue < 3; ++nValue)
+        {
+            int32_t nValue32 = 0;
+            ASSERT_EQ(a_util::result::SUCCESS, oCodec.getElementValue(1 + nValue, &nValue32));
+            ASSERT_EQ(aNewValues[nValue], nValue32);
+        }
+        ASSERT_EQ(1, access_element::get_value(oCodec, "child[0].value_dummy").getInt8());
+        ASSERT_EQ(5, access_element::get_value(oCodec, "child[0].after").getInt8());
+
+        // mixed elements are accessed one by one
+        uint8_t aMixed[2 * 14];
+        ASSERT_EQ(a_util::result::SUCCESS, oCodec.getArrayValues(0, 10, aMixed));
+        size_t nOffset = 0;
+        for (size_t nElement = 0; nElement < 10; ++nElement)
+        {
+            const StructElement* pElement = NULL;
+            ASSERT_EQ(a_util::result::SUCCESS, oCodec.getElement(nElement, pElement));
+            uint8_t aElement[4] = {0};
+            ASSERT_EQ(a_util::result::SUCCESS, oCodec.getElementValue(nElement, aElement));
+            size_t nSize = pElement->type == a_util::variant::VT_Int8 ? 1 : 4;
+            ASSERT_EQ(0, a_util::memory::compare(aMixed + nOffset, nSize, aElement, nSize));
+            nOffset += nSize;
+        }
+        ASSERT_EQ(sizeof(aMixed), nOffset);
+
+        ASSERT_EQ(a_util::result::SUCCESS, oCodec.setArrayValues(0, 10, aMixed));
+        ASSERT_NE(a_util::result::SUCCESS, oCodec.getArrayValues(8, 3, aMixed));
+    }
+}
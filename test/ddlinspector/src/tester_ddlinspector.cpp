@@ -345,3 +345,108 @@ TEST(cTesterDDLInspector,
     ASSERT_EQ(oInspector.getSuggestions().size(), 7);
 }
 
+
+/// Inspector that counts the checked structs
+class CountingInspector : public DDLInspector
+{
+public:
+    CountingInspector() : DDLInspector(false), m_nStructs(0)
+    {
+    }
+
+    a_util::result::Result visit(DDLComplex* poComplex)
+    {
+        ++m_nStructs;
+        return DDLInspector::visit(poComplex);
+    }
+    using DDLInspector::visit;
+
+    size_t m_nStructs;
+};
+
+/**
+* @detail Test that checking the structs on several threads reports the same
+* suggestions in the same order as the serial check.
+*/
+TEST(cTesterDDLInspector,
+    TestThreadCount)
+{
+    TEST_REQ("");
+
+    const char* aFiles[] =
+    {
+        "files/NestedCaps.description",
+        "files/DynArraySize.description",
+        "files/StructNaming.description",
+        "files/StructElementNaming.description",
+        "files/invalid_duplicate.description",
+        "files/base_all_duplicates.description"
+    };
+
+    for (size_t nFile = 0; nFile < sizeof(aFiles) / sizeof(aFiles[0]); ++nFile)
+    {
+        DDLImporter oImporter(a_util::filesystem::Path(aFiles[nFile]), false);
+        ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNew()) << aFiles[nFile];
+        DDLDescription *poDDL = oImporter.getDDL();
+
+        DDLInspector oSerial(false);
+        oSerial.setWarningLevel(ddl::WarningLevel::verbose);
+        ASSERT_EQ(oSerial.getThreadCount(), 1);
+        a_util::result::Result nSerial = oSerial.visitDDL(poDDL);
+
+        DDLInspector oParallel(false);
+        oParallel.setWarningLevel(ddl::WarningLevel::verbose);
+        oParallel.setThreadCount(4);
+        ASSERT_EQ(oParallel.getThreadCount(), 4);
+        a_util::result::Result nParallel = oParallel.visitDDL(poDDL);
+
+        ASSERT_EQ(nSerial.getErrorCode(), nParallel.getErrorCode()) << aFiles[nFile];
+        ASSERT_EQ(oSerial.foundDynamicArrays(), oParallel.foundDynamicArrays()) << aFiles[nFile];
+
+        ImporterMsgList lstSerial = oSerial.getSuggestions();
+        ImporterMsgList lstParallel = oParallel.getSuggestions();
+        ASSERT_EQ(lstSerial.size(), lstParallel.size()) << aFiles[nFile];
+        for (ImporterMsgList::iterator itSerial = lstSerial.begin(), itParallel = lstParallel.begin();
+            itSerial != lstSerial.end(); ++itSerial, ++itParallel)
+        {
+            ASSERT_EQ(itSerial->desc, itParallel->desc) << aFiles[nFile];
+            ASSERT_EQ(itSerial->severity, itParallel->severity) << aFiles[nFile];
+        }
+    }
+
+    // the inspector keeps working on single structs after a concurrent check
+    DDLImporter oImporter(a_util::filesystem::Path("files/NestedCaps.description"));
+    ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNew());
+    DDLInspector oInspector(false);
+    oInspector.setThreadCount(3);
+    oInspector.visitDDL(oImporter.getDDL());
+    ASSERT_EQ(7, oInspector.getLastBytePosOfAStructReal("tBitmapFormat"));
+    ASSERT_EQ(18, oInspector.getLastBytePosOfAStructReal("tNestTest"));
+
+    // the workers only read a description whose structs are built on first access
+    DDLImporter oDOMImporter(a_util::filesystem::Path("files/NestedCaps.description"));
+    ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.createNew());
+    DDLInspector oDOMInspector(false);
+    a_util::result::Result nDOM = oDOMInspector.visitDDL(oDOMImporter.getDDL());
+
+    DDLImporter oLazyImporter;
+    ASSERT_EQ(a_util::result::SUCCESS, oLazyImporter.createNewLazy(
+        a_util::filesystem::Path("files/NestedCaps.description")));
+    DDLInspector oLazyInspector(false);
+    oLazyInspector.setThreadCount(4);
+    a_util::result::Result nLazy = oLazyInspector.visitDDL(oLazyImporter.getDDL());
+    ASSERT_EQ(nDOM.getErrorCode(), nLazy.getErrorCode());
+    ASSERT_EQ(oDOMInspector.getSuggestions().size(), oLazyInspector.getSuggestions().size());
+    ASSERT_EQ(a_util::result::SUCCESS, oLazyImporter.getDDL()->getStructSourceResult());
+    ASSERT_EQ(oDOMInspector.getLastBytePosOfAStructReal("tNestTest"),
+        oLazyInspector.getLastBytePosOfAStructReal("tNestTest"));
+
+    // derived inspectors keep their overrides, they check serially
+    CountingInspector oSerialCounting;
+    oSerialCounting.visitDDL(oImporter.getDDL());
+    CountingInspector oCounting;
+    oCounting.setThreadCount(4);
+    oCounting.visitDDL(oImporter.getDDL());
+    ASSERT_LE(oImporter.getDDL()->getStructs().size(), oCounting.m_nStructs);
+    ASSERT_EQ(oSerialCounting.m_nStructs, oCounting.m_nStructs);
+}
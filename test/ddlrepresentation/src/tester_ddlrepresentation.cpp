@@ -20,6 +20,7 @@
  * QNX support Copyright (c) 2019 by dSPACE GmbH, Paderborn, Germany. All Rights Reserved
  */
 
+#include <sstream>
 #include <ddl.h>
 #include <gtest/gtest.h>
 #include "../../_common/adtf_compat.h"
@@ -1309,6 +1310,107 @@ void InserStructElement(const std::string& strComplexDT,
     }
 }
 
+/**
+* @detail Check the name lookups of the containers after insertions, removals and renames.
+*/
+TEST(cTesterDDLRep,
+    TestContainerIndex)
+{
+    TEST_REQ("");
+
+    for (int nSorted = 0; nSorted < 2; ++nSorted)
+    {
+        DDLDTVec vecTypes(nSorted != 0);
+        const DDLDTVec& vecConstTypes = vecTypes;
+        // sorted containers insert every type in front of the previous ones
+        for (int nType = 99; nType >= 0; --nType)
+        {
+            vecTypes.insert(new DDLDataType(a_util::strings::format("t%03d", nType), 8));
+        }
+        ASSERT_EQ(vecTypes.size(), 100);
+        for (int nType = 0; nType < 100; ++nType)
+        {
+            std::string strName = a_util::strings::format("t%03d", nType);
+            ASSERT_TRUE(NULL != vecConstTypes.find(strName));
+            ASSERT_EQ(vecConstTypes.find(strName)->getName(), strName);
+            ASSERT_TRUE(NULL != vecTypes.find(strName));
+            ASSERT_EQ(vecTypes.find(strName)->getName(), strName);
+        }
+        ASSERT_TRUE(NULL == vecTypes.find("t100"));
+        ASSERT_TRUE(NULL == vecConstTypes.find("t100"));
+
+        // the types behind a removed one are shifted
+        DDLDTIt itErase = vecTypes.findIt("t050");
+        ASSERT_TRUE(vecTypes.end() != itErase);
+        DDLDataType* pErased = *itErase;
+        vecTypes.erase(itErase);
+        delete pErased;
+        ASSERT_TRUE(NULL == vecConstTypes.find("t050"));
+        ASSERT_TRUE(NULL == vecTypes.find("t050"));
+        ASSERT_EQ(vecConstTypes.find("t051")->getName(), "t051");
+        ASSERT_EQ(vecTypes.find("t099")->getName(), "t099");
+        ASSERT_EQ(vecTypes.find("t000")->getName(), "t000");
+
+        vecTypes.insert(new DDLDataType("t050", 8), 0);
+        ASSERT_EQ(vecTypes.find("t050")->getName(), "t050");
+        ASSERT_EQ(vecTypes.find("t099")->getName(), "t099");
+        ASSERT_EQ(vecTypes.find("t000")->getName(), "t000");
+
+        // the erased element is not accessed, so it may be deleted first like removeDataType does
+        DDLDTIt itDeleted = vecTypes.findIt("t020");
+        delete *itDeleted;
+        vecTypes.erase(itDeleted);
+        ASSERT_TRUE(NULL == vecConstTypes.find("t020"));
+        ASSERT_EQ(vecConstTypes.find("t021")->getName(), "t021");
+        vecTypes.insert(new DDLDataType("t020", 8));
+        ASSERT_EQ(vecConstTypes.find("t020")->getName(), "t020");
+
+        // a range of erased elements leaves no entries behind either
+        DDLDTIt itFirst = vecTypes.findIt("t030");
+        for (DDLDTIt it = itFirst; it != itFirst + 3; ++it)
+        {
+            delete *it;
+        }
+        vecTypes.erase(itFirst, itFirst + 3);
+        ASSERT_EQ(vecTypes.size(), 97);
+        for (DDLDTIt it = vecTypes.begin(); it != vecTypes.end(); ++it)
+        {
+            ASSERT_EQ(vecConstTypes.find((*it)->getName()), *it);
+        }
+
+        vecTypes.find("t010")->setName("tRenamed");
+        vecTypes.reindex();
+        ASSERT_TRUE(NULL == vecTypes.find("t010"));
+        ASSERT_EQ(vecTypes.find("tRenamed")->getName(), "tRenamed");
+        ASSERT_EQ(vecConstTypes.find("t011")->getName(), "t011");
+
+        // a single renamed element
+        DDLDataType* pRenamed = vecTypes.find("t011");
+        pRenamed->setName("tRenamed2");
+        vecTypes.reindex(pRenamed);
+        ASSERT_TRUE(NULL == vecConstTypes.find("t011"));
+        ASSERT_EQ(vecConstTypes.find("tRenamed2"), pRenamed);
+        ASSERT_EQ(*vecTypes.findIt("tRenamed2"), pRenamed);
+
+        // the first one of several elements with the same name is found
+        DDLDataType* pDuplicate = new DDLDataType("t012", 8);
+        vecTypes.insert(pDuplicate, 0);
+        DDLDTIt itFirst012 = std::find_if(vecTypes.begin(), vecTypes.end(), DDLCompareFunctor<>("t012"));
+        ASSERT_EQ(vecConstTypes.find("t012"), *itFirst012);
+        ASSERT_EQ(vecTypes.findIt("t012"), itFirst012);
+        DDLDataType* pFirst012 = *itFirst012;
+        vecTypes.erase(itFirst012);
+        delete pFirst012;
+        ASSERT_TRUE(NULL != vecConstTypes.find("t012"));
+        ASSERT_EQ(*std::find_if(vecTypes.begin(), vecTypes.end(), DDLCompareFunctor<>("t012")),
+                  vecConstTypes.find("t012"));
+
+        vecTypes.deleteAll();
+        ASSERT_TRUE(NULL == vecTypes.find("t000"));
+        ASSERT_TRUE(NULL == vecConstTypes.find("tRenamed"));
+    }
+}
+
 /**
 * @detail Test the insert function by inserting DDL objects at different positions.
 */
@@ -1693,3 +1795,227 @@ TEST(cTesterDDLRep,
     // free allocated resources
     oDDLImporterDyn.destroyDDL();
 }
+
+/// Checks whether the importer reported an error with the given description
+static bool hasImporterError(const DDLImporter& oImporter, const std::string& strDesc)
+{
+    ImporterMsgList lstMessages = oImporter.getAllMessages();
+    for (ImporterMsgList::const_iterator it = lstMessages.begin(); it != lstMessages.end(); ++it)
+    {
+        if (it->severity == importer_error && it->desc == strDesc)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+* @detail The building up of a DDL object representation without a DOM of the whole document.
+* Read several files streamed and compare them to the DOM based import.
+*/
+TEST(cTesterDDLRep,
+    TestStreamedImport)
+{
+    TEST_REQ("");
+
+    const char* strFiles[] = { "files/adtf.description",
+                               "files/fep_driver.description",
+                               "files/adtf_v40.description" };
+    for (size_t nIdx = 0; nIdx < sizeof(strFiles) / sizeof(strFiles[0]); ++nIdx)
+    {
+        DDLImporter oDOMImporter;
+        ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.setFile(strFiles[nIdx]));
+        ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.createNew());
+
+        DDLImporter oStreamedImporter;
+        ASSERT_EQ(a_util::result::SUCCESS, oStreamedImporter.createNewStreamed(
+            a_util::filesystem::Path(strFiles[nIdx]))) << strFiles[nIdx];
+
+        ASSERT_EQ(a_util::result::SUCCESS, DDLCompare::isEqual(oDOMImporter.getDDL(),
+            oStreamedImporter.getDDL(), DDLCompare::dcf_everything)) << strFiles[nIdx];
+
+        oDOMImporter.destroyDDL();
+        oStreamedImporter.destroyDDL();
+    }
+
+    // forward references to structs are resolved at the end of the stream
+    {
+        std::istringstream oStream(
+            "<?xml version=\"1.0\" encoding=\"iso-8859-1\" standalone=\"no\"?>"
+            "<adtf:ddl xmlns:adtf=\"adtf\">"
+            "<header><language_version>3.00</language_version><author>test</author>"
+            "<date_creation>01.01.2017</date_creation><date_change>01.01.2017</date_change>"
+            "<description><!-- <structs> --></description></header>"
+            "<units/><datatypes/><enums/>"
+            "<structs>"
+            "<struct alignment=\"1\" name=\"tOuter\" version=\"1\">"
+            "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"inner\" type=\"tInner\"/>"
+            "</struct>"
+            "<struct alignment=\"1\" name=\"tInner\" version=\"1\">"
+            "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"value\" type=\"tUInt32\"/>"
+            "</struct>"
+            "</structs>"
+            "<streams/>"
+            "</adtf:ddl>");
+        DDLImporter oImporter;
+        ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNewStreamed(oStream));
+        DDLComplex* pOuter = oImporter.getDDL()->getStructByName("tOuter");
+        ASSERT_TRUE(NULL != pOuter);
+        ASSERT_EQ(oImporter.getDDL()->getStructByName("tInner"),
+            pOuter->getElements()[0]->getTypeObject());
+        oImporter.destroyDDL();
+    }
+
+    // datatypes have to precede the structs that use them
+    {
+        std::istringstream oStream(
+            "<adtf:ddl xmlns:adtf=\"adtf\">"
+            "<header><language_version>3.00</language_version><author>test</author>"
+            "<date_creation>01.01.2017</date_creation><date_change>01.01.2017</date_change>"
+            "<description/></header>"
+            "<structs/><datatypes/><streams/>"
+            "</adtf:ddl>");
+        DDLImporter oImporter;
+        ASSERT_EQ(ERR_UNKNOWN_FORMAT, oImporter.createNewStreamed(oStream));
+    }
+
+    // a missing streams section is reported like by the DOM based import, and only fails a full check
+    for (int nFullCheck = 0; nFullCheck < 2; ++nFullCheck)
+    {
+        const char* strNoStreams =
+            "<adtf:ddl xmlns:adtf=\"adtf\">"
+            "<header><language_version>3.00</language_version><author>test</author>"
+            "<date_creation>01.01.2017</date_creation><date_change>01.01.2017</date_change>"
+            "<description/></header>"
+            "<units/><datatypes/><enums/><structs/>"
+            "</adtf:ddl>";
+        DDLImporter oDOMImporter;
+        oDOMImporter.setFullCheckDescriptionMode(nFullCheck == 1);
+        ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.setXML(strNoStreams));
+        a_util::result::Result nDOMResult = oDOMImporter.createNew();
+
+        std::istringstream oStream(strNoStreams);
+        DDLImporter oStreamedImporter;
+        oStreamedImporter.setFullCheckDescriptionMode(nFullCheck == 1);
+        a_util::result::Result nStreamedResult = oStreamedImporter.createNewStreamed(oStream);
+        if (nFullCheck == 1)
+        {
+            ASSERT_EQ(ERR_UNKNOWN_FORMAT, nStreamedResult);
+        }
+        else
+        {
+            ASSERT_EQ(a_util::result::SUCCESS, nStreamedResult);
+        }
+        ASSERT_EQ(nDOMResult, nStreamedResult);
+        ASSERT_TRUE(hasImporterError(oDOMImporter, "DDL does not contain the 'streams' element"));
+        ASSERT_TRUE(hasImporterError(oStreamedImporter, "DDL does not contain the 'streams' element"));
+
+        oDOMImporter.destroyDDL();
+        oStreamedImporter.destroyDDL();
+    }
+
+    // unbalanced documents are rejected
+    {
+        std::istringstream oStream("<adtf:ddl><header><language_version>3.00</language_version>");
+        DDLImporter oImporter;
+        ASSERT_EQ(ERR_UNKNOWN_FORMAT, oImporter.createNewStreamed(oStream));
+    }
+}
+
+/**
+* @detail The building up of a DDL object representation with structs built on first access.
+* Read a file lazily, resolve a struct and compare the complete description to the DOM based import.
+*/
+TEST(cTesterDDLRep,
+    TestLazyImport)
+{
+    TEST_REQ("");
+
+    DDLImporter oDOMImporter;
+    ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.setFile("files/adtf.description"));
+    ASSERT_EQ(a_util::result::SUCCESS, oDOMImporter.createNew());
+
+    DDLImporter oLazyImporter;
+    ASSERT_EQ(a_util::result::SUCCESS, oLazyImporter.createNewLazy(
+        a_util::filesystem::Path("files/adtf.description")));
+    DDLDescription* poLazyDDL = oLazyImporter.getDDL();
+    ASSERT_TRUE(NULL != poLazyDDL);
+
+    // the struct is built with all structs it depends on
+    DDLComplex* poVideo = poLazyDDL->getStructByName("adtf.type.video");
+    ASSERT_TRUE(NULL != poVideo);
+    ASSERT_EQ(poLazyDDL->getStructByName("tBitmapFormat"),
+        poVideo->getElements()[1]->getTypeObject());
+    ASSERT_TRUE(NULL == poLazyDDL->getStructByName("tUnknownStruct"));
+
+    // the resolver only asks for the structs it needs
+    DDLResolver oResolver;
+    oResolver.setTargetName("tCanMessage");
+    ASSERT_EQ(a_util::result::SUCCESS, oResolver.visitDDL(poLazyDDL));
+    ASSERT_NE(std::string::npos, oResolver.getResolvedXML().find("tCanMessage"));
+
+    // all remaining structs are built on access to all structs
+    ASSERT_EQ(a_util::result::SUCCESS, DDLCompare::isEqual(oDOMImporter.getDDL(),
+        poLazyDDL, DDLCompare::dcf_everything));
+
+    oDOMImporter.destroyDDL();
+    oLazyImporter.destroyDDL();
+
+    ASSERT_EQ(a_util::result::SUCCESS, poLazyDDL->getStructSourceResult());
+
+    oDOMImporter.destroyDDL();
+    oLazyImporter.destroyDDL();
+
+    // a struct whose definition fails to build is not found, the failure is kept
+    {
+        std::istringstream oStream(
+            "<adtf:ddl xmlns:adtf=\"adtf\">"
+            "<header><language_version>3.00</language_version><author>test</author>"
+            "<date_creation>01.01.2017</date_creation><date_change>01.01.2017</date_change>"
+            "<description/></header>"
+            "<units/><datatypes/><enums/>"
+            "<structs>"
+            "<struct alignment=\"3\" name=\"tBroken\" version=\"1\">"
+            "<element alignment=\"1\" arraysize=\"1\" byteorder=\"LE\" bytepos=\"0\" name=\"value\" type=\"tUInt32\"/>"
+            "</struct>"
+            "</structs>"
+            "<streams/>"
+            "</adtf:ddl>");
+        DDLImporter oImporter;
+        ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNewLazy(oStream));
+        ASSERT_EQ(a_util::result::SUCCESS, oImporter.getDDL()->getStructSourceResult());
+        ASSERT_TRUE(NULL == oImporter.getDDL()->getStructByName("tBroken"));
+        ASSERT_NE(a_util::result::SUCCESS, oImporter.getDDL()->getStructSourceResult());
+        oImporter.destroyDDL();
+    }
+
+    // concurrent lookups build each struct once
+    {
+        DDLImporter oImporter;
+        ASSERT_EQ(a_util::result::SUCCESS, oImporter.createNewLazy(
+            a_util::filesystem::Path("files/adtf.description")));
+        const DDLDescription* poDDL = oImporter.getDDL();
+        const DDLComplex* aVideos[4] = {};
+        std::vector<a_util::concurrency::thread> vecThreads;
+        for (size_t nThread = 0; nThread < 4; ++nThread)
+        {
+            vecThreads.push_back(a_util::concurrency::thread([poDDL, &aVideos, nThread]()
+            {
+                aVideos[nThread] = poDDL->getStructByName("adtf.type.video");
+                poDDL->getStructs();
+            }));
+        }
+        for (size_t nThread = 0; nThread < vecThreads.size(); ++nThread)
+        {
+            vecThreads[nThread].join();
+        }
+        ASSERT_TRUE(NULL != aVideos[0]);
+        for (size_t nThread = 1; nThread < 4; ++nThread)
+        {
+            ASSERT_EQ(aVideos[0], aVideos[nThread]);
+        }
+        ASSERT_EQ(a_util::result::SUCCESS, poDDL->getStructSourceResult());
+        oImporter.destroyDDL();
+    }
+}
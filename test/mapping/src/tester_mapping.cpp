@@ -19,6 +19,7 @@
 */
 
 #include <memory>   //std::unique_ptr<>
+#include <thread>
 #include <ddl.h>
 #include "a_util/result/error_def.h"
 #include <gtest/gtest.h>
@@ -262,6 +263,45 @@ TEST(cTesterMapping,
     ASSERT_EQ(oConvList[4] , 4);
 }
 
+/**
+* @detail Test the evaluation of arrays by the transformations
+*/
+TEST(cTesterMapping,
+    TestTransformationArrayEvaluation)
+{
+    TEST_REQ("");
+
+    std::unique_ptr<ddl::DDLDescription> poDDL(LoadDDL("files/test.description"));
+    MapConfiguration oConfig(poDDL.get());
+
+    a_util::xml::DOM oDom;
+    ASSERT_TRUE(oDom.load("files/base.map"));
+    ASSERT_EQ(a_util::result::SUCCESS, oConfig.loadFromDOM(oDom));
+
+    // polynom1: 1 + 1.7x + 2x^2 + 1.1x^3
+    const MapTransformationBase* pPolynom = oConfig.getTransformation("polynom1");
+    ASSERT_TRUE(pPolynom);
+    double aValues[7] = { -2, -1, 0, 0.5, 1, 2, 3 };
+    double aResults[7];
+    pPolynom->evaluate(aValues, aResults, 7);
+    for (int i = 0; i < 7; ++i)
+    {
+        ASSERT_EQ(aResults[i], pPolynom->evaluate(aValues[i]));
+    }
+    ASSERT_DOUBLE_EQ(aResults[5], 1 + 1.7 * 2 + 2 * 4 + 1.1 * 8);
+
+    // table1 uses a dense table, values outside of it map to the default
+    const MapTransformationBase* pTable = oConfig.getTransformation("table1");
+    ASSERT_TRUE(pTable);
+    double aKeys[8] = { -1, 0, 1, 2, 3, 4, 5, 1000 };
+    double aExpected[8] = { 3, 4, 5, 6, 7, 4, 3, 3 };
+    pTable->evaluate(aKeys, aKeys, 8);
+    for (int i = 0; i < 8; ++i)
+    {
+        ASSERT_EQ(aKeys[i], aExpected[i]);
+    }
+}
+
 /**
 * @detail Test Configuration to load erroneous Map Files.
 */
@@ -970,9 +1010,18 @@ class MappingDriver : private IMappingEnvironment
     std::map<std::string, handle_t> mapTargetHandle;
     std::map<handle_t, std::string> mapHandleTarget;
     tPeriodicWrappers m_mapPeriodicWrappers;
+    a_util::concurrency::mutex m_oSentMutex;
+    a_util::concurrency::condition_variable m_oSentCondition;
+    std::vector<std::string> m_vecSentTargets;
+    std::map<std::string, std::thread::id> m_mapSentThreads;
+    bool m_bHoldTargets;
+    size_t m_nHeldTargets;
+    std::string m_strLoopBackSource;
+    size_t m_nLoopBacks;
 
 public:
-    MappingDriver(const std::string& strDDL, const std::string& strMapping) : m_oEngine(*this)
+    MappingDriver(const std::string& strDDL, const std::string& strMapping) : m_oEngine(*this),
+        m_bHoldTargets(false), m_nHeldTargets(0), m_nLoopBacks(0)
     {
         setup(strDDL, strMapping);
     }
@@ -1041,6 +1090,46 @@ public:
         ddl::StaticCodec& oTargetCoder = *mapTargetCoders[strTarget];
     }
 
+    void setPublicationMode(PublicationMode eMode)
+    {
+        ASSERT_EQ(a_util::result::SUCCESS, m_oEngine.setPublicationMode(eMode));
+    }
+
+    void enableAsyncEmission(size_t szCapacity, size_t nWorkerCount, BackpressurePolicy ePolicy)
+    {
+        ASSERT_EQ(a_util::result::SUCCESS, m_oEngine.enableAsyncEmission(szCapacity, nWorkerCount, ePolicy));
+    }
+
+    uint64_t getDroppedEmissionCount() const
+    {
+        return m_oEngine.getDroppedEmissionCount();
+    }
+
+    void enableSharding(size_t szShardCount, size_t szCapacity)
+    {
+        ASSERT_EQ(a_util::result::SUCCESS, m_oEngine.enableSharding(szShardCount, szCapacity));
+    }
+
+    size_t getShardCount() const
+    {
+        return m_oEngine.getShardCount();
+    }
+
+    uint64_t getFailedSampleCount() const
+    {
+        return m_oEngine.getFailedSampleCount();
+    }
+
+    void enableInstrumentation(bool bEnabled)
+    {
+        m_oEngine.enableInstrumentation(bEnabled);
+    }
+
+    void getStatistics(MappingStatistics& oStatistics) const
+    {
+        m_oEngine.getStatistics(oStatistics);
+    }
+
     void resetEngine()
     {
         // reset engine
@@ -1082,6 +1171,62 @@ public:
         return mapSources[strSource].pListener->onSampleReceived(&oSourceBuf[0], oSourceBuf.size());
     }
 
+    std::vector<std::string> getSentTargets()
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        return m_vecSentTargets;
+    }
+
+    void clearSentTargets()
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        m_vecSentTargets.clear();
+        m_mapSentThreads.clear();
+    }
+
+    // the thread that sent the target last
+    std::thread::id getSentThread(const std::string& strTarget)
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        return m_mapSentThreads[strTarget];
+    }
+
+    // blocks sendTarget until the targets are released again, for asynchronous emission only
+    void holdTargets(bool bHold)
+    {
+        {
+            std::lock_guard<a_util::concurrency::mutex> oLock(m_oSentMutex);
+            m_bHoldTargets = bHold;
+        }
+        m_oSentCondition.notify_all();
+    }
+
+    // the next targets that are sent receive a sample of the source before sendTarget returns
+    void loopBackTargets(const std::string& strSource, size_t nCount)
+    {
+        std::lock_guard<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        m_strLoopBackSource = strSource;
+        m_nLoopBacks = nCount;
+    }
+
+    void waitForSentTargets(size_t nCount)
+    {
+        std::unique_lock<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        while (m_vecSentTargets.size() < nCount)
+        {
+            m_oSentCondition.wait(oLock);
+        }
+    }
+
+    void waitForHeldTarget()
+    {
+        std::unique_lock<a_util::concurrency::mutex> oLock(m_oSentMutex);
+        while (m_nHeldTargets == 0)
+        {
+            m_oSentCondition.wait(oLock);
+        }
+    }
+
     a_util::result::Result receiveTargetBuffer(const std::string& strTarget)
     {
         Target::MemoryBuffer& oTargetBuffer = mapTargetBuffers[strTarget];
@@ -1110,10 +1255,35 @@ private:
     a_util::result::Result sendTarget(handle_t hTarget, const void* pData,
         size_t szSize, timestamp_t tmTimeStamp) 
     {
+        bool bLoopBack = false;
+        {
+            std::unique_lock<a_util::concurrency::mutex> oLock(m_oSentMutex);
+            m_vecSentTargets.push_back(mapHandleTarget[hTarget]);
+            m_mapSentThreads[mapHandleTarget[hTarget]] = std::this_thread::get_id();
+            m_oSentCondition.notify_all();
+            if (m_bHoldTargets)
+            {
+                ++m_nHeldTargets;
+                while (m_bHoldTargets)
+                {
+                    m_oSentCondition.wait(oLock);
+                }
+                --m_nHeldTargets;
+            }
+            if (m_nLoopBacks > 0)
+            {
+                --m_nLoopBacks;
+                bLoopBack = true;
+            }
+        }
         if(szSize == mapTargetBuffers[mapHandleTarget[hTarget]].size())
         {
             a_util::memory::copy(&mapTargetBuffers[mapHandleTarget[hTarget]][0], szSize, pData, szSize);
         }
+        if (bLoopBack)
+        {
+            return sendSourceBuffer(m_strLoopBackSource);
+        }
         return a_util::result::SUCCESS;
     }
 
@@ -1602,4 +1772,500 @@ TEST(cTesterMapping,
     ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSource1, "i32Val", a_util::variant::Variant(i32Val)));
     base_test.sendSourceBuffer("MinimalSignal"); // fires less_than and less_than_equal
     ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 17 % 5);
-}
\ No newline at end of file
+}
+
+/**
+* @detail Test that signal and data triggers of a source fire in the order they were added
+*/
+TEST(cTesterMapping,
+    TestTriggerOrderEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_trigger_order.map");
+    base_test.addTarget("OutData1");
+    base_test.addTarget("OutSignal");
+    base_test.addTarget("OutData2");
+    base_test.startEngine();
+
+    base_test.clearSentTargets();
+    base_test.sendSourceBuffer("MinimalSignal");
+    std::vector<std::string> vecSent = base_test.getSentTargets();
+    ASSERT_EQ(vecSent.size(), 3);
+    ASSERT_EQ(vecSent[0], "OutData1");
+    ASSERT_EQ(vecSent[1], "OutSignal");
+    ASSERT_EQ(vecSent[2], "OutData2");
+
+    // data triggers whose comparison fails are skipped without changing the order
+    ddl::StaticCodec& oSource = base_test.getSourceCoder("MinimalSignal");
+    int32_t i32Val = 1;
+    ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSource, "i32Val", a_util::variant::Variant(i32Val)));
+    base_test.clearSentTargets();
+    base_test.sendSourceBuffer("MinimalSignal");
+    vecSent = base_test.getSentTargets();
+    ASSERT_EQ(vecSent.size(), 1);
+    ASSERT_EQ(vecSent[0], "OutSignal");
+}
+
+/**
+* @detail Test Engine reset to the default values
+*/
+TEST(cTesterMapping,
+    TestResetEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 2 % 5);
+
+    // the first reset during Map() created the default image, every reset restores it
+    for (int i = 0; i < 2; ++i)
+    {
+        base_test.stopEngine();
+        base_test.resetEngine();
+        base_test.startEngine();
+
+        base_test.receiveTargetBuffer("OutSignal3");
+        ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 0);
+        ASSERT_EQ(ddl::access_element::get_value(oTarget3, "i8Val").asInt8(), 42);
+
+        base_test.sendSourceBuffer("InSignal");
+        ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 1);
+    }
+}
+
+/**
+* @detail Test Engine with snapshot publication of the target buffers
+*/
+TEST(cTesterMapping,
+    TestSnapshotPublicationEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.setPublicationMode(e_publish_snapshot);
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+    ddl::StaticCodec& oSource1 = base_test.getSourceCoder("MinimalSignal");
+
+    base_test.receiveTargetBuffer("OutSignal3");
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 0 % 5);
+
+    // signal triggers send the snapshot
+    base_test.sendSourceBuffer("InSignal");
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 1 % 5);
+
+    // data triggers send the snapshot
+    int32_t i32Val = -42;
+    ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSource1, "i32Val", a_util::variant::Variant(i32Val)));
+    base_test.sendSourceBuffer("MinimalSignal"); // fires not_equal, less_than and less_than_equal
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 4 % 5);
+}
+
+/**
+* @detail Test Engine with sharding of independent source groups
+*/
+TEST(cTesterMapping,
+    TestShardedEngineGroups)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_sharding.map");
+    base_test.enableSharding(4, 2);
+    base_test.addTarget("OutA");
+    base_test.addTarget("OutB");
+    base_test.addTarget("OutBC");
+
+    for (int nRun = 0; nRun < 2; ++nRun)
+    {
+        // InA is mapped on its own, InB and InC share OutBC
+        base_test.clearSentTargets();
+        base_test.startEngine();
+        ASSERT_EQ(base_test.getShardCount(), 2);
+
+        ddl::StaticCodec& oSourceA = base_test.getSourceCoder("InA");
+        ddl::StaticCodec& oSourceB = base_test.getSourceCoder("InB");
+        ddl::StaticCodec& oSourceC = base_test.getSourceCoder("InC");
+        ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSourceA, "i8Val", a_util::variant::Variant(int8_t(5 + nRun))));
+        ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSourceB, "i32Val", a_util::variant::Variant(int32_t(7 + nRun))));
+        ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSourceC, "i16Val", a_util::variant::Variant(int16_t(9 + nRun))));
+        for (int nSample = 0; nSample < 4; ++nSample)
+        {
+            ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("InA"));
+            ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("InB"));
+            ASSERT_EQ(a_util::result::SUCCESS, base_test.sendSourceBuffer("InC"));
+        }
+        base_test.stopEngine();
+        ASSERT_EQ(base_test.getSentTargets().size(), 12);
+        ASSERT_EQ(base_test.getFailedSampleCount(), 0);
+
+        // the groups are mapped by different workers, never by the caller
+        ASSERT_NE(base_test.getSentThread("OutA"), std::this_thread::get_id());
+        ASSERT_NE(base_test.getSentThread("OutB"), std::this_thread::get_id());
+        ASSERT_NE(base_test.getSentThread("OutA"), base_test.getSentThread("OutB"));
+        ASSERT_EQ(base_test.getSentThread("OutB"), base_test.getSentThread("OutBC"));
+
+        ddl::StaticCodec& oTargetA = base_test.getTargetCoder("OutA");
+        ddl::StaticCodec& oTargetB = base_test.getTargetCoder("OutB");
+        ddl::StaticCodec& oTargetBC = base_test.getTargetCoder("OutBC");
+        ASSERT_EQ(ddl::access_element::get_value(oTargetA, "i8Val").asInt8(), 5 + nRun);
+        ASSERT_EQ(ddl::access_element::get_value(oTargetB, "i32Val").asInt32(), 7 + nRun);
+        ASSERT_EQ(ddl::access_element::get_value(oTargetBC, "i32Val").asInt32(), 7 + nRun);
+        ASSERT_EQ(ddl::access_element::get_value(oTargetBC, "i16Val").asInt16(), 9 + nRun);
+    }
+}
+
+/**
+* @detail Test that both publication modes update the macro assignments the same way
+*/
+TEST(cTesterMapping,
+    TestPublicationModesMacros)
+{
+    TEST_REQ("");
+
+    const PublicationMode aModes[] = { e_publish_locked, e_publish_snapshot };
+    uint32_t aCounters[2][2] = {};
+    for (int nMode = 0; nMode < 2; ++nMode)
+    {
+        MappingDriver base_test("files/engine.description", "files/engine_macros.map");
+        base_test.setPublicationMode(aModes[nMode]);
+        base_test.addTarget("OutSignal");
+        base_test.startEngine();
+
+        ddl::StaticCodec& oTarget = base_test.getTargetCoder("OutSignal");
+
+        // simulation_time is updated for buffer reads
+        timestamp_t tmTime = a_util::system::getCurrentMicroseconds();
+        base_test.receiveTargetBuffer("OutSignal");
+        ASSERT_TRUE(ddl::access_element::get_value(oTarget, "ui64Val").asUInt64() >= (uint64_t)tmTime);
+        aCounters[nMode][0] = ddl::access_element::get_value(oTarget, "ui32Val").asUInt32();
+
+        // and for triggered sends together with trigger_counter
+        tmTime = a_util::system::getCurrentMicroseconds();
+        base_test.sendSourceBuffer("InSignal");
+        base_test.sendSourceBuffer("InSignal");
+        ASSERT_TRUE(ddl::access_element::get_value(oTarget, "ui64Val").asUInt64() >= (uint64_t)tmTime);
+        aCounters[nMode][1] = ddl::access_element::get_value(oTarget, "ui32Val").asUInt32();
+    }
+
+    ASSERT_EQ(aCounters[0][0], 0);
+    ASSERT_EQ(aCounters[0][1], 2);
+    ASSERT_EQ(aCounters[1][0], aCounters[0][0]);
+    ASSERT_EQ(aCounters[1][1], aCounters[0][1]);
+}
+
+/**
+* @detail Test Engine with asynchronous emission of the targets
+*/
+TEST(cTesterMapping,
+    TestAsyncEmissionEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.enableAsyncEmission(4, 1, e_block);
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+
+    // the signal trigger queues the target, stopping the engine sends all queued targets
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    base_test.stopEngine();
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 2 % 5);
+    ASSERT_EQ(base_test.getDroppedEmissionCount(), 0);
+}
+
+/**
+* @detail Test Engine with asynchronous emission of targets that trigger further emissions
+*/
+TEST(cTesterMapping,
+    TestAsyncEmissionLoopBack)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_sharding.map");
+    base_test.enableAsyncEmission(1, 1, e_block);
+    base_test.addTarget("OutA");
+    base_test.addTarget("OutB");
+    base_test.startEngine();
+
+    // the worker is stuck sending the first emission, the second one fills the queue
+    base_test.clearSentTargets();
+    base_test.holdTargets(true);
+    base_test.sendSourceBuffer("InA");
+    base_test.waitForHeldTarget();
+    base_test.sendSourceBuffer("InA");
+
+    // sending the first emission triggers OutB, the worker can not wait for space in the queue
+    base_test.loopBackTargets("InB", 1);
+    base_test.holdTargets(false);
+    base_test.waitForSentTargets(3);
+    base_test.stopEngine();
+
+    std::vector<std::string> vecSent = base_test.getSentTargets();
+    ASSERT_EQ(vecSent.size(), 3);
+    ASSERT_EQ(vecSent[0], "OutA");
+    ASSERT_EQ(vecSent[1], "OutB");
+    ASSERT_EQ(vecSent[2], "OutA");
+    ASSERT_EQ(base_test.getDroppedEmissionCount(), 0);
+}
+
+/**
+* @detail Test Engine with asynchronous emission that drops the oldest emission of a full queue
+*/
+TEST(cTesterMapping,
+    TestAsyncEmissionDropOldest)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.enableAsyncEmission(1, 1, e_drop_oldest);
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+
+    // the worker is stuck sending the first emission
+    base_test.clearSentTargets();
+    base_test.holdTargets(true);
+    base_test.sendSourceBuffer("InSignal");
+    base_test.waitForHeldTarget();
+
+    // the second emission fills the queue, the third and fourth replace the oldest one
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    ASSERT_EQ(base_test.getDroppedEmissionCount(), 2);
+
+    base_test.holdTargets(false);
+    base_test.stopEngine();
+    ASSERT_EQ(base_test.getSentTargets().size(), 2);
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 4 % 5);
+}
+
+/**
+* @detail Test Engine with asynchronous emission that coalesces queued emissions of a target
+*/
+TEST(cTesterMapping,
+    TestAsyncEmissionCoalesce)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.enableAsyncEmission(4, 1, e_coalesce);
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+
+    // the worker is stuck sending the first emission
+    base_test.clearSentTargets();
+    base_test.holdTargets(true);
+    base_test.sendSourceBuffer("InSignal");
+    base_test.waitForHeldTarget();
+
+    // there is room in the queue, but the queued emission of the target is replaced
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    ASSERT_EQ(base_test.getDroppedEmissionCount(), 2);
+
+    base_test.holdTargets(false);
+    base_test.stopEngine();
+    ASSERT_EQ(base_test.getSentTargets().size(), 2);
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 4 % 5);
+}
+
+/**
+* @detail Test Engine with sharded mapping of the sources
+*/
+TEST(cTesterMapping,
+    TestShardedEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.enableSharding(2, 4);
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    // both sources trigger OutSignal3, so they are mapped by the same shard
+    ASSERT_EQ(base_test.getShardCount(), 1);
+
+    ddl::StaticCodec& oTarget3 = base_test.getTargetCoder("OutSignal3");
+    ddl::StaticCodec& oSource1 = base_test.getSourceCoder("MinimalSignal");
+
+    // the samples are queued, stopping the engine maps all queued samples in order
+    base_test.sendSourceBuffer("InSignal");
+    int32_t i32Val = -42;
+    ASSERT_EQ(a_util::result::SUCCESS, ddl::access_element::set_value(oSource1, "i32Val", a_util::variant::Variant(i32Val)));
+    base_test.sendSourceBuffer("MinimalSignal"); // fires not_equal, less_than and less_than_equal
+    base_test.stopEngine();
+    ASSERT_EQ(ddl::access_element::get_value(oTarget3, "ui32Val").asUInt32(), 4 % 5);
+}
+
+/**
+* @detail Test Engine with instrumentation
+*/
+TEST(cTesterMapping,
+    TestInstrumentationEngine)
+{
+    TEST_REQ("");
+
+    MappingDriver base_test("files/engine.description", "files/engine_triggers.map");
+    base_test.addTarget("OutSignal3");
+    base_test.startEngine();
+
+    // nothing is collected while the instrumentation is disabled
+    base_test.sendSourceBuffer("InSignal");
+    MappingStatistics oStatistics;
+    base_test.getStatistics(oStatistics);
+    for (size_t nIdx = 0; nIdx < oStatistics.sources.size(); ++nIdx)
+    {
+        ASSERT_EQ(oStatistics.sources[nIdx].samples_received, 0);
+    }
+
+    base_test.enableInstrumentation(true);
+    base_test.sendSourceBuffer("InSignal");
+    base_test.sendSourceBuffer("InSignal");
+    base_test.enableInstrumentation(false);
+    base_test.getStatistics(oStatistics);
+
+    bool bSourceFound = false;
+    for (size_t nIdx = 0; nIdx < oStatistics.sources.size(); ++nIdx)
+    {
+        if (oStatistics.sources[nIdx].name == "InSignal")
+        {
+            bSourceFound = true;
+            ASSERT_EQ(oStatistics.sources[nIdx].samples_received, 2);
+            ASSERT_EQ(oStatistics.sources[nIdx].receive_time.count, 2);
+        }
+    }
+    ASSERT_TRUE(bSourceFound);
+
+    bool bTriggerFound = false;
+    for (size_t nIdx = 0; nIdx < oStatistics.triggers.size(); ++nIdx)
+    {
+        if (oStatistics.triggers[nIdx].name == "InSignal")
+        {
+            bTriggerFound = true;
+            ASSERT_EQ(oStatistics.triggers[nIdx].fire_count, 2);
+        }
+    }
+    ASSERT_TRUE(bTriggerFound);
+
+    // the target is locked for each emission, InSignal has no assignments to it
+    ASSERT_EQ(oStatistics.targets.size(), 1);
+    const TargetStatistics& oTarget = oStatistics.targets[0];
+    ASSERT_EQ(oTarget.name, "OutSignal3");
+    ASSERT_EQ(oTarget.emissions, 2);
+    ASSERT_EQ(oTarget.send_time.count, 2);
+    ASSERT_EQ(oTarget.lock_wait.count, 2);
+    ASSERT_EQ(oTarget.source_to_emit.count, 0);
+    ASSERT_LE(oTarget.send_time.getPercentile(50), oTarget.send_time.getPercentile(100));
+}
+
+/// Mapping environment that only records the registered timers
+class TimerRecordingEnvironment : public IMappingEnvironment
+{
+public:
+    std::map<mapping::rt::IPeriodicListener*, timestamp_t> mapTimers;
+    bool bFailRegistration;
+
+    TimerRecordingEnvironment() : bFailRegistration(false)
+    {
+    }
+
+    a_util::result::Result registerSource(const char* strSourceName,
+        const char* strTypeName, ISignalListener* pListener, handle_t& hHandle) { return ERR_NOT_FOUND; }
+    a_util::result::Result unregisterSource(handle_t hHandle) { return ERR_NOT_FOUND; }
+    a_util::result::Result sendTarget(handle_t hTarget, const void* pData,
+        size_t szSize, timestamp_t tmTimeStamp) { return ERR_NOT_FOUND; }
+    a_util::result::Result targetMapped(const char* strTargetName, const char* strTargetType,
+        handle_t hTarget, size_t szTargetSize) { return ERR_NOT_FOUND; }
+    a_util::result::Result targetUnmapped(const char* strTargetName, handle_t hTarget) { return ERR_NOT_FOUND; }
+    a_util::result::Result resolveType(const char* strTypeName, const char*& strTypeDescription) { return ERR_NOT_FOUND; }
+    timestamp_t getTime() const { return 0; }
+
+    a_util::result::Result registerPeriodicTimer(timestamp_t tmPeriod_us, mapping::rt::IPeriodicListener* pListener)
+    {
+        if (bFailRegistration)
+        {
+            return ERR_NOT_FOUND;
+        }
+        mapTimers[pListener] = tmPeriod_us;
+        return a_util::result::SUCCESS;
+    }
+
+    a_util::result::Result unregisterPeriodicTimer(timestamp_t tmPeriod_us, mapping::rt::IPeriodicListener* pListener)
+    {
+        mapTimers.erase(pListener);
+        return a_util::result::SUCCESS;
+    }
+};
+
+/**
+* @detail Test the grouping of harmonic periodic triggers
+*/
+TEST(cTesterMapping,
+    TestPeriodicScheduler)
+{
+    TEST_REQ("");
+
+    TimerRecordingEnvironment oEnv;
+    PeriodicScheduler oScheduler(oEnv);
+
+    PeriodicTrigger oTrigger10(oEnv, "10ms", 10, &oScheduler);
+    PeriodicTrigger oTrigger20(oEnv, "20ms", 20, &oScheduler);
+    ASSERT_EQ(a_util::result::SUCCESS, oTrigger20.create());
+    ASSERT_EQ(a_util::result::SUCCESS, oTrigger10.create());
+    ASSERT_EQ(oEnv.mapTimers.size(), 1);
+    ASSERT_EQ(oEnv.mapTimers.begin()->second, 10000);
+    {
+        // 15ms is not harmonic to 10ms, 30ms runs with the 10ms group
+        PeriodicTrigger oTrigger15(oEnv, "15ms", 15, &oScheduler);
+        PeriodicTrigger oTrigger30(oEnv, "30ms", 30, &oScheduler);
+        ASSERT_EQ(a_util::result::SUCCESS, oTrigger15.create());
+        ASSERT_EQ(a_util::result::SUCCESS, oTrigger30.create());
+        ASSERT_EQ(oScheduler.getTimerCount(), 2);
+
+        // 5ms takes over both groups
+        PeriodicTrigger oTrigger5(oEnv, "5ms", 5, &oScheduler);
+        ASSERT_EQ(a_util::result::SUCCESS, oTrigger5.create());
+        ASSERT_EQ(oScheduler.getTimerCount(), 1);
+        ASSERT_EQ(oEnv.mapTimers.begin()->second, 5000);
+        ASSERT_NE(a_util::result::SUCCESS, oScheduler.add(&oTrigger5));
+    }
+    // the remaining 10ms and 20ms triggers run at 10ms again
+    ASSERT_EQ(oEnv.mapTimers.size(), 1);
+    ASSERT_EQ(oScheduler.getTimerCount(), 1);
+    ASSERT_EQ(oEnv.mapTimers.begin()->second, 10000);
+
+    // the groups are kept if the timer of a new group can not be registered
+    {
+        oEnv.bFailRegistration = true;
+        PeriodicTrigger oTrigger5(oEnv, "5ms", 5, &oScheduler);
+        ASSERT_NE(a_util::result::SUCCESS, oScheduler.add(&oTrigger5));
+        ASSERT_EQ(oScheduler.getTimerCount(), 1);
+        ASSERT_EQ(oEnv.mapTimers.size(), 1);
+        ASSERT_EQ(oEnv.mapTimers.begin()->second, 10000);
+        ASSERT_NE(a_util::result::SUCCESS, oScheduler.remove(&oTrigger5));
+        oEnv.bFailRegistration = false;
+    }
+
+    // the initial trigger keeps its own timer
+    PeriodicTrigger oTriggerIni(oEnv, "ini", 0, &oScheduler);
+    ASSERT_EQ(a_util::result::SUCCESS, oTriggerIni.create());
+    ASSERT_EQ(oEnv.mapTimers.size(), 2);
+    ASSERT_EQ(oScheduler.getTimerCount(), 1);
+}